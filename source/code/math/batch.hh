@@ -0,0 +1,105 @@
+/**
+ * @file batch.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Many small matrices of the same shape, worked on all at once.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "matrix.hh"
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace ml
+{
+    /**
+     * @brief count matrices, each rows x cols, stored structure-of-arrays:
+     * element i, j of every matrix sits in one contiguous lane, so element
+     * i, j of matrix b is lane ( i, j ) [ b ].
+     * @details Working on one small matrix at a time leaves most of a vector
+     * register empty (a 3 x 3 row is three elements) and spends its time on
+     * loop overhead. With this layout the kernels below loop over the
+     * matrices innermost instead, so every step of a 3 x 3 product or
+     * inverse runs as one unit-stride loop over the whole batch that the
+     * compiler vectorizes, and the batch splits across the thread pool.
+     * @note Write straight into the lanes to fill a batch without copying.
+     */
+    template < CONCEPT_NAMESPACE Floating V > class Batch
+    {
+        std::vector< V > elements;
+        std::size_t      nMatrices = 0;
+        std::size_t      nRows     = 0;
+        std::size_t      nCols     = 0;
+    public:
+        Batch ( ) = default;
+        // count matrices of zeros.
+        Batch ( std::size_t count, std::size_t rows, std::size_t cols );
+
+        std::size_t size ( ) const NOEXCEPT;
+        std::size_t rowCount ( ) const NOEXCEPT;
+        std::size_t colCount ( ) const NOEXCEPT;
+
+        // element row, col of every matrix, size ( ) elements long.
+        V       *lane ( std::size_t row, std::size_t col ) NOEXCEPT;
+        V const *lane ( std::size_t row, std::size_t col ) const NOEXCEPT;
+
+        V       &operator( ) ( std::size_t which,
+                               std::size_t row,
+                               std::size_t col ) NOEXCEPT;
+        V const &operator( ) ( std::size_t which,
+                               std::size_t row,
+                               std::size_t col ) const NOEXCEPT;
+
+        /**
+         * @brief Copies matrix which out of the batch, or that into it.
+         * @throws std::out_of_range if which is past the end or the shapes
+         * differ.
+         */
+        Matrix< V > get ( std::size_t which ) const;
+        template < CONCEPT_NAMESPACE Floating W >
+        void set ( std::size_t which, Matrix< W > const &that );
+    };
+
+    /**
+     * @brief C = alpha * A * B + beta * C for every matrix in the batches.
+     * @throws std::out_of_range if the batches differ in size or the shapes
+     * do not line up.
+     * @note C is not read when beta is zero.
+     */
+    template < CONCEPT_NAMESPACE Floating X,
+               CONCEPT_NAMESPACE Floating V,
+               CONCEPT_NAMESPACE Floating W >
+    void gemm ( typename std::common_type< X >::type alpha,
+                Batch< V > const                     &a,
+                Batch< W > const                     &b,
+                typename std::common_type< X >::type beta,
+                Batch< X >                           &c );
+
+    /**
+     * @brief Solves A X = B for every matrix in the batches by Gauss-Jordan
+     * elimination with partial pivoting, overwriting B with X.
+     * @return the number of singular matrices in A. Their solutions are
+     * left unspecified; every other solution is unaffected by them.
+     * @throws std::out_of_range if the matrices in A are not square or the
+     * batches do not line up.
+     */
+    template < CONCEPT_NAMESPACE Floating V >
+    std::size_t solve ( Batch< V > const &a, Batch< V > &b );
+
+    /**
+     * @brief Writes the inverse of every matrix in A into output, which
+     * must have the same shape and size and must not be A.
+     * @return the number of singular matrices, as for solve.
+     */
+    template < CONCEPT_NAMESPACE Floating V >
+    std::size_t invert ( Batch< V > const &a, Batch< V > &output );
+} // namespace ml
+
+#include "batch.tcc"
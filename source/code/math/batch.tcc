@@ -0,0 +1,350 @@
+/**
+ * @file batch.tcc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief This C++ file is meant to be included only in batch.hh
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Batch< V >::Batch ( std::size_t count, std::size_t rows, std::size_t cols ) :
+    elements ( count * rows * cols, V { 0 } ),
+    nMatrices ( count ),
+    nRows ( rows ),
+    nCols ( cols )
+{
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::Batch< V >::size ( ) const noexcept
+{
+    return nMatrices;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::Batch< V >::rowCount ( ) const noexcept
+{
+    return nRows;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::Batch< V >::colCount ( ) const noexcept
+{
+    return nCols;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+V *ml::Batch< V >::lane ( std::size_t row, std::size_t col ) noexcept
+{
+    return elements.data ( ) + ( row * nCols + col ) * nMatrices;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+V const *ml::Batch< V >::lane ( std::size_t row, std::size_t col ) const noexcept
+{
+    return elements.data ( ) + ( row * nCols + col ) * nMatrices;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+V &ml::Batch< V >::operator( ) ( std::size_t which,
+                                 std::size_t row,
+                                 std::size_t col ) noexcept
+{
+    return lane ( row, col ) [ which ];
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+V const &ml::Batch< V >::operator( ) ( std::size_t which,
+                                       std::size_t row,
+                                       std::size_t col ) const noexcept
+{
+    return lane ( row, col ) [ which ];
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > ml::Batch< V >::get ( std::size_t which ) const
+{
+    if ( which >= nMatrices )
+    {
+        throw std::out_of_range ( "Matrix out of range!" );
+    }
+    Matrix< V > output { nRows, nCols };
+    for ( std::size_t i = 0; i < nRows; i++ )
+    {
+        for ( std::size_t j = 0; j < nCols; j++ )
+        {
+            output.data ( ) [ i * output.leadingDimension ( ) + j ] =
+                    ( *this ) ( which, i, j );
+        }
+    }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+template < CONCEPT_NAMESPACE Floating W >
+void ml::Batch< V >::set ( std::size_t which, Matrix< W > const &that )
+{
+    if ( which >= nMatrices )
+    {
+        throw std::out_of_range ( "Matrix out of range!" );
+    }
+    if ( that.rowCount ( ) != nRows || that.colCount ( ) != nCols )
+    {
+        throw std::out_of_range ( "Shape mismatch!" );
+    }
+    for ( std::size_t i = 0; i < nRows; i++ )
+    {
+        for ( std::size_t j = 0; j < nCols; j++ )
+        {
+            ( *this ) ( which, i, j ) =
+                    that.data ( ) [ i * that.leadingDimension ( ) + j ];
+        }
+    }
+}
+
+namespace ml
+{
+    namespace batch
+    {
+        // matrices per tile. Every kernel finishes one tile before starting
+        // the next, so the tile's lanes stay in L1 through all of the
+        // passes over them instead of streaming the whole batch each time.
+        constexpr std::size_t tile = 128;
+
+        template < class X, class V, class W >
+        void gemmTile ( X                 alpha,
+                        Batch< V > const &a,
+                        Batch< W > const &b,
+                        X                 beta,
+                        Batch< X >       &c,
+                        std::size_t       first,
+                        std::size_t       last )
+        {
+            // C ( i, j ) = alpha * sum of A ( i, p ) * B ( p, j ) +
+            // beta * C ( i, j ), with the loop over matrices innermost.
+            std::size_t const width = last - first;
+            for ( std::size_t i = 0; i < c.rowCount ( ); i++ )
+            {
+                for ( std::size_t j = 0; j < c.colCount ( ); j++ )
+                {
+                    X *out = c.lane ( i, j ) + first;
+                    if ( beta == X { 0 } )
+                    {
+                        std::fill ( out, out + width, X { 0 } );
+                    }
+                    else if ( beta != X { 1 } )
+                    {
+                        kernel::scale ( width, beta, out, out );
+                    }
+                    for ( std::size_t p = 0; p < a.colCount ( ); p++ )
+                    {
+                        kernel::multiplyAdd ( width,
+                                              alpha,
+                                              a.lane ( i, p ) + first,
+                                              b.lane ( p, j ) + first,
+                                              out );
+                    }
+                }
+            }
+        }
+
+        // b <- the solution of a x = b for matrices first to last, where a
+        // holds those matrices as n x n lanes, each tile elements long, and
+        // ends up as the identity. Returns how many of them are singular.
+        template < class V >
+        std::size_t eliminateTile ( V          *a,
+                                    std::size_t n,
+                                    Batch< V >  &b,
+                                    std::size_t first,
+                                    std::size_t last )
+        {
+            std::size_t const m     = b.colCount ( );
+            std::size_t const width = last - first;
+            auto lhs = [ & ] ( std::size_t i, std::size_t j ) {
+                return a + ( i * n + j ) * tile;
+            };
+            auto rhs = [ & ] ( std::size_t i, std::size_t j ) {
+                return b.lane ( i, j ) + first;
+            };
+            unsigned char singular [ tile ] = { };
+            for ( std::size_t k = 0; k < n; k++ )
+            {
+                // every matrix may pivot on a different row, so bring the
+                // largest candidate up to row k with a compare and select
+                // per matrix rather than a branch. Column k decides each
+                // swap, so it is swapped last.
+                for ( std::size_t i = k + 1; i < n; i++ )
+                {
+                    V const *top       = lhs ( k, k );
+                    V const *candidate = lhs ( i, k );
+                    for ( std::size_t j = 0; j < m; j++ )
+                    {
+                        kernel::pivot ( width,
+                                        top,
+                                        candidate,
+                                        rhs ( k, j ),
+                                        rhs ( i, j ) );
+                    }
+                    for ( std::size_t j = n; j-- > k; )
+                    {
+                        kernel::pivot ( width,
+                                        top,
+                                        candidate,
+                                        lhs ( k, j ),
+                                        lhs ( i, j ) );
+                    }
+                }
+                // scale row k so the pivot is one,
+                V const *pivot = lhs ( k, k );
+                for ( std::size_t t = 0; t < width; t++ )
+                {
+                    singular [ t ] |= pivot [ t ] == V { 0 };
+                }
+                for ( std::size_t j = k + 1; j < n; j++ )
+                {
+                    kernel::quotient ( width, lhs ( k, j ), pivot, lhs ( k, j ) );
+                }
+                for ( std::size_t j = 0; j < m; j++ )
+                {
+                    kernel::quotient ( width, rhs ( k, j ), pivot, rhs ( k, j ) );
+                }
+                // and clear column k from every other row.
+                for ( std::size_t i = 0; i < n; i++ )
+                {
+                    if ( i == k )
+                    {
+                        continue;
+                    }
+                    V const *factor = lhs ( i, k );
+                    for ( std::size_t j = k + 1; j < n; j++ )
+                    {
+                        kernel::multiplyAdd ( width,
+                                              V { -1 },
+                                              factor,
+                                              lhs ( k, j ),
+                                              lhs ( i, j ) );
+                    }
+                    for ( std::size_t j = 0; j < m; j++ )
+                    {
+                        kernel::multiplyAdd ( width,
+                                              V { -1 },
+                                              factor,
+                                              rhs ( k, j ),
+                                              rhs ( i, j ) );
+                    }
+                }
+            }
+            return std::size_t ( std::count ( singular, singular + width, 1 ) );
+        }
+
+        // solves a x = b for every matrix, one tile at a time, after
+        // setting b to the identity if inverting. Returns how many of the
+        // matrices are singular.
+        template < class V >
+        std::size_t eliminate ( Batch< V > const &a, Batch< V > &b, bool inverting )
+        {
+            std::size_t const          n     = a.rowCount ( );
+            std::size_t const          m     = b.colCount ( );
+            std::size_t const          count = a.size ( );
+            std::atomic< std::size_t > singular { 0 };
+            thread::parallelFor (
+                    0,
+                    count,
+                    std::max ( tile, thread::grainFor ( count, n * n * ( n + m ) ) ),
+                    [ & ] ( std::size_t first, std::size_t last ) {
+                        // the elimination overwrites A, so each tile of it
+                        // is copied into a workspace that stays in cache.
+                        std::vector< V > work ( n * n * tile );
+                        std::size_t      found = 0;
+                        for ( std::size_t lo = first; lo < last; lo += tile )
+                        {
+                            std::size_t const hi = std::min ( last, lo + tile );
+                            for ( std::size_t i = 0; i < n * n; i++ )
+                            {
+                                V const *from = a.lane ( i / n, i % n );
+                                std::copy ( from + lo,
+                                            from + hi,
+                                            work.data ( ) + i * tile );
+                                if ( inverting )
+                                {
+                                    V *to = b.lane ( i / n, i % n );
+                                    std::fill ( to + lo,
+                                                to + hi,
+                                                V ( i / n == i % n ) );
+                                }
+                            }
+                            found += eliminateTile ( work.data ( ), n, b, lo, hi );
+                        }
+                        singular += found;
+                    } );
+            return singular;
+        }
+    } // namespace batch
+} // namespace ml
+
+template < CONCEPT_NAMESPACE Floating X,
+           CONCEPT_NAMESPACE Floating V,
+           CONCEPT_NAMESPACE Floating W >
+void ml::gemm ( typename std::common_type< X >::type alpha,
+                Batch< V > const                     &a,
+                Batch< W > const                     &b,
+                typename std::common_type< X >::type beta,
+                Batch< X >                           &c )
+{
+    std::size_t const count = c.size ( );
+    if ( a.size ( ) != count || b.size ( ) != count
+         || a.rowCount ( ) != c.rowCount ( ) || b.rowCount ( ) != a.colCount ( )
+         || b.colCount ( ) != c.colCount ( ) )
+    {
+        throw std::out_of_range ( "Shape mismatch!" );
+    }
+    std::size_t const work = 2 * c.rowCount ( ) * c.colCount ( ) * a.colCount ( );
+    thread::parallelFor (
+            0,
+            count,
+            std::max ( batch::tile, thread::grainFor ( count, work ) ),
+            [ & ] ( std::size_t first, std::size_t last ) {
+                for ( std::size_t lo = first; lo < last; lo += batch::tile )
+                {
+                    std::size_t const hi = std::min ( last, lo + batch::tile );
+                    batch::gemmTile< X > ( alpha, a, b, beta, c, lo, hi );
+                }
+            } );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::solve ( Batch< V > const &a, Batch< V > &b )
+{
+    if ( a.colCount ( ) != a.rowCount ( ) )
+    {
+        throw std::out_of_range ( "Matrix is not square!" );
+    }
+    if ( b.size ( ) != a.size ( ) || b.rowCount ( ) != a.rowCount ( ) )
+    {
+        throw std::out_of_range ( "Shape mismatch!" );
+    }
+    return batch::eliminate ( a, b, false );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::invert ( Batch< V > const &a, Batch< V > &output )
+{
+    if ( a.colCount ( ) != a.rowCount ( ) )
+    {
+        throw std::out_of_range ( "Matrix is not square!" );
+    }
+    if ( output.size ( ) != a.size ( ) || output.rowCount ( ) != a.rowCount ( )
+         || output.colCount ( ) != a.colCount ( ) )
+    {
+        throw std::out_of_range ( "Shape mismatch!" );
+    }
+    return batch::eliminate ( a, output, true );
+}
@@ -0,0 +1,480 @@
+/**
+ * @file bigint.cc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief The slow paths of BigInt, on magnitudes of 32 bit limbs.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#include "bigint.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+    typedef std::vector< std::uint32_t > Limbs;
+
+    std::uint64_t const base = std::uint64_t ( 1 ) << 32;
+
+    void trim ( Limbs &x ) NOEXCEPT
+    {
+        while ( !x.empty ( ) && x.back ( ) == 0 )
+        {
+            x.pop_back ( );
+        }
+    }
+
+    // the number of leading zero bits.
+    int leadingZeros ( std::uint32_t x ) NOEXCEPT
+    {
+        int count = 0;
+        for ( std::uint32_t bit = 0x80000000u; bit != 0 && !( x & bit );
+              bit >>= 1 )
+        {
+            count++;
+        }
+        return count;
+    }
+
+    int compareLimbs ( Limbs const &a, Limbs const &b ) NOEXCEPT
+    {
+        if ( a.size ( ) != b.size ( ) )
+        {
+            return a.size ( ) < b.size ( ) ? -1 : 1;
+        }
+        for ( std::size_t i = a.size ( ); i-- > 0; )
+        {
+            if ( a [ i ] != b [ i ] )
+            {
+                return a [ i ] < b [ i ] ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    Limbs addLimbs ( Limbs const &a, Limbs const &b )
+    {
+        Limbs const  &longer  = a.size ( ) < b.size ( ) ? b : a;
+        Limbs const  &shorter = a.size ( ) < b.size ( ) ? a : b;
+        Limbs         output ( longer.size ( ) + 1 );
+        std::uint64_t carry = 0;
+        for ( std::size_t i = 0; i < longer.size ( ); i++ )
+        {
+            std::uint64_t const sum =
+                    std::uint64_t ( longer [ i ] )
+                    + ( i < shorter.size ( ) ? shorter [ i ] : 0 ) + carry;
+            output [ i ] = std::uint32_t ( sum );
+            carry        = sum >> 32;
+        }
+        output.back ( ) = std::uint32_t ( carry );
+        trim ( output );
+        return output;
+    }
+
+    // a - b, where a >= b.
+    Limbs subLimbs ( Limbs const &a, Limbs const &b )
+    {
+        Limbs        output ( a.size ( ) );
+        std::int64_t borrow = 0;
+        for ( std::size_t i = 0; i < a.size ( ); i++ )
+        {
+            std::int64_t const difference =
+                    std::int64_t ( a [ i ] )
+                    - ( i < b.size ( ) ? std::int64_t ( b [ i ] ) : 0 )
+                    - borrow;
+            output [ i ] = std::uint32_t ( difference );
+            borrow       = difference < 0;
+        }
+        trim ( output );
+        return output;
+    }
+
+    Limbs mulLimbs ( Limbs const &a, Limbs const &b )
+    {
+        Limbs output ( a.size ( ) + b.size ( ) );
+        for ( std::size_t i = 0; i < a.size ( ); i++ )
+        {
+            std::uint64_t carry = 0;
+            for ( std::size_t j = 0; j < b.size ( ); j++ )
+            {
+                std::uint64_t const t =
+                        std::uint64_t ( a [ i ] ) * b [ j ] + output [ i + j ]
+                        + carry;
+                output [ i + j ] = std::uint32_t ( t );
+                carry            = t >> 32;
+            }
+            output [ i + b.size ( ) ] = std::uint32_t ( carry );
+        }
+        trim ( output );
+        return output;
+    }
+
+    Limbs shiftLimbs ( Limbs const &x, std::size_t bits )
+    {
+        if ( x.empty ( ) )
+        {
+            return x;
+        }
+        std::size_t const whole = bits / 32;
+        unsigned const    part  = unsigned ( bits % 32 );
+        Limbs             output ( x.size ( ) + whole + 1 );
+        for ( std::size_t i = 0; i < x.size ( ); i++ )
+        {
+            std::uint64_t const t = std::uint64_t ( x [ i ] ) << part;
+            output [ i + whole ] |= std::uint32_t ( t );
+            output [ i + whole + 1 ] |= std::uint32_t ( t >> 32 );
+        }
+        trim ( output );
+        return output;
+    }
+
+    // x / divisor, with the remainder returned.
+    std::uint32_t divideShort ( Limbs &x, std::uint32_t divisor ) NOEXCEPT
+    {
+        std::uint64_t remainder = 0;
+        for ( std::size_t i = x.size ( ); i-- > 0; )
+        {
+            std::uint64_t const t = ( remainder << 32 ) | x [ i ];
+            x [ i ]               = std::uint32_t ( t / divisor );
+            remainder             = t % divisor;
+        }
+        trim ( x );
+        return std::uint32_t ( remainder );
+    }
+
+    // Knuth's algorithm D, for a >= b where b has at least two limbs.
+    void divideLimbs ( Limbs const &a, Limbs const &b, Limbs &q, Limbs &r )
+    {
+        std::size_t const n = b.size ( );
+        std::size_t const m = a.size ( ) - n;
+        // normalized so that the top limb of the divisor has its top bit set,
+        // which keeps each estimated quotient limb within 2 of the truth.
+        int const shift = leadingZeros ( b.back ( ) );
+        Limbs     v ( n ), u ( a.size ( ) + 1 );
+        for ( std::size_t i = n; i-- > 0; )
+        {
+            v [ i ] = std::uint32_t (
+                    ( std::uint64_t ( b [ i ] ) << shift )
+                    | ( i > 0 && shift > 0 ? b [ i - 1 ] >> ( 32 - shift ) : 0 ) );
+        }
+        u [ a.size ( ) ] =
+                shift > 0 ? a [ a.size ( ) - 1 ] >> ( 32 - shift ) : 0;
+        for ( std::size_t i = a.size ( ); i-- > 0; )
+        {
+            u [ i ] = std::uint32_t (
+                    ( std::uint64_t ( a [ i ] ) << shift )
+                    | ( i > 0 && shift > 0 ? a [ i - 1 ] >> ( 32 - shift ) : 0 ) );
+        }
+
+        q.assign ( m + 1, 0 );
+        for ( std::size_t j = m + 1; j-- > 0; )
+        {
+            std::uint64_t const top =
+                    ( std::uint64_t ( u [ j + n ] ) << 32 ) | u [ j + n - 1 ];
+            std::uint64_t estimate  = top / v [ n - 1 ];
+            std::uint64_t remainder = top % v [ n - 1 ];
+            while ( estimate >= base
+                    || estimate * v [ n - 2 ]
+                               > ( ( remainder << 32 ) | u [ j + n - 2 ] ) )
+            {
+                estimate--;
+                remainder += v [ n - 1 ];
+                if ( remainder >= base )
+                {
+                    break;
+                }
+            }
+
+            // u -= estimate * v, shifted j limbs.
+            std::int64_t  borrow = 0;
+            std::uint64_t carry  = 0;
+            for ( std::size_t i = 0; i < n; i++ )
+            {
+                std::uint64_t const p = estimate * v [ i ] + carry;
+                carry                 = p >> 32;
+                std::int64_t const t  = std::int64_t ( u [ i + j ] ) - borrow
+                                     - std::int64_t ( p & 0xffffffffu );
+                u [ i + j ] = std::uint32_t ( t );
+                borrow      = t < 0;
+            }
+            std::int64_t const t =
+                    std::int64_t ( u [ j + n ] ) - borrow - std::int64_t ( carry );
+            u [ j + n ] = std::uint32_t ( t );
+
+            // the estimate was one too large, rarely: add v back.
+            if ( t < 0 )
+            {
+                estimate--;
+                std::uint64_t back = 0;
+                for ( std::size_t i = 0; i < n; i++ )
+                {
+                    std::uint64_t const s =
+                            std::uint64_t ( u [ i + j ] ) + v [ i ] + back;
+                    u [ i + j ] = std::uint32_t ( s );
+                    back        = s >> 32;
+                }
+                u [ j + n ] += std::uint32_t ( back );
+            }
+            q [ j ] = std::uint32_t ( estimate );
+        }
+        trim ( q );
+
+        r.assign ( n, 0 );
+        for ( std::size_t i = 0; i < n; i++ )
+        {
+            r [ i ] = std::uint32_t (
+                    ( u [ i ] >> shift )
+                    | ( shift > 0 ? std::uint64_t ( u [ i + 1 ] ) << ( 32 - shift )
+                                  : 0 ) );
+        }
+        trim ( r );
+    }
+} // namespace
+
+ml::BigInt ml::BigInt::fromLimbs ( std::vector< std::uint32_t > magnitude,
+                                   bool                         isNegative )
+{
+    trim ( magnitude );
+    BigInt output;
+    if ( magnitude.size ( ) <= 2 )
+    {
+        std::uint64_t const value =
+                ( magnitude.size ( ) > 1
+                          ? std::uint64_t ( magnitude [ 1 ] ) << 32
+                          : 0 )
+                | ( magnitude.empty ( ) ? 0 : magnitude [ 0 ] );
+        if ( value <= std::uint64_t ( INT64_MAX ) )
+        {
+            output.small = isNegative ? -std::int64_t ( value )
+                                      : std::int64_t ( value );
+            return output;
+        }
+        if ( isNegative && value == std::uint64_t ( INT64_MAX ) + 1 )
+        {
+            output.small = INT64_MIN;
+            return output;
+        }
+    }
+    output.limbs    = std::move ( magnitude );
+    output.negative = isNegative;
+    return output;
+}
+
+std::vector< std::uint32_t > ml::BigInt::magnitude ( ) const
+{
+    if ( !isSmall ( ) )
+    {
+        return limbs;
+    }
+    // 0 - x in unsigned arithmetic is |x|, even for INT64_MIN.
+    std::uint64_t const value = small < 0 ? 0 - std::uint64_t ( small )
+                                          : std::uint64_t ( small );
+    Limbs output { std::uint32_t ( value ), std::uint32_t ( value >> 32 ) };
+    trim ( output );
+    return output;
+}
+
+void ml::BigInt::integer ( std::uint64_t x, bool isNegative, BigInt &out )
+{
+    out = fromLimbs ( Limbs { std::uint32_t ( x ), std::uint32_t ( x >> 32 ) },
+                      isNegative );
+}
+
+ml::BigInt::BigInt ( Double x )
+{
+    if ( !std::isfinite ( x ) )
+    {
+        throw std::domain_error ( "BigInt of infinity or NaN!" );
+    }
+    x = std::trunc ( x );
+    if ( std::abs ( x ) < 9223372036854775808.0 ) // 2^63
+    {
+        small = std::int64_t ( x );
+        return;
+    }
+    // x = mantissa * 2^( exponent - 53 ) with a 53 bit integer mantissa.
+    int                exponent = 0;
+    Double const       fraction = std::frexp ( std::abs ( x ), &exponent );
+    std::int64_t const mantissa = std::int64_t ( std::ldexp ( fraction, 53 ) );
+    *this = BigInt ( mantissa ) << std::size_t ( exponent - 53 );
+    if ( x < 0 )
+    {
+        *this = -*this;
+    }
+}
+
+std::size_t ml::BigInt::bitLength ( ) const NOEXCEPT
+{
+    if ( isSmall ( ) )
+    {
+        std::uint64_t value = small < 0 ? 0 - std::uint64_t ( small )
+                                        : std::uint64_t ( small );
+        std::size_t bits = 0;
+        for ( ; value != 0; value >>= 1 ) { bits++; }
+        return bits;
+    }
+    return 32 * limbs.size ( ) - std::size_t ( leadingZeros ( limbs.back ( ) ) );
+}
+
+ml::BigInt::operator Double ( ) const NOEXCEPT
+{
+    if ( isSmall ( ) )
+    {
+        return Double ( small );
+    }
+    // the top three limbs hold more bits than a Double.
+    std::size_t const bottom = limbs.size ( ) > 3 ? limbs.size ( ) - 3 : 0;
+    Double            value  = 0;
+    for ( std::size_t i = limbs.size ( ); i-- > bottom; )
+    {
+        value = value * Double ( base ) + limbs [ i ];
+    }
+    value = std::ldexp ( value, int ( 32 * bottom ) );
+    return negative ? -value : value;
+}
+
+std::string ml::BigInt::toString ( ) const
+{
+    if ( isSmall ( ) )
+    {
+        return std::to_string ( small );
+    }
+    // nine decimal digits at a time.
+    Limbs                        rest = limbs;
+    std::vector< std::uint32_t > chunks;
+    while ( !rest.empty ( ) )
+    {
+        chunks.push_back ( divideShort ( rest, 1000000000u ) );
+    }
+    std::string output = negative ? "-" : "";
+    output += std::to_string ( chunks.back ( ) );
+    for ( std::size_t i = chunks.size ( ) - 1; i-- > 0; )
+    {
+        std::string const digits = std::to_string ( chunks [ i ] );
+        output += std::string ( 9 - digits.size ( ), '0' ) + digits;
+    }
+    return output;
+}
+
+ml::BigInt ml::BigInt::operator- ( ) const
+{
+    if ( isSmall ( ) && small != INT64_MIN )
+    {
+        return -small;
+    }
+    return fromLimbs ( magnitude ( ), sign ( ) > 0 );
+}
+
+ml::BigInt ml::BigInt::add ( BigInt const &a, BigInt const &b, bool subtract )
+{
+    Limbs const ma = a.magnitude ( );
+    Limbs const mb = b.magnitude ( );
+    bool const  na = a.sign ( ) < 0;
+    bool const  nb = ( b.sign ( ) < 0 ) != subtract;
+    if ( na == nb )
+    {
+        return fromLimbs ( addLimbs ( ma, mb ), na );
+    }
+    return compareLimbs ( ma, mb ) >= 0 ? fromLimbs ( subLimbs ( ma, mb ), na )
+                                        : fromLimbs ( subLimbs ( mb, ma ), nb );
+}
+
+ml::BigInt ml::BigInt::multiply ( BigInt const &a, BigInt const &b )
+{
+    return fromLimbs ( mulLimbs ( a.magnitude ( ), b.magnitude ( ) ),
+                       ( a.sign ( ) < 0 ) != ( b.sign ( ) < 0 ) );
+}
+
+void ml::BigInt::divide ( BigInt const &a,
+                          BigInt const &b,
+                          BigInt       &quotient,
+                          BigInt       &remainder )
+{
+    if ( b.sign ( ) == 0 )
+    {
+        throw std::domain_error ( "Division by zero!" );
+    }
+    Limbs const ma = a.magnitude ( );
+    Limbs const mb = b.magnitude ( );
+    bool const  na = a.sign ( ) < 0;
+    bool const  nb = b.sign ( ) < 0;
+    if ( compareLimbs ( ma, mb ) < 0 )
+    {
+        remainder = a;
+        quotient  = 0;
+        return;
+    }
+    Limbs q, r;
+    if ( mb.size ( ) == 1 )
+    {
+        q = ma;
+        r = Limbs { divideShort ( q, mb [ 0 ] ) };
+    }
+    else
+    {
+        divideLimbs ( ma, mb, q, r );
+    }
+    quotient  = fromLimbs ( std::move ( q ), na != nb );
+    remainder = fromLimbs ( std::move ( r ), na );
+}
+
+ml::BigInt ml::operator<< ( BigInt const &x, std::size_t bits )
+{
+    return BigInt::fromLimbs ( shiftLimbs ( x.magnitude ( ), bits ),
+                               x.sign ( ) < 0 );
+}
+
+int ml::BigInt::compare ( BigInt const &a, BigInt const &b ) NOEXCEPT
+{
+    if ( a.isSmall ( ) && b.isSmall ( ) )
+    {
+        return ( a.small > b.small ) - ( a.small < b.small );
+    }
+    int const sa = a.sign ( );
+    int const sb = b.sign ( );
+    if ( sa != sb )
+    {
+        return sa < sb ? -1 : 1;
+    }
+    // a big value is always larger in magnitude than a small one.
+    int const order = a.isSmall ( )   ? -1
+                    : b.isSmall ( ) ? 1
+                                    : compareLimbs ( a.limbs, b.limbs );
+    return sa < 0 ? -order : order;
+}
+
+ml::BigInt ml::gcd ( BigInt a, BigInt b )
+{
+    a = abs ( a );
+    b = abs ( b );
+    while ( b.sign ( ) != 0 )
+    {
+        if ( a.isSmall ( ) && b.isSmall ( ) )
+        {
+            // Euclid on machine words for the rest of the way.
+            std::int64_t x = a.small, y = b.small;
+            while ( y != 0 )
+            {
+                std::int64_t const r = x % y;
+                x                    = y;
+                y                    = r;
+            }
+            return x;
+        }
+        BigInt remainder = a % b;
+        a                = std::move ( b );
+        b                = std::move ( remainder );
+    }
+    return a;
+}
+
+std::ostream &ml::operator<< ( std::ostream &out, BigInt const &x )
+{
+    return out << x.toString ( );
+}
@@ -0,0 +1,331 @@
+/**
+ * @file bigint.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Integers of any size, for exact arithmetic.
+ * @details Values that fit in 64 bits are kept in one std::int64_t and
+ * added, subtracted and multiplied with a single overflow-checked machine
+ * instruction. Only when a result overflows does it move to a vector of
+ * 32 bit limbs, and results that fit again move back. In exact elimination
+ * most of the numbers stay small, so most of the work stays on the fast
+ * path.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "meta.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ml
+{
+    namespace big
+    {
+        // s = a + b, unless that overflows, in which case this returns true.
+        inline bool addOverflows ( std::int64_t a, std::int64_t b,
+                                   std::int64_t &s ) NOEXCEPT
+        {
+#if defined( __GNUC__ ) || defined( __clang__ )
+            return __builtin_add_overflow ( a, b, &s );
+#else
+            if ( ( b > 0 && a > INT64_MAX - b )
+                 || ( b < 0 && a < INT64_MIN - b ) )
+            {
+                return true;
+            }
+            s = a + b;
+            return false;
+#endif
+        }
+
+        // s = a - b, unless that overflows, in which case this returns true.
+        inline bool subOverflows ( std::int64_t a, std::int64_t b,
+                                   std::int64_t &s ) NOEXCEPT
+        {
+#if defined( __GNUC__ ) || defined( __clang__ )
+            return __builtin_sub_overflow ( a, b, &s );
+#else
+            if ( ( b < 0 && a > INT64_MAX + b )
+                 || ( b > 0 && a < INT64_MIN + b ) )
+            {
+                return true;
+            }
+            s = a - b;
+            return false;
+#endif
+        }
+
+        // p = a * b, unless that overflows, in which case this returns true.
+        inline bool mulOverflows ( std::int64_t a, std::int64_t b,
+                                   std::int64_t &p ) NOEXCEPT
+        {
+#if defined( __GNUC__ ) || defined( __clang__ )
+            return __builtin_mul_overflow ( a, b, &p );
+#else
+            if ( a != 0 && b != 0 )
+            {
+                if ( ( a == -1 && b == INT64_MIN )
+                     || ( b == -1 && a == INT64_MIN ) )
+                {
+                    return true;
+                }
+                if ( a != -1 && b != -1
+                     && ( a > 0 ? ( b > 0 ? a > INT64_MAX / b
+                                          : b < INT64_MIN / a )
+                                : ( b > 0 ? a < INT64_MIN / b
+                                          : a < INT64_MAX / b ) ) )
+                {
+                    return true;
+                }
+            }
+            p = a * b;
+            return false;
+#endif
+        }
+    } // namespace big
+
+    /**
+     * @brief A signed integer with as many bits as it needs. Works as a
+     * Matrix element for exact products and for determinant; echelon and
+     * inverse need division, so they take a Matrix< Rational > instead.
+     * @note Division truncates toward zero, as it does for built in
+     * integers, and dividing by zero throws std::domain_error.
+     */
+    class BigInt
+    {
+        // the value, while limbs is empty.
+        std::int64_t small = 0;
+        // otherwise the magnitude, least significant limb first and with no
+        // leading zero limbs, and its sign.
+        std::vector< std::uint32_t > limbs;
+        bool                         negative = false;
+
+        // the value with magnitude limbs, normalized.
+        static BigInt fromLimbs ( std::vector< std::uint32_t > magnitude,
+                                  bool                         isNegative );
+        std::vector< std::uint32_t > magnitude ( ) const;
+
+        static BigInt add ( BigInt const &a, BigInt const &b, bool subtract );
+        static BigInt multiply ( BigInt const &a, BigInt const &b );
+        static void   integer ( std::uint64_t x, bool isNegative, BigInt &out );
+    public:
+        BigInt ( ) = default;
+
+        template < class I,
+                   class = typename std::enable_if<
+                           std::is_integral< I >::value >::type >
+        BigInt ( I x )
+        {
+            if ( std::is_signed< I >::value
+                 || std::uint64_t ( x ) <= std::uint64_t ( INT64_MAX ) )
+            {
+                small = std::int64_t ( x );
+            }
+            else
+            {
+                integer ( std::uint64_t ( x ), false, *this );
+            }
+        }
+
+        // x rounded toward zero. Throws std::domain_error if x is infinite
+        // or NaN.
+        explicit BigInt ( Double x );
+
+        // whether the value is held in 64 bits, and the fast paths apply.
+        bool isSmall ( ) const NOEXCEPT { return limbs.empty ( ); }
+
+        // the value, when isSmall.
+        std::int64_t smallValue ( ) const NOEXCEPT { return small; }
+
+        // -1, 0, or 1.
+        int sign ( ) const NOEXCEPT
+        {
+            return isSmall ( ) ? ( small > 0 ) - ( small < 0 )
+                               : ( negative ? -1 : 1 );
+        }
+
+        // the number of bits in the magnitude, zero for zero.
+        std::size_t bitLength ( ) const NOEXCEPT;
+
+        // the nearest Double, or infinity past its range.
+        explicit operator Double ( ) const NOEXCEPT;
+
+        // in base 10, with a leading - if negative.
+        std::string toString ( ) const;
+
+        BigInt operator- ( ) const;
+        BigInt operator+ ( ) const { return *this; }
+
+        friend BigInt operator+ ( BigInt const &a, BigInt const &b )
+        {
+            std::int64_t s;
+            if ( a.isSmall ( ) && b.isSmall ( )
+                 && !big::addOverflows ( a.small, b.small, s ) )
+            {
+                return s;
+            }
+            return add ( a, b, false );
+        }
+
+        friend BigInt operator- ( BigInt const &a, BigInt const &b )
+        {
+            std::int64_t s;
+            if ( a.isSmall ( ) && b.isSmall ( )
+                 && !big::subOverflows ( a.small, b.small, s ) )
+            {
+                return s;
+            }
+            return add ( a, b, true );
+        }
+
+        friend BigInt operator* ( BigInt const &a, BigInt const &b )
+        {
+            std::int64_t p;
+            if ( a.isSmall ( ) && b.isSmall ( )
+                 && !big::mulOverflows ( a.small, b.small, p ) )
+            {
+                return p;
+            }
+            return multiply ( a, b );
+        }
+
+        /**
+         * @brief quotient = a / b rounded toward zero, and remainder = a -
+         * quotient * b, which has the sign of a.
+         * @throws std::domain_error if b is zero.
+         */
+        static void divide ( BigInt const &a,
+                             BigInt const &b,
+                             BigInt       &quotient,
+                             BigInt       &remainder );
+
+        friend BigInt operator/ ( BigInt const &a, BigInt const &b )
+        {
+            // INT64_MIN / -1 is the one quotient of smalls that overflows.
+            if ( a.isSmall ( ) && b.isSmall ( ) && b.small != 0
+                 && !( b.small == -1 && a.small == INT64_MIN ) )
+            {
+                return a.small / b.small;
+            }
+            BigInt q, r;
+            divide ( a, b, q, r );
+            return q;
+        }
+
+        friend BigInt operator% ( BigInt const &a, BigInt const &b )
+        {
+            if ( a.isSmall ( ) && b.isSmall ( ) && b.small != 0
+                 && b.small != -1 )
+            {
+                return a.small % b.small;
+            }
+            BigInt q, r;
+            divide ( a, b, q, r );
+            return r;
+        }
+
+        // x * 2^bits.
+        friend BigInt operator<< ( BigInt const &x, std::size_t bits );
+
+        // the greatest common divisor of |a| and |b|, zero if both are zero.
+        friend BigInt gcd ( BigInt a, BigInt b );
+
+        BigInt &operator+= ( BigInt const &that )
+        {
+            return *this = *this + that;
+        }
+        BigInt &operator-= ( BigInt const &that )
+        {
+            return *this = *this - that;
+        }
+        BigInt &operator*= ( BigInt const &that )
+        {
+            return *this = *this * that;
+        }
+        BigInt &operator/= ( BigInt const &that )
+        {
+            return *this = *this / that;
+        }
+        BigInt &operator%= ( BigInt const &that )
+        {
+            return *this = *this % that;
+        }
+
+        // -1, 0, or 1 as a is less than, equal to, or greater than b.
+        static int compare ( BigInt const &a, BigInt const &b ) NOEXCEPT;
+
+        friend bool operator== ( BigInt const &a, BigInt const &b ) NOEXCEPT
+        {
+            return a.isSmall ( ) && b.isSmall ( ) ? a.small == b.small
+                                                  : compare ( a, b ) == 0;
+        }
+        friend bool operator!= ( BigInt const &a, BigInt const &b ) NOEXCEPT
+        {
+            return !( a == b );
+        }
+        friend bool operator< ( BigInt const &a, BigInt const &b ) NOEXCEPT
+        {
+            return a.isSmall ( ) && b.isSmall ( ) ? a.small < b.small
+                                                  : compare ( a, b ) < 0;
+        }
+        friend bool operator> ( BigInt const &a, BigInt const &b ) NOEXCEPT
+        {
+            return b < a;
+        }
+        friend bool operator<= ( BigInt const &a, BigInt const &b ) NOEXCEPT
+        {
+            return !( b < a );
+        }
+        friend bool operator>= ( BigInt const &a, BigInt const &b ) NOEXCEPT
+        {
+            return !( a < b );
+        }
+    };
+
+    inline BigInt abs ( BigInt const &x ) { return x.sign ( ) < 0 ? -x : x; }
+
+    BigInt operator<< ( BigInt const &x, std::size_t bits );
+    BigInt gcd ( BigInt a, BigInt b );
+
+    std::ostream &operator<< ( std::ostream &out, BigInt const &x );
+
+    template <> struct IsFloating< BigInt > : std::true_type
+    {
+    };
+
+    template < class S > struct IsScalar;
+    template <> struct IsScalar< BigInt > : std::true_type
+    {
+    };
+} // namespace ml
+
+namespace std
+{
+    template <> class numeric_limits< ml::BigInt >
+    {
+    public:
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed      = true;
+        static constexpr bool is_integer     = true;
+        static constexpr bool is_exact       = true;
+        static constexpr bool is_bounded     = false;
+        static constexpr bool has_infinity   = false;
+        static constexpr bool has_quiet_NaN  = false;
+        static constexpr int  radix          = 2;
+
+        static ml::BigInt epsilon ( ) { return 0; }
+        static ml::BigInt min ( ) { return 0; }
+        static ml::BigInt max ( ) { return 0; }
+        static ml::BigInt lowest ( ) { return 0; }
+    };
+} // namespace std
@@ -0,0 +1,82 @@
+/**
+ * @file cholesky.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Cholesky factorization of symmetric positive definite matrices.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "matrix.hh"
+
+#include <cstddef>
+#include <vector>
+
+namespace ml
+{
+    /**
+     * @brief The factorization A = L * transpose ( L ) of a symmetric
+     * positive definite matrix A, where L is lower triangular with a
+     * positive diagonal. Covariance matrices and the normal equations of a
+     * least squares fit are of this kind.
+     * @details Symmetry means there is nothing to pivot and only half of
+     * the matrix to update, so factoring takes about n^3 / 3 flops against
+     * the 2 n^3 / 3 of LU. Columns are factored in panels, and the lower
+     * half of the rest of the matrix is updated one block column at a time
+     * with the blocked, threaded GEMM.
+     * @note Only the lower triangle of A is read; the upper triangle is
+     * taken to mirror it.
+     * @note Pass the matrix with std::move to factor it in place without
+     * making a copy.
+     * @note A matrix that is not positive definite (some leading minor is
+     * not positive) stops the factorization at that minor. Solving with,
+     * inverting, or taking the determinant of such a factorization throws
+     * std::runtime_error.
+     */
+    template < CONCEPT_NAMESPACE Floating V > class Cholesky
+    {
+        Matrix< V >  factors;
+        std::size_t failed = 0;
+
+        void factor ( );
+    public:
+        // throws std::out_of_range if the matrix is not square.
+        explicit Cholesky ( Matrix< V > matrix );
+
+        std::size_t size ( ) const NOEXCEPT;
+
+        bool isPositiveDefinite ( ) const NOEXCEPT;
+
+        /**
+         * @brief The order k of the first leading k x k minor of A that is
+         * not positive, or 0 if A is positive definite.
+         */
+        std::size_t failedMinor ( ) const NOEXCEPT;
+
+        // L, with zeros above its diagonal.
+        Matrix< V > lower ( ) const;
+
+        V determinant ( ) const;
+
+        // x such that A * x = b.
+        template < CONCEPT_NAMESPACE Floating W = V,
+                   CONCEPT_NAMESPACE Floating X = decltype ( V { 0 }
+                                                             + W { 0 } ) >
+        std::vector< X > solve ( std::vector< W > const &b ) const;
+
+        // X such that A * X = B, for all columns of B at once, with the
+        // blocked triangular solves of kernel::trsm.
+        template < CONCEPT_NAMESPACE Floating W = V,
+                   CONCEPT_NAMESPACE Floating X = decltype ( V { 0 }
+                                                             + W { 0 } ) >
+        Matrix< X > solve ( Matrix< W > const &b ) const;
+
+        Matrix< V > inverse ( ) const;
+    };
+} // namespace ml
+
+#include "cholesky.tcc"
@@ -0,0 +1,254 @@
+/**
+ * @file cholesky.tcc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief This C++ file is meant to be included only in cholesky.hh
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Cholesky< V >::Cholesky ( Matrix< V > matrix ) :
+    factors ( std::move ( matrix ) )
+{
+    if ( factors.rowCount ( ) != factors.colCount ( ) )
+    {
+        throw std::out_of_range ( "Matrix is not square!" );
+    }
+    factor ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V > void ml::Cholesky< V >::factor ( )
+{
+    using std::sqrt;
+    std::size_t const n  = size ( );
+    std::size_t const ld = factors.leadingDimension ( );
+    V *const          a  = factors.data ( );
+
+    // the same panel width as LU, for the same reasons.
+    std::size_t const block = 64;
+    for ( std::size_t k0 = 0; k0 < n; k0 += block )
+    {
+        std::size_t const k1 = std::min ( n, k0 + block );
+        // factor the diagonal block, which earlier panels have already
+        // updated, one column at a time.
+        for ( std::size_t j = k0; j < k1; j++ )
+        {
+            V const *rj = a + j * ld;
+            V        d  = rj [ j ];
+            for ( std::size_t p = k0; p < j; p++ ) { d -= rj [ p ] * rj [ p ]; }
+            // written so that NaN fails as well.
+            if ( !( d > V { 0 } ) )
+            {
+                failed = j + 1;
+                return;
+            }
+            a [ j * ld + j ] = sqrt ( d );
+            for ( std::size_t i = j + 1; i < k1; i++ )
+            {
+                V *ri = a + i * ld;
+                V  t  = ri [ j ];
+                for ( std::size_t p = k0; p < j; p++ ) { t -= ri [ p ] * rj [ p ]; }
+                ri [ j ] = t / rj [ j ];
+            }
+        }
+        if ( k1 == n )
+        {
+            break;
+        }
+        // the panel below it: L21 = A21 * inverse ( transpose ( L11 ) ). That
+        // is L11 * transpose ( L21 ) = transpose ( A21 ), which is solved on a
+        // transposed copy so that its rows are contiguous.
+        std::size_t const width = k1 - k0;
+        std::size_t const rest  = n - k1;
+        Matrix< V >       panel { width, rest };
+        std::size_t const ldp = panel.leadingDimension ( );
+        for ( std::size_t i = 0; i < rest; i++ )
+        {
+            for ( std::size_t j = 0; j < width; j++ )
+            {
+                panel.data ( ) [ j * ldp + i ] = a [ ( k1 + i ) * ld + k0 + j ];
+            }
+        }
+        kernel::trsm ( kernel::Triangle::Lower,
+                       kernel::Diagonal::General,
+                       width,
+                       rest,
+                       a + k0 * ld + k0,
+                       ld,
+                       std::size_t { 1 },
+                       panel.data ( ),
+                       ldp );
+        for ( std::size_t i = 0; i < rest; i++ )
+        {
+            for ( std::size_t j = 0; j < width; j++ )
+            {
+                a [ ( k1 + i ) * ld + k0 + j ] = panel.data ( ) [ j * ldp + i ];
+            }
+        }
+        // and the lower half of the rest of the matrix:
+        // A22 = A22 - L21 * transpose ( L21 ), one block column at a time so
+        // that next to nothing above the diagonal is computed.
+        for ( std::size_t j0 = k1; j0 < n; j0 += block )
+        {
+            std::size_t const j1 = std::min ( n, j0 + block );
+            kernel::gemm ( n - j0,
+                           j1 - j0,
+                           k1 - k0,
+                           V { -1 },
+                           a + j0 * ld + k0,
+                           ld,
+                           std::size_t { 1 },
+                           a + j0 * ld + k0,
+                           std::size_t { 1 },
+                           ld,
+                           V { 1 },
+                           a + j0 * ld + j0,
+                           ld );
+        }
+    }
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::Cholesky< V >::size ( ) const noexcept
+{
+    return factors.rowCount ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+bool ml::Cholesky< V >::isPositiveDefinite ( ) const noexcept
+{
+    return failed == 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::Cholesky< V >::failedMinor ( ) const noexcept
+{
+    return failed;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > ml::Cholesky< V >::lower ( ) const
+{
+    Matrix< V > output { size ( ), size ( ) };
+    for ( std::size_t i = 0; i < size ( ); i++ )
+    {
+        V const *row = factors.data ( ) + i * factors.leadingDimension ( );
+        V       *out = output.data ( ) + i * output.leadingDimension ( );
+        std::copy ( row, row + i + 1, out );
+    }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+V ml::Cholesky< V >::determinant ( ) const
+{
+    if ( failed != 0 )
+    {
+        throw std::runtime_error ( "Matrix is not positive definite!" );
+    }
+    V output = V { 1 };
+    for ( std::size_t i = 0; i < size ( ); i++ )
+    {
+        V const d = factors.data ( ) [ i * factors.leadingDimension ( ) + i ];
+        output *= d * d;
+    }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+template < CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X >
+std::vector< X > ml::Cholesky< V >::solve ( std::vector< W > const &b ) const
+{
+    if ( b.size ( ) != size ( ) )
+    {
+        throw std::out_of_range ( "Vector length mismatch!" );
+    }
+    if ( failed != 0 )
+    {
+        throw std::runtime_error ( "Matrix is not positive definite!" );
+    }
+    std::size_t const n  = size ( );
+    std::size_t const ld = factors.leadingDimension ( );
+    V const *const    a  = factors.data ( );
+    std::vector< X >  x ( b.begin ( ), b.end ( ) );
+    // L y = b, then transpose ( L ) x = y, which is L with its strides
+    // swapped.
+    kernel::trsv ( kernel::Triangle::Lower,
+                   kernel::Diagonal::General,
+                   n,
+                   a,
+                   ld,
+                   std::size_t { 1 },
+                   x.data ( ) );
+    kernel::trsv ( kernel::Triangle::Upper,
+                   kernel::Diagonal::General,
+                   n,
+                   a,
+                   std::size_t { 1 },
+                   ld,
+                   x.data ( ) );
+    return x;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+template < CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X >
+ml::Matrix< X > ml::Cholesky< V >::solve ( Matrix< W > const &b ) const
+{
+    if ( b.rowCount ( ) != size ( ) )
+    {
+        throw std::out_of_range ( "Row count mismatch!" );
+    }
+    if ( failed != 0 )
+    {
+        throw std::runtime_error ( "Matrix is not positive definite!" );
+    }
+    std::size_t const n  = size ( );
+    std::size_t const m  = b.colCount ( );
+    std::size_t const ld = factors.leadingDimension ( );
+    V const *const    a  = factors.data ( );
+    Matrix< X >       x { n, m };
+    std::size_t const ldx = x.leadingDimension ( );
+    X *const          out = x.data ( );
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        W const *row = b.data ( ) + i * b.leadingDimension ( );
+        std::copy ( row, row + m, out + i * ldx );
+    }
+    kernel::trsm ( kernel::Triangle::Lower,
+                   kernel::Diagonal::General,
+                   n,
+                   m,
+                   a,
+                   ld,
+                   std::size_t { 1 },
+                   out,
+                   ldx );
+    kernel::trsm ( kernel::Triangle::Upper,
+                   kernel::Diagonal::General,
+                   n,
+                   m,
+                   a,
+                   std::size_t { 1 },
+                   ld,
+                   out,
+                   ldx );
+    return x;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > ml::Cholesky< V >::inverse ( ) const
+{
+    if ( failed != 0 )
+    {
+        throw std::runtime_error ( "No inverse!" );
+    }
+    return solve ( Matrix< V >::identity ( size ( ) ) );
+}
@@ -0,0 +1,66 @@
+/**
+ * @file doubledouble.cc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Writing DoubleDoubles to streams.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#include "doubledouble.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <ios>
+#include <ostream>
+#include <sstream>
+#include <string>
+
+std::ostream &ml::operator<< ( std::ostream &out, DoubleDouble x )
+{
+    std::streamsize const digits = out.precision ( );
+    if ( digits <= 17 || !std::isfinite ( x.high ( ) ) || x.high ( ) == 0 )
+    {
+        return out << Double ( x );
+    }
+
+    // x = r * 10^exponent with 1 <= r < 10, then one digit at a time.
+    std::string  text     = x.high ( ) < 0 ? "-" : "";
+    DoubleDouble r        = abs ( x );
+    int          exponent = int ( std::floor ( std::log10 ( r.high ( ) ) ) );
+    DoubleDouble power    = 1;
+    for ( int i = 0; i < std::abs ( exponent ); i++ ) { power *= 10; }
+    r = exponent < 0 ? r * power : r / power;
+    if ( r.high ( ) >= 10 )
+    {
+        r /= 10;
+        exponent++;
+    }
+    else if ( r.high ( ) < 1 )
+    {
+        r *= 10;
+        exponent--;
+    }
+    for ( std::streamsize i = 0; i < digits; i++ )
+    {
+        // the high part may have rounded up past the next integer.
+        int digit = int ( r.high ( ) );
+        if ( ( r - digit ).high ( ) < 0 )
+        {
+            digit--;
+        }
+        digit = std::min ( 9, std::max ( 0, digit ) );
+        text += char ( '0' + digit );
+        if ( i == 0 )
+        {
+            text += '.';
+        }
+        r = ( r - digit ) * 10;
+    }
+    std::ostringstream tail;
+    tail << ( exponent < 0 ? "e-" : "e+" )
+         << ( std::abs ( exponent ) < 10 ? "0" : "" ) << std::abs ( exponent );
+    return out << text << tail.str ( );
+}
@@ -0,0 +1,374 @@
+/**
+ * @file doubledouble.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief A number kept as the unevaluated sum of two Doubles, for about 106
+ * bits of precision.
+ * @details Every operation is built from error-free transformations: the
+ * rounding error of a Double sum or product is itself a Double, found
+ * exactly with a few more Double operations, and carried in the low part.
+ * That costs a small multiple of Double arithmetic, all of it in the
+ * ordinary floating point unit (and vector units, in the kernels), where
+ * Triple is usually the scalar-only x87 unit or done in software and may
+ * have no more precision than Double at all.
+ * @note The range is that of Double, and the low part of values below about
+ * 1e-292 loses precision as it goes subnormal. Infinities and NaN are kept
+ * in the high part but are not otherwise treated specially.
+ * @note The error-free transformations depend on every operation rounding
+ * as written: do not compile with -ffast-math, -ffp-contract=fast, or
+ * anything else that lets the compiler reassociate or fuse floating point.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "meta.hh"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+namespace ml
+{
+    namespace dd
+    {
+        // s + e == a + b exactly, where s is a + b rounded.
+        inline Double twoSum ( Double a, Double b, Double &e ) NOEXCEPT
+        {
+            Double const s = a + b;
+            Double const z = s - a;
+            e              = ( a - ( s - z ) ) + ( b - z );
+            return s;
+        }
+
+        // the same as twoSum, given that |a| >= |b| or a is zero.
+        inline Double fastTwoSum ( Double a, Double b, Double &e ) NOEXCEPT
+        {
+            Double const s = a + b;
+            e              = b - ( s - a );
+            return s;
+        }
+
+        // p + e == a * b exactly, where p is a * b rounded. With a fast fused
+        // multiply-add the error is one instruction; otherwise both factors
+        // are split in halves whose products are exact (Dekker).
+        inline Double twoProduct ( Double a, Double b, Double &e ) NOEXCEPT
+        {
+            Double const p = a * b;
+#if defined( FP_FAST_FMA )
+            e = std::fma ( a, b, -p );
+#else
+            Double const split = 134217729.0; // 2^27 + 1
+            Double const ca    = split * a;
+            Double const ah    = ca - ( ca - a );
+            Double const al    = a - ah;
+            Double const cb    = split * b;
+            Double const bh    = cb - ( cb - b );
+            Double const bl    = b - bh;
+            e = ( ( ah * bh - p ) + ah * bl + al * bh ) + al * bl;
+#endif
+            return p;
+        }
+    } // namespace dd
+
+    /**
+     * @brief A floating point number with about 32 significant decimal
+     * digits, as the sum high ( ) + low ( ) of two Doubles where low ( ) is
+     * at most half an ulp of high ( ). Works as a Matrix element: the GEMM,
+     * GEMV and AXPY kernels have vectorized versions that carry the low
+     * parts in separate registers, so factorizations and solves run through
+     * them.
+     */
+    class DoubleDouble
+    {
+        Double hi;
+        Double lo;
+    public:
+        constexpr DoubleDouble ( ) NOEXCEPT : hi ( 0 ), lo ( 0 ) { }
+
+        // exactly x. Not explicit, so that Doubles mix in as they would with
+        // a built in type.
+        constexpr DoubleDouble ( Double x ) NOEXCEPT : hi ( x ), lo ( 0 ) { }
+
+        // the unevaluated sum high + low, which must already be normalized:
+        // |low| at most half an ulp of high. dd::twoSum makes such a pair.
+        constexpr DoubleDouble ( Double high, Double low ) NOEXCEPT :
+            hi ( high ),
+            lo ( low )
+        {
+        }
+
+        // integers up to 64 bits are exact.
+        template < class I,
+                   class = typename std::enable_if<
+                           std::is_integral< I >::value >::type >
+        DoubleDouble ( I x ) NOEXCEPT : hi ( 0 ), lo ( 0 )
+        {
+            // each half has at most 32 significant bits, so converts exactly.
+            I const rest = I ( x % I ( 1LL << ( sizeof ( I ) > 4 ? 32 : 0 ) ) );
+            hi           = dd::twoSum ( Double ( x - rest ), Double ( rest ), lo );
+        }
+
+        // x to the nearest DoubleDouble, exactly when Triple has no more
+        // than 106 bits.
+        explicit DoubleDouble ( Triple x ) NOEXCEPT :
+            hi ( Double ( x ) ),
+            lo ( Double ( x - Triple ( Double ( x ) ) ) )
+        {
+        }
+
+        constexpr Double high ( ) const NOEXCEPT { return hi; }
+        constexpr Double low ( ) const NOEXCEPT { return lo; }
+
+        // rounds to the (usually less precise) built in type.
+        template < class T,
+                   class = typename std::enable_if<
+                           std::is_arithmetic< T >::value >::type >
+        explicit operator T ( ) const NOEXCEPT
+        {
+            return T ( Triple ( hi ) + Triple ( lo ) );
+        }
+
+        constexpr DoubleDouble operator- ( ) const NOEXCEPT
+        {
+            return { -hi, -lo };
+        }
+        constexpr DoubleDouble operator+ ( ) const NOEXCEPT { return *this; }
+
+        friend DoubleDouble operator+ ( DoubleDouble a, DoubleDouble b ) NOEXCEPT
+        {
+            // both parts are summed exactly so that cancellation in the high
+            // parts keeps the low ones.
+            Double e = 0, f = 0;
+            Double s = dd::twoSum ( a.hi, b.hi, e );
+            Double t = dd::twoSum ( a.lo, b.lo, f );
+            e += t;
+            s = dd::fastTwoSum ( s, e, e );
+            e += f;
+            s = dd::fastTwoSum ( s, e, e );
+            return { s, e };
+        }
+
+        friend DoubleDouble operator+ ( DoubleDouble a, Double b ) NOEXCEPT
+        {
+            Double       e = 0;
+            Double const s = dd::twoSum ( a.hi, b, e );
+            e += a.lo;
+            Double const r = dd::fastTwoSum ( s, e, e );
+            return { r, e };
+        }
+
+        friend DoubleDouble operator+ ( Double a, DoubleDouble b ) NOEXCEPT
+        {
+            return b + a;
+        }
+
+        friend DoubleDouble operator- ( DoubleDouble a, DoubleDouble b ) NOEXCEPT
+        {
+            return a + -b;
+        }
+
+        friend DoubleDouble operator- ( DoubleDouble a, Double b ) NOEXCEPT
+        {
+            return a + -b;
+        }
+
+        friend DoubleDouble operator- ( Double a, DoubleDouble b ) NOEXCEPT
+        {
+            return -b + a;
+        }
+
+        friend DoubleDouble operator* ( DoubleDouble a, DoubleDouble b ) NOEXCEPT
+        {
+            Double       e = 0;
+            Double const p = dd::twoProduct ( a.hi, b.hi, e );
+            e += a.hi * b.lo + a.lo * b.hi;
+            Double const r = dd::fastTwoSum ( p, e, e );
+            return { r, e };
+        }
+
+        friend DoubleDouble operator* ( DoubleDouble a, Double b ) NOEXCEPT
+        {
+            Double       e = 0;
+            Double const p = dd::twoProduct ( a.hi, b, e );
+            e += a.lo * b;
+            Double const r = dd::fastTwoSum ( p, e, e );
+            return { r, e };
+        }
+
+        friend DoubleDouble operator* ( Double a, DoubleDouble b ) NOEXCEPT
+        {
+            return b * a;
+        }
+
+        friend DoubleDouble operator/ ( DoubleDouble a, DoubleDouble b ) NOEXCEPT
+        {
+            // long division by the high part of b, one Double of quotient at
+            // a time, with the remainder kept exactly.
+            Double const       q1 = a.hi / b.hi;
+            DoubleDouble const r1 = a - b * q1;
+            Double const       q2 = r1.hi / b.hi;
+            DoubleDouble const r2 = r1 - b * q2;
+            Double const       q3 = r2.hi / b.hi;
+            Double             e  = 0;
+            Double const       q  = dd::fastTwoSum ( q1, q2, e );
+            return DoubleDouble { q, e } + q3;
+        }
+
+        friend DoubleDouble operator/ ( DoubleDouble a, Double b ) NOEXCEPT
+        {
+            return a / DoubleDouble { b };
+        }
+
+        friend DoubleDouble operator/ ( Double a, DoubleDouble b ) NOEXCEPT
+        {
+            return DoubleDouble { a } / b;
+        }
+
+        template < class T > DoubleDouble &operator+= ( T const &that ) NOEXCEPT
+        {
+            return *this = *this + that;
+        }
+
+        template < class T > DoubleDouble &operator-= ( T const &that ) NOEXCEPT
+        {
+            return *this = *this - that;
+        }
+
+        template < class T > DoubleDouble &operator*= ( T const &that ) NOEXCEPT
+        {
+            return *this = *this * that;
+        }
+
+        template < class T > DoubleDouble &operator/= ( T const &that ) NOEXCEPT
+        {
+            return *this = *this / that;
+        }
+
+        friend bool operator== ( DoubleDouble a, DoubleDouble b ) NOEXCEPT
+        {
+            return a.hi == b.hi && a.lo == b.lo;
+        }
+
+        friend bool operator!= ( DoubleDouble a, DoubleDouble b ) NOEXCEPT
+        {
+            return !( a == b );
+        }
+
+        friend bool operator< ( DoubleDouble a, DoubleDouble b ) NOEXCEPT
+        {
+            return a.hi < b.hi || ( a.hi == b.hi && a.lo < b.lo );
+        }
+
+        friend bool operator> ( DoubleDouble a, DoubleDouble b ) NOEXCEPT
+        {
+            return b < a;
+        }
+
+        friend bool operator<= ( DoubleDouble a, DoubleDouble b ) NOEXCEPT
+        {
+            return a.hi < b.hi || ( a.hi == b.hi && a.lo <= b.lo );
+        }
+
+        friend bool operator>= ( DoubleDouble a, DoubleDouble b ) NOEXCEPT
+        {
+            return b <= a;
+        }
+    };
+
+    inline DoubleDouble abs ( DoubleDouble x ) NOEXCEPT
+    {
+        return x.high ( ) < 0 || ( x.high ( ) == 0 && x.low ( ) < 0 ) ? -x : x;
+    }
+
+    // one Newton step from the Double square root doubles its precision.
+    inline DoubleDouble sqrt ( DoubleDouble x ) NOEXCEPT
+    {
+        if ( !( x.high ( ) > 0 ) )
+        {
+            return x.high ( ) == 0 ? DoubleDouble { }
+                                   : DoubleDouble { std::sqrt ( x.high ( ) ) };
+        }
+        if ( x.high ( ) == std::numeric_limits< Double >::infinity ( ) )
+        {
+            return x;
+        }
+        Double const root = std::sqrt ( x.high ( ) );
+        Double       e    = 0;
+        Double const p    = dd::twoProduct ( root, root, e );
+        DoubleDouble const rest = x - DoubleDouble { p, e };
+        Double const       step = rest.high ( ) / ( 2 * root );
+        Double const       r    = dd::fastTwoSum ( root, step, e );
+        return { r, e };
+    }
+
+    /**
+     * @brief Writes x with the precision of the stream. Up to 17 digits that
+     * is the nearest Double, written as the stream would; beyond that,
+     * digits are peeled off one at a time in scientific notation.
+     */
+    std::ostream &operator<< ( std::ostream &out, DoubleDouble x );
+
+    template <> struct IsFloating< DoubleDouble > : std::true_type
+    {
+    };
+
+    template < class S > struct IsScalar;
+    template <> struct IsScalar< DoubleDouble > : std::true_type
+    {
+    };
+} // namespace ml
+
+namespace std
+{
+    template <> class numeric_limits< ml::DoubleDouble >
+    {
+        typedef ml::DoubleDouble DD;
+        typedef Double           D;
+    public:
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed      = true;
+        static constexpr bool is_integer     = false;
+        static constexpr bool is_exact       = false;
+        static constexpr bool has_infinity   = true;
+        static constexpr bool has_quiet_NaN  = true;
+        static constexpr int  digits         = 2 * numeric_limits< D >::digits;
+        static constexpr int  digits10       = 31;
+        static constexpr int  max_digits10   = 33;
+        static constexpr int  radix          = 2;
+        static constexpr int  min_exponent   = numeric_limits< D >::min_exponent
+                                          + numeric_limits< D >::digits;
+        static constexpr int max_exponent = numeric_limits< D >::max_exponent;
+
+        // 2^-104, the spacing after 1.
+        static constexpr DD epsilon ( ) NOEXCEPT
+        {
+            return DD { 4.93038065763132e-32 };
+        }
+        // the smallest value whose low part is still fully normal.
+        static constexpr DD min ( ) NOEXCEPT
+        {
+            return DD { 2.0041683600089728e-292 };
+        }
+        static constexpr DD max ( ) NOEXCEPT
+        {
+            return DD { numeric_limits< D >::max ( ),
+                        numeric_limits< D >::max ( ) * 1.1102230246251565e-16
+                                * 0.5 };
+        }
+        static constexpr DD lowest ( ) NOEXCEPT { return -max ( ); }
+        static constexpr DD infinity ( ) NOEXCEPT
+        {
+            return DD { numeric_limits< D >::infinity ( ) };
+        }
+        static constexpr DD quiet_NaN ( ) NOEXCEPT
+        {
+            return DD { numeric_limits< D >::quiet_NaN ( ) };
+        }
+    };
+} // namespace std
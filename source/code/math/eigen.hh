@@ -0,0 +1,87 @@
+/**
+ * @file eigen.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Eigendecomposition of symmetric matrices and the singular value
+ * decomposition.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "matrix.hh"
+#include "qr.hh"
+
+#include <cstddef>
+#include <vector>
+
+namespace ml
+{
+    /**
+     * @brief The decomposition A = V * diag ( lambda ) * transpose ( V ) of
+     * a symmetric matrix A, where V is orthogonal. Principal components are
+     * the eigenvectors of a covariance matrix, and whitening scales by its
+     * eigenvalues.
+     * @details A is first reduced to a tridiagonal matrix by Householder
+     * reflections, gathered in panels so that most of the work is the
+     * blocked, threaded GEMM. The tridiagonal problem is split in half,
+     * each half solved recursively, and the halves merged through the
+     * secular equation of a rank one update, which is again a matrix
+     * product. Small pieces are finished by implicit QL.
+     * @note Only the lower triangle of A is read; the upper triangle is
+     * taken to mirror it.
+     * @note Pass the matrix with std::move to reduce it in place without
+     * making a copy.
+     */
+    template < CONCEPT_NAMESPACE Floating V > class SymmetricEigen
+    {
+        std::vector< V > values;
+        Matrix< V >      vectors;
+    public:
+        // throws std::out_of_range if the matrix is not square.
+        explicit SymmetricEigen ( Matrix< V > matrix );
+
+        std::size_t size ( ) const NOEXCEPT;
+
+        // in ascending order.
+        std::vector< V > const &eigenvalues ( ) const NOEXCEPT;
+
+        // one per column, in the order of the eigenvalues.
+        Matrix< V > const &eigenvectors ( ) const NOEXCEPT;
+    };
+
+    /**
+     * @brief The thin decomposition A = U * diag ( sigma ) * transpose ( V )
+     * of an m x n matrix A, where U is m x k and V is n x k with orthonormal
+     * columns, sigma is non-negative and k = min ( m, n ).
+     * @details A tall A is factored as Q * R first, and R reduced to a
+     * bidiagonal B. The singular values of B are the non-negative
+     * eigenvalues of a 2k x 2k tridiagonal matrix with a zero diagonal and
+     * the elements of B interleaved beside it, which is solved as in
+     * SymmetricEigen, and its eigenvectors hold the singular vectors of B
+     * in their even and odd elements. A wide A is decomposed by way of its
+     * transpose.
+     * @note Singular vectors of singular values that are zero to working
+     * precision are only determined up to their span, and are chosen to be
+     * any orthonormal basis of the rest of the space.
+     */
+    template < CONCEPT_NAMESPACE Floating V > class SVD
+    {
+        Matrix< V >      left;
+        std::vector< V > values;
+        Matrix< V >      right;
+    public:
+        explicit SVD ( Matrix< V > matrix );
+
+        // in descending order.
+        std::vector< V > const &singularValues ( ) const NOEXCEPT;
+
+        Matrix< V > const &u ( ) const NOEXCEPT;
+        Matrix< V > const &v ( ) const NOEXCEPT;
+    };
+} // namespace ml
+
+#include "eigen.tcc"
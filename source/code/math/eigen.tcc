@@ -0,0 +1,1163 @@
+/**
+ * @file eigen.tcc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief This C++ file is meant to be included only in eigen.hh
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+
+#include "../thread/pool.hh"
+#include "gemm.hh"
+#include "kernels.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace ml
+{
+    namespace eigen
+    {
+        // reflections per panel, as for QR.
+        constexpr std::size_t reflectionBlock = 32;
+
+        // reflections applied at once when forming vectors, where wider
+        // panels make for deeper, and so faster, GEMMs.
+        constexpr std::size_t applyBlock = 128;
+
+        // tridiagonal problems this small are finished by QL.
+        constexpr std::size_t leafSize = 25;
+
+        // sqrt ( a * a + b * b ), without squaring either.
+        template < class V > V pythag ( V a, V b )
+        {
+            using std::abs;
+            using std::sqrt;
+            a = abs ( a );
+            b = abs ( b );
+            if ( a < b )
+            {
+                std::swap ( a, b );
+            }
+            if ( a == V { 0 } )
+            {
+                return V { 0 };
+            }
+            V const r = b / a;
+            return a * sqrt ( V { 1 } + r * r );
+        }
+
+        /**
+         * @brief y = A * v for the symmetric n x n A, reading only its lower
+         * triangle.
+         * @details Each row of the triangle is used twice while it is in
+         * cache, once as a row and once as a column, so A is read from
+         * memory half as much as by a GEMV. The rows are split into pieces
+         * of equal work, each with its own copy of y to add columns into.
+         */
+        template < class V >
+        void symmetricProduct ( std::size_t n,
+                                V const    *a,
+                                std::size_t ld,
+                                V const    *v,
+                                V          *y )
+        {
+            using std::sqrt;
+            std::size_t const pieces = std::max (
+                    std::size_t { 1 },
+                    std::min ( thread::threadCount ( ), n * n / 65536 ) );
+            // row i costs about i, so piece p ends at n * sqrt of its share.
+            auto const bound = [ n, pieces ] ( std::size_t p ) {
+                double const share = double ( p ) / double ( pieces );
+                double const end   = double ( n ) * sqrt ( share );
+                return p == pieces ? n : std::size_t ( end );
+            };
+            Matrix< V >       partial { pieces, n };
+            std::size_t const ldp = partial.leadingDimension ( );
+            thread::parallelFor (
+                    0,
+                    pieces,
+                    1,
+                    [ & ] ( std::size_t from, std::size_t to ) {
+                        for ( std::size_t p = from; p < to; p++ )
+                        {
+                            V *const out = partial.data ( ) + p * ldp;
+                            for ( std::size_t i = bound ( p );
+                                  i < bound ( p + 1 );
+                                  i++ )
+                            {
+                                V const *row = a + i * ld;
+                                V        t   = V { 0 };
+                                kernel::gemv ( std::size_t { 1 },
+                                               i,
+                                               V { 1 },
+                                               row,
+                                               ld,
+                                               v,
+                                               V { 0 },
+                                               &t );
+                                out [ i ] += t + row [ i ] * v [ i ];
+                                kernel::axpy ( i, v [ i ], row, out );
+                            }
+                        }
+                    } );
+            std::copy ( partial.data ( ), partial.data ( ) + n, y );
+            for ( std::size_t p = 1; p < pieces; p++ )
+            {
+                kernel::axpy ( n, V { 1 }, partial.data ( ) + p * ldp, y );
+            }
+        }
+
+        // the vectors of reflections first to last of a reduction, with
+        // their ones and zeros filled in. Reflection j's vector runs along
+        // a [ i * rs + j * cs ] from i = j + shift, after its leading one,
+        // and the panel starts at row first + shift of what it reflects.
+        template < class V >
+        Matrix< V > panel ( V const    *a,
+                            std::size_t rs,
+                            std::size_t cs,
+                            std::size_t count,
+                            std::size_t shift,
+                            std::size_t first,
+                            std::size_t last )
+        {
+            std::size_t const rows = count - first - shift;
+            Matrix< V >       y { rows, last - first };
+            for ( std::size_t i = 0; i < rows; i++ )
+            {
+                std::size_t const g = first + shift + i;
+                for ( std::size_t j = 0; j < last - first && j <= i; j++ )
+                {
+                    y [ i ][ j ] = i == j ? V { 1 }
+                                          : a [ g * rs + ( first + j ) * cs ];
+                }
+            }
+            return y;
+        }
+
+        // z <- Q * z, where Q is the product of the first reflections of a
+        // reduction stored as for panel, taken a panel at a time.
+        template < class V >
+        void unreflect ( V const     *a,
+                         std::size_t  rs,
+                         std::size_t  cs,
+                         std::size_t  count,
+                         std::size_t  shift,
+                         std::size_t  reflections,
+                         V const     *scales,
+                         Matrix< V > &z )
+        {
+            std::size_t const ldz    = z.leadingDimension ( );
+            std::size_t const panels = ( reflections + applyBlock - 1 )
+                                     / applyBlock;
+            for ( std::size_t p = panels; p-- > 0; )
+            {
+                std::size_t const k0 = p * applyBlock;
+                std::size_t const k1 =
+                        std::min ( reflections, k0 + applyBlock );
+                Matrix< V > const y = panel ( a, rs, cs, count, shift, k0, k1 );
+                qr::reflect ( y,
+                              qr::gather ( y, scales + k0 ),
+                              false,
+                              z.data ( ) + ( k0 + shift ) * ldz,
+                              ldz,
+                              z.colCount ( ) );
+            }
+        }
+
+        /**
+         * @brief Reduces the symmetric matrix A to the tridiagonal
+         * transpose ( Q ) * A * Q, with diagonal d and off diagonal e.
+         * @details Q is the product of a reflection per column, whose
+         * vectors are left below the off diagonal of A and whose scales go
+         * in scales. Within a panel, A is only brought up to date a column
+         * at a time as each reflection needs it; the rest of A is updated
+         * once per panel with two GEMMs, as in LAPACK's sytrd.
+         */
+        template < class V >
+        void tridiagonalize ( Matrix< V >      &matrix,
+                              std::vector< V > &d,
+                              std::vector< V > &e,
+                              std::vector< V > &scales )
+        {
+            std::size_t const n  = matrix.rowCount ( );
+            std::size_t const ld = matrix.leadingDimension ( );
+            V *const          a  = matrix.data ( );
+            d.assign ( n, V { 0 } );
+            e.assign ( n ? n - 1 : 0, V { 0 } );
+            scales.assign ( e.size ( ), V { 0 } );
+            if ( n == 0 )
+            {
+                return;
+            }
+
+            // the panel's reflections V and their effects W, so that
+            // A - V * transpose ( W ) - W * transpose ( V ) is up to date.
+            std::size_t const block = reflectionBlock;
+            Matrix< V >       vp { n, block };
+            Matrix< V >       wp { n, block };
+            std::size_t const ldv = vp.leadingDimension ( );
+            std::size_t const ldw = wp.leadingDimension ( );
+            V *const          pv  = vp.data ( );
+            V *const          pw  = wp.data ( );
+            std::vector< V >  u ( n ), y ( n ), s ( block ), t ( block );
+            for ( std::size_t k0 = 0; k0 + 1 < n; k0 += block )
+            {
+                std::size_t const k1 = std::min ( n - 1, k0 + block );
+                for ( std::size_t j = k0; j < k1; j++ )
+                {
+                    std::size_t const jj   = j - k0;
+                    std::size_t const rows = n - j - 1;
+                    // bring column j up to date.
+                    for ( std::size_t r = j; r < n; r++ )
+                    {
+                        V sum = V { 0 };
+                        for ( std::size_t p = 0; p < jj; p++ )
+                        {
+                            sum += pv [ r * ldv + p ] * pw [ j * ldw + p ]
+                                 + pw [ r * ldw + p ] * pv [ j * ldv + p ];
+                        }
+                        a [ r * ld + j ] -= sum;
+                    }
+                    d [ j ] = a [ j * ld + j ];
+
+                    // the reflection that zeros column j below the off
+                    // diagonal.
+                    V *const x = a + ( j + 1 ) * ld + j;
+                    V const  tau = qr::householder ( x, rows, ld );
+                    scales [ j ] = tau;
+                    e [ j ]      = x [ 0 ];
+                    u [ 0 ]      = V { 1 };
+                    for ( std::size_t r = 1; r < rows; r++ )
+                    {
+                        u [ r ] = x [ r * ld ];
+                    }
+                    if ( tau == V { 0 } )
+                    {
+                        for ( std::size_t r = j + 1; r < n; r++ )
+                        {
+                            pv [ r * ldv + jj ] = V { 0 };
+                            pw [ r * ldw + jj ] = V { 0 };
+                        }
+                        continue;
+                    }
+
+                    // y = A22 * v, which is most of the work that is not a
+                    // GEMM, less what A22 is still owed by the panel.
+                    symmetricProduct ( rows,
+                                       a + ( j + 1 ) * ld + j + 1,
+                                       ld,
+                                       u.data ( ),
+                                       y.data ( ) );
+                    for ( std::size_t p = 0; p < jj; p++ )
+                    {
+                        s [ p ] = V { 0 };
+                        t [ p ] = V { 0 };
+                        for ( std::size_t r = 0; r < rows; r++ )
+                        {
+                            s [ p ] += pw [ ( j + 1 + r ) * ldw + p ] * u [ r ];
+                            t [ p ] += pv [ ( j + 1 + r ) * ldv + p ] * u [ r ];
+                        }
+                    }
+                    for ( std::size_t r = 0; r < rows; r++ )
+                    {
+                        V const *vr  = pv + ( j + 1 + r ) * ldv;
+                        V const *wr  = pw + ( j + 1 + r ) * ldw;
+                        V        sum = V { 0 };
+                        for ( std::size_t p = 0; p < jj; p++ )
+                        {
+                            sum += vr [ p ] * s [ p ] + wr [ p ] * t [ p ];
+                        }
+                        y [ r ] -= sum;
+                    }
+
+                    // w = tau * y - tau / 2 * ( tau * y . v ) * v
+                    V dot = V { 0 };
+                    for ( std::size_t r = 0; r < rows; r++ )
+                    {
+                        dot += y [ r ] * u [ r ];
+                    }
+                    V const alpha = -tau * tau * dot / V { 2 };
+                    for ( std::size_t r = 0; r < rows; r++ )
+                    {
+                        std::size_t const i = j + 1 + r;
+                        pv [ i * ldv + jj ] = u [ r ];
+                        pw [ i * ldw + jj ] = tau * y [ r ] + alpha * u [ r ];
+                    }
+                }
+
+                // and the rest of A, all at once.
+                std::size_t const width = k1 - k0;
+                std::size_t const rest  = n - k1;
+                kernel::gemm ( rest,
+                               rest,
+                               width,
+                               V { -1 },
+                               pv + k1 * ldv,
+                               ldv,
+                               std::size_t { 1 },
+                               pw + k1 * ldw,
+                               std::size_t { 1 },
+                               ldw,
+                               V { 1 },
+                               a + k1 * ld + k1,
+                               ld );
+                kernel::gemm ( rest,
+                               rest,
+                               width,
+                               V { -1 },
+                               pw + k1 * ldw,
+                               ldw,
+                               std::size_t { 1 },
+                               pv + k1 * ldv,
+                               std::size_t { 1 },
+                               ldv,
+                               V { 1 },
+                               a + k1 * ld + k1,
+                               ld );
+            }
+            d [ n - 1 ] = a [ ( n - 1 ) * ld + n - 1 ];
+        }
+
+        // sorts d into ascending order, and the columns of z with it.
+        template < class V >
+        void order ( std::size_t n, V *d, V *z, std::size_t ldz )
+        {
+            std::vector< std::size_t > index ( n );
+            std::iota ( index.begin ( ), index.end ( ), std::size_t { 0 } );
+            std::stable_sort ( index.begin ( ),
+                               index.end ( ),
+                               [ d ] ( std::size_t i, std::size_t j ) {
+                                   return d [ i ] < d [ j ];
+                               } );
+            std::vector< V > values ( d, d + n ), row ( n );
+            for ( std::size_t i = 0; i < n; i++ )
+            {
+                V *const zi = z + i * ldz;
+                d [ i ]     = values [ index [ i ] ];
+                std::copy ( zi, zi + n, row.begin ( ) );
+                for ( std::size_t j = 0; j < n; j++ )
+                {
+                    zi [ j ] = row [ index [ j ] ];
+                }
+            }
+        }
+
+        // the eigenvalues of the n x n tridiagonal matrix with diagonal d
+        // and off diagonal e into d, and its eigenvectors into the columns
+        // of z, by implicit QL with Wilkinson shifts.
+        template < class V >
+        void ql ( std::size_t n, V *d, V const *e, V *z, std::size_t ldz )
+        {
+            using std::abs;
+            V const          eps = std::numeric_limits< V >::epsilon ( );
+            std::vector< V > f ( e, e + n - 1 );
+            f.push_back ( V { 0 } );
+            for ( std::size_t i = 0; i < n; i++ )
+            {
+                for ( std::size_t j = 0; j < n; j++ )
+                {
+                    z [ i * ldz + j ] = i == j ? V { 1 } : V { 0 };
+                }
+            }
+            for ( std::size_t l = 0; l < n; l++ )
+            {
+                for ( std::size_t iteration = 0;; iteration++ )
+                {
+                    // look for a negligible off diagonal element to split
+                    // at.
+                    std::size_t m = l;
+                    for ( ; m + 1 < n; m++ )
+                    {
+                        V const scale = abs ( d [ m ] ) + abs ( d [ m + 1 ] );
+                        if ( abs ( f [ m ] ) <= eps * scale )
+                        {
+                            break;
+                        }
+                    }
+                    if ( m == l )
+                    {
+                        break;
+                    }
+                    if ( iteration == 60 )
+                    {
+                        throw std::runtime_error (
+                                "Eigenvalues did not converge!" );
+                    }
+                    V g = ( d [ l + 1 ] - d [ l ] ) / ( V { 2 } * f [ l ] );
+                    V r = pythag ( g, V { 1 } );
+                    g   = d [ m ] - d [ l ]
+                      + f [ l ] / ( g + ( g < V { 0 } ? -r : r ) );
+                    V    s     = V { 1 };
+                    V    c     = V { 1 };
+                    V    p     = V { 0 };
+                    bool split = false;
+                    for ( std::size_t i = m; i-- > l; )
+                    {
+                        V const h   = s * f [ i ];
+                        V const b   = c * f [ i ];
+                        r           = pythag ( h, g );
+                        f [ i + 1 ] = r;
+                        if ( r == V { 0 } )
+                        {
+                            d [ i + 1 ] -= p;
+                            f [ m ] = V { 0 };
+                            split   = true;
+                            break;
+                        }
+                        s           = h / r;
+                        c           = g / r;
+                        g           = d [ i + 1 ] - p;
+                        r           = ( d [ i ] - g ) * s + V { 2 } * c * b;
+                        p           = s * r;
+                        d [ i + 1 ] = g + p;
+                        g           = c * r - b;
+                        for ( std::size_t k = 0; k < n; k++ )
+                        {
+                            V *const row  = z + k * ldz;
+                            V const  x    = row [ i + 1 ];
+                            row [ i + 1 ] = s * row [ i ] + c * x;
+                            row [ i ]     = c * row [ i ] - s * x;
+                        }
+                    }
+                    if ( split )
+                    {
+                        continue;
+                    }
+                    d [ l ] -= p;
+                    f [ l ] = g;
+                    f [ m ] = V { 0 };
+                }
+            }
+            order ( n, d, z, ldz );
+        }
+
+        /**
+         * @brief The root lambda in ( delta [ i ], delta [ i + 1 ] ), or
+         * past the last delta, of the secular equation
+         * 1 + rho * sum ( zeta [ j ]^2 / ( delta [ j ] - lambda ) ) = 0,
+         * for ascending delta and positive rho.
+         * @details The root is found relative to the nearer of the two
+         * poles beside it, so that the gaps delta [ j ] - lambda, which go
+         * in gaps, are accurate even when lambda is very close to a pole.
+         * Each step fits each side of the sum with a single pole matched in
+         * value and slope and takes the root of the fit, which converges
+         * quadratically, falling back on bisection if the step leaves the
+         * bracket.
+         */
+        template < class V >
+        V secular ( std::size_t k,
+                    V const    *delta,
+                    V const    *zeta,
+                    V           rho,
+                    std::size_t i,
+                    V          *gaps )
+        {
+            using std::abs;
+            using std::sqrt;
+            V const     eps  = std::numeric_limits< V >::epsilon ( );
+            bool const  last = i + 1 == k;
+            std::size_t origin;
+            V           lo, hi;
+            if ( last )
+            {
+                V norm = V { 0 };
+                for ( std::size_t j = 0; j < k; j++ )
+                {
+                    norm += zeta [ j ] * zeta [ j ];
+                }
+                origin = i;
+                lo     = V { 0 };
+                hi     = rho * norm;
+            }
+            else
+            {
+                // the sign of the equation halfway between the poles says
+                // which one the root is nearer.
+                V const mid = ( delta [ i + 1 ] - delta [ i ] ) / V { 2 };
+                V       f   = V { 1 };
+                for ( std::size_t j = 0; j < k; j++ )
+                {
+                    V const gap = delta [ j ] - delta [ i ] - mid;
+                    f += rho * zeta [ j ] * zeta [ j ] / gap;
+                }
+                origin = f > V { 0 } ? i : i + 1;
+                lo     = f > V { 0 } ? V { 0 } : -mid;
+                hi     = f > V { 0 } ? mid : V { 0 };
+            }
+            for ( std::size_t j = 0; j < k; j++ )
+            {
+                gaps [ j ] = delta [ j ] - delta [ origin ];
+            }
+
+            V tau = ( lo + hi ) / V { 2 };
+            for ( std::size_t iteration = 0; iteration < 100; iteration++ )
+            {
+                // psi sums the poles up to i, and phi those after.
+                V psi = V { 0 }, dpsi = V { 0 };
+                V phi = V { 0 }, dphi = V { 0 };
+                for ( std::size_t j = 0; j < k; j++ )
+                {
+                    V const q = zeta [ j ] / ( gaps [ j ] - tau );
+                    ( j <= i ? psi : phi ) += zeta [ j ] * q;
+                    ( j <= i ? dpsi : dphi ) += q * q;
+                }
+                V const f     = V { 1 } + rho * ( psi + phi );
+                V const size  = V { 1 } + rho * ( abs ( psi ) + abs ( phi ) );
+                V const bound = V ( 8 * k ) * eps * size;
+                if ( abs ( f ) <= bound )
+                {
+                    break;
+                }
+                ( f < V { 0 } ? lo : hi ) = tau;
+                V const ends = std::max ( abs ( lo ), abs ( hi ) );
+                if ( hi - lo <= V { 2 } * eps * ends )
+                {
+                    break;
+                }
+
+                // the fit is c + s1 / ( a1 - h ) + s2 / ( a2 - h ) in the
+                // step h, whose root is that of a quadratic.
+                V const a1     = gaps [ i ] - tau;
+                V const s1     = rho * dpsi * a1 * a1;
+                V       step   = V { 0 };
+                bool    fitted = false;
+                if ( last )
+                {
+                    V const c = V { 1 } + rho * ( psi - dpsi * a1 );
+                    fitted    = c > V { 0 };
+                    step      = fitted ? a1 + s1 / c : V { 0 };
+                }
+                else
+                {
+                    V const a2   = gaps [ i + 1 ] - tau;
+                    V const s2   = rho * dphi * a2 * a2;
+                    V const c    = V { 1 } + rho * ( psi - dpsi * a1 )
+                                 + rho * ( phi - dphi * a2 );
+                    V const b    = c * ( a1 + a2 ) + s1 + s2;
+                    V const disc = b * b - V { 4 } * c * a1 * a2 * f;
+                    if ( disc >= V { 0 } )
+                    {
+                        // the two roots, computed without cancellation.
+                        V const root = b < V { 0 } ? b - sqrt ( disc )
+                                                   : b + sqrt ( disc );
+                        V const near = root == V { 0 }
+                                             ? V { 0 }
+                                             : V { 2 } * a1 * a2 * f / root;
+                        V const far  = c == V { 0 } ? near
+                                                    : root / ( V { 2 } * c );
+                        fitted       = true;
+                        step         = near > a1 && near < a2 ? near : far;
+                    }
+                }
+                V const next = tau + step;
+                tau          = fitted && next > lo && next < hi
+                                     ? next
+                                     : ( lo + hi ) / V { 2 };
+            }
+            for ( std::size_t j = 0; j < k; j++ ) { gaps [ j ] -= tau; }
+            return delta [ origin ] + tau;
+        }
+
+        /**
+         * @brief Merges the eigendecompositions of the two halves of an n x n
+         * tridiagonal matrix, split after row m with off diagonal beta
+         * between them, into that of the whole.
+         * @details The halves' eigenvalues are in d and their eigenvectors
+         * Q1 and Q2 in the diagonal blocks of z. The whole is
+         * diag ( Q1, Q2 ) * ( D + rho * u * transpose ( u ) ) * transpose (
+         * diag ( Q1, Q2 ) ), so its eigenvectors are diag ( Q1, Q2 ) * W
+         * for the eigenvectors W of the inner rank one update. Elements of
+         * u too small to matter, and pairs of eigenvalues too close to tell
+         * apart, are deflated first: their vectors are already known.
+         * What is left is solved through the secular equation, with u
+         * recomputed from the computed eigenvalues (Gu and Eisenstat) so
+         * that the vectors come out orthogonal.
+         */
+        template < class V >
+        void merge ( std::size_t n,
+                     std::size_t m,
+                     V           beta,
+                     V          *d,
+                     V          *z,
+                     std::size_t ldz )
+        {
+            using std::abs;
+            using std::sqrt;
+            V const eps = std::numeric_limits< V >::epsilon ( );
+
+            // u is the last row of Q1 beside the first row of Q2.
+            std::vector< V > u ( n );
+            V const          sign = beta < V { 0 } ? V { -1 } : V { 1 };
+            for ( std::size_t j = 0; j < m; j++ )
+            {
+                u [ j ] = z [ ( m - 1 ) * ldz + j ];
+            }
+            for ( std::size_t j = m; j < n; j++ )
+            {
+                u [ j ] = sign * z [ m * ldz + j ];
+            }
+            V norm = V { 0 };
+            for ( std::size_t j = 0; j < n; j++ ) { norm += u [ j ] * u [ j ]; }
+            V const rho = abs ( beta ) * norm;
+            norm        = sqrt ( norm );
+            for ( std::size_t j = 0; j < n; j++ ) { u [ j ] /= norm; }
+
+            // deflate, in ascending order of d.
+            std::vector< std::size_t > index ( n );
+            std::iota ( index.begin ( ), index.end ( ), std::size_t { 0 } );
+            std::stable_sort ( index.begin ( ),
+                               index.end ( ),
+                               [ d ] ( std::size_t i, std::size_t j ) {
+                                   return d [ i ] < d [ j ];
+                               } );
+            V largest = rho;
+            for ( std::size_t j = 0; j < n; j++ )
+            {
+                largest = std::max ( largest, V ( abs ( d [ j ] ) ) );
+            }
+            V const tolerance = V { 8 } * eps * largest;
+            struct Rotation
+            {
+                std::size_t p, j;
+                V           c, s;
+            };
+            std::vector< Rotation >    rotations;
+            std::vector< std::size_t > kept, deflated;
+            for ( std::size_t j : index )
+            {
+                if ( rho * abs ( u [ j ] ) <= tolerance )
+                {
+                    deflated.push_back ( j );
+                    continue;
+                }
+                if ( !kept.empty ( ) )
+                {
+                    // a rotation that moves all of u [ p ] into u [ j ] only
+                    // couples them by ( d [ j ] - d [ p ] ) * c * s.
+                    std::size_t const p = kept.back ( );
+                    V const           r = pythag ( u [ p ], u [ j ] );
+                    V const           c = u [ j ] / r;
+                    V const           s = u [ p ] / r;
+                    if ( abs ( ( d [ j ] - d [ p ] ) * c * s ) <= tolerance )
+                    {
+                        V const dp = d [ p ] * c * c + d [ j ] * s * s;
+                        V const dj = d [ p ] * s * s + d [ j ] * c * c;
+                        d [ p ]    = dp;
+                        d [ j ]    = dj;
+                        u [ p ]    = V { 0 };
+                        u [ j ]    = r;
+                        rotations.push_back ( Rotation { p, j, c, s } );
+                        deflated.push_back ( p );
+                        kept.back ( ) = j;
+                        continue;
+                    }
+                }
+                kept.push_back ( j );
+            }
+
+            // the roots of the secular equation, split across the threads.
+            std::size_t const k = kept.size ( );
+            std::vector< V >  delta ( k ), zeta ( k ), lambda ( k );
+            for ( std::size_t i = 0; i < k; i++ )
+            {
+                delta [ i ] = d [ kept [ i ] ];
+                zeta [ i ]  = u [ kept [ i ] ];
+            }
+            Matrix< V >       gaps { k, k };
+            std::size_t const ldg = gaps.leadingDimension ( );
+            thread::parallelFor (
+                    0,
+                    k,
+                    thread::grainFor ( k, 16 * k ),
+                    [ & ] ( std::size_t from, std::size_t to ) {
+                        for ( std::size_t i = from; i < to; i++ )
+                        {
+                            lambda [ i ] = secular ( k,
+                                                     delta.data ( ),
+                                                     zeta.data ( ),
+                                                     rho,
+                                                     i,
+                                                     gaps.data ( ) + i * ldg );
+                        }
+                    } );
+            for ( std::size_t j = 0; j < k; j++ )
+            {
+                V product = -gaps [ j ][ j ] / rho;
+                for ( std::size_t i = 0; i < k; i++ )
+                {
+                    if ( i != j )
+                    {
+                        V const apart = delta [ i ] - delta [ j ];
+                        product *= -gaps [ i ][ j ] / apart;
+                    }
+                }
+                V const size = sqrt ( abs ( product ) );
+                zeta [ j ]   = zeta [ j ] < V { 0 } ? -size : size;
+            }
+
+            // W, with its columns in ascending order of eigenvalue.
+            typedef std::pair< V, std::size_t > Value;
+            std::vector< Value >                values;
+            for ( std::size_t i = 0; i < k; i++ )
+            {
+                values.emplace_back ( lambda [ i ], i );
+            }
+            for ( std::size_t i = 0; i < deflated.size ( ); i++ )
+            {
+                values.emplace_back ( d [ deflated [ i ] ], k + i );
+            }
+            std::stable_sort ( values.begin ( ),
+                               values.end ( ),
+                               [ ] ( Value const &x, Value const &y ) {
+                                   return x.first < y.first;
+                               } );
+            Matrix< V >       w { n, n };
+            std::size_t const ldw = w.leadingDimension ( );
+            V *const          pw  = w.data ( );
+            for ( std::size_t c = 0; c < n; c++ )
+            {
+                std::size_t const source = values [ c ].second;
+                if ( source >= k )
+                {
+                    pw [ deflated [ source - k ] * ldw + c ] = V { 1 };
+                    continue;
+                }
+                V length = V { 0 };
+                for ( std::size_t j = 0; j < k; j++ )
+                {
+                    V const x = zeta [ j ] / gaps [ source ][ j ];
+                    pw [ kept [ j ] * ldw + c ] = x;
+                    length += x * x;
+                }
+                length = sqrt ( length );
+                for ( std::size_t j = 0; j < k; j++ )
+                {
+                    pw [ kept [ j ] * ldw + c ] /= length;
+                }
+            }
+            for ( std::size_t r = rotations.size ( ); r-- > 0; )
+            {
+                Rotation const &g  = rotations [ r ];
+                V *const        rp = pw + g.p * ldw;
+                V *const        rj = pw + g.j * ldw;
+                for ( std::size_t c = 0; c < n; c++ )
+                {
+                    V const x = rp [ c ];
+                    V const y = rj [ c ];
+                    rp [ c ]  = g.c * x + g.s * y;
+                    rj [ c ]  = -g.s * x + g.c * y;
+                }
+            }
+
+            // and the eigenvectors of the whole, by two GEMMs.
+            std::size_t const rest = n - m;
+            Matrix< V >       q1 { m, m };
+            Matrix< V >       q2 { rest, rest };
+            for ( std::size_t i = 0; i < m; i++ )
+            {
+                std::copy ( z + i * ldz, z + i * ldz + m, q1 [ i ].begin ( ) );
+            }
+            for ( std::size_t i = 0; i < rest; i++ )
+            {
+                V const *row = z + ( m + i ) * ldz + m;
+                std::copy ( row, row + rest, q2 [ i ].begin ( ) );
+            }
+            kernel::gemm ( m,
+                           n,
+                           m,
+                           V { 1 },
+                           q1.data ( ),
+                           q1.leadingDimension ( ),
+                           std::size_t { 1 },
+                           pw,
+                           ldw,
+                           std::size_t { 1 },
+                           V { 0 },
+                           z,
+                           ldz );
+            kernel::gemm ( rest,
+                           n,
+                           rest,
+                           V { 1 },
+                           q2.data ( ),
+                           q2.leadingDimension ( ),
+                           std::size_t { 1 },
+                           pw + m * ldw,
+                           ldw,
+                           std::size_t { 1 },
+                           V { 0 },
+                           z + m * ldz,
+                           ldz );
+            for ( std::size_t c = 0; c < n; c++ )
+            {
+                d [ c ] = values [ c ].first;
+            }
+        }
+
+        // divide and conquer on the tridiagonal matrix with diagonal d and
+        // off diagonal e, whose eigenvectors go in z.
+        template < class V >
+        void conquer ( std::size_t n, V *d, V const *e, V *z, std::size_t ldz )
+        {
+            using std::abs;
+            if ( n <= leafSize )
+            {
+                ql ( n, d, e, z, ldz );
+                return;
+            }
+            // tearing out the off diagonal element between the halves
+            // leaves a rank one update, and the halves are independent.
+            std::size_t const m    = n / 2;
+            V const           beta = e [ m - 1 ];
+            d [ m - 1 ] -= abs ( beta );
+            d [ m ] -= abs ( beta );
+            thread::parallelFor (
+                    0,
+                    2,
+                    1,
+                    [ & ] ( std::size_t from, std::size_t to ) {
+                        for ( std::size_t half = from; half < to; half++ )
+                        {
+                            if ( half == 0 )
+                            {
+                                conquer ( m, d, e, z, ldz );
+                            }
+                            else
+                            {
+                                conquer ( n - m,
+                                          d + m,
+                                          e + m,
+                                          z + m * ldz + m,
+                                          ldz );
+                            }
+                        }
+                    } );
+            merge ( n, m, beta, d, z, ldz );
+        }
+
+        // the eigenvalues of the n x n tridiagonal matrix with diagonal d
+        // and off diagonal e into d, in ascending order, and its
+        // eigenvectors into the columns of z, which starts out zero.
+        template < class V >
+        void tridiagonal ( std::size_t n, V *d, V *e, V *z, std::size_t ldz )
+        {
+            using std::abs;
+            // scaled so that the tolerances are relative to the matrix.
+            V scale = V { 0 };
+            for ( std::size_t i = 0; i < n; i++ )
+            {
+                scale = std::max ( scale, V ( abs ( d [ i ] ) ) );
+                if ( i + 1 < n )
+                {
+                    scale = std::max ( scale, V ( abs ( e [ i ] ) ) );
+                }
+            }
+            if ( scale == V { 0 } )
+            {
+                for ( std::size_t i = 0; i < n; i++ ) { z [ i * ldz + i ] = V { 1 }; }
+                return;
+            }
+            for ( std::size_t i = 0; i < n; i++ ) { d [ i ] /= scale; }
+            for ( std::size_t i = 0; i + 1 < n; i++ ) { e [ i ] /= scale; }
+            conquer ( n, d, e, z, ldz );
+            for ( std::size_t i = 0; i < n; i++ ) { d [ i ] *= scale; }
+        }
+
+        /**
+         * @brief Reduces the square matrix R to the upper bidiagonal
+         * transpose ( QL ) * R * QR, with diagonal d and super diagonal e.
+         * @details Reflections from the left are kept below the diagonal of
+         * R, and from the right after the super diagonal, with their scales
+         * in left and right. Each reflection updates the rest of R split
+         * across the thread pool.
+         */
+        template < class V >
+        void bidiagonalize ( Matrix< V >      &matrix,
+                             std::vector< V > &d,
+                             std::vector< V > &e,
+                             std::vector< V > &left,
+                             std::vector< V > &right )
+        {
+            std::size_t const n  = matrix.rowCount ( );
+            std::size_t const ld = matrix.leadingDimension ( );
+            V *const          a  = matrix.data ( );
+            d.assign ( n, V { 0 } );
+            e.assign ( n ? n - 1 : 0, V { 0 } );
+            left.assign ( n, V { 0 } );
+            right.assign ( e.size ( ), V { 0 } );
+            for ( std::size_t k = 0; k < n; k++ )
+            {
+                // from the left, on columns k + 1 on, a block of them per
+                // thread.
+                std::size_t const rest = n - k - 1;
+                V const tau = qr::householder ( a + k * ld + k, n - k, ld );
+                left [ k ]  = tau;
+                d [ k ]     = a [ k * ld + k ];
+                if ( tau != V { 0 } && rest > 0 )
+                {
+                    thread::parallelFor (
+                            k + 1,
+                            n,
+                            thread::grainFor ( rest, 2 * ( rest + 1 ) ),
+                            [ & ] ( std::size_t from, std::size_t to ) {
+                                std::size_t const width = to - from;
+                                V *const          top   = a + k * ld + from;
+                                std::vector< V >  w ( top, top + width );
+                                for ( std::size_t i = k + 1; i < n; i++ )
+                                {
+                                    kernel::axpy ( width,
+                                                   a [ i * ld + k ],
+                                                   a + i * ld + from,
+                                                   w.data ( ) );
+                                }
+                                kernel::axpy (
+                                        width, V ( -tau ), w.data ( ), top );
+                                for ( std::size_t i = k + 1; i < n; i++ )
+                                {
+                                    V const t = -tau * a [ i * ld + k ];
+                                    kernel::axpy ( width,
+                                                   t,
+                                                   w.data ( ),
+                                                   a + i * ld + from );
+                                }
+                            } );
+                }
+                if ( rest == 0 )
+                {
+                    break;
+                }
+
+                // and from the right, on rows k + 1 on.
+                V *const v     = a + k * ld + k + 1;
+                V const  sigma = qr::householder ( v, rest, std::size_t { 1 } );
+                right [ k ]    = sigma;
+                e [ k ]        = v [ 0 ];
+                if ( sigma == V { 0 } )
+                {
+                    continue;
+                }
+                thread::parallelFor (
+                        k + 1,
+                        n,
+                        thread::grainFor ( rest, 2 * rest ),
+                        [ & ] ( std::size_t from, std::size_t to ) {
+                            for ( std::size_t i = from; i < to; i++ )
+                            {
+                                V *const row = a + i * ld + k + 1;
+                                V        s   = row [ 0 ];
+                                for ( std::size_t c = 1; c < rest; c++ )
+                                {
+                                    s += row [ c ] * v [ c ];
+                                }
+                                s *= sigma;
+                                row [ 0 ] -= s;
+                                kernel::axpy (
+                                        rest - 1, V ( -s ), v + 1, row + 1 );
+                            }
+                        } );
+            }
+        }
+
+        // replaces columns r on of the square x, whose first r columns are
+        // orthonormal, with an orthonormal basis of the rest of the space.
+        template < class V > void complete ( Matrix< V > &x, std::size_t r )
+        {
+            std::size_t const n = x.rowCount ( );
+            Matrix< V >       basis { n, n };
+            for ( std::size_t i = 0; i < n; i++ )
+            {
+                std::copy ( x [ i ].begin ( ),
+                            x [ i ].begin ( ) + r,
+                            basis [ i ].begin ( ) );
+            }
+            Matrix< V > const q = QR< V > { std::move ( basis ) }.q ( );
+            for ( std::size_t i = 0; i < n; i++ )
+            {
+                std::copy ( q [ i ].begin ( ) + r,
+                            q [ i ].end ( ),
+                            x [ i ].begin ( ) + r );
+            }
+        }
+    } // namespace eigen
+} // namespace ml
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::SymmetricEigen< V >::SymmetricEigen ( Matrix< V > matrix )
+{
+    if ( matrix.rowCount ( ) != matrix.colCount ( ) )
+    {
+        throw std::out_of_range ( "Matrix is not square!" );
+    }
+    std::size_t const n  = matrix.rowCount ( );
+    std::size_t const ld = matrix.leadingDimension ( );
+    V *const          a  = matrix.data ( );
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        for ( std::size_t j = 0; j < i; j++ ) { a [ j * ld + i ] = a [ i * ld + j ]; }
+    }
+
+    // A = Q * T * transpose ( Q ), and T = Z * L * transpose ( Z ).
+    std::vector< V > e, scales;
+    eigen::tridiagonalize ( matrix, values, e, scales );
+    vectors = Matrix< V > { n, n };
+    eigen::tridiagonal ( n,
+                         values.data ( ),
+                         e.data ( ),
+                         vectors.data ( ),
+                         vectors.leadingDimension ( ) );
+    eigen::unreflect ( a,
+                       ld,
+                       std::size_t { 1 },
+                       n,
+                       std::size_t { 1 },
+                       scales.size ( ),
+                       scales.data ( ),
+                       vectors );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::SymmetricEigen< V >::size ( ) const noexcept
+{
+    return values.size ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::vector< V > const &ml::SymmetricEigen< V >::eigenvalues ( ) const noexcept
+{
+    return values;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > const &ml::SymmetricEigen< V >::eigenvectors ( ) const noexcept
+{
+    return vectors;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::SVD< V >::SVD ( Matrix< V > matrix )
+{
+    using std::sqrt;
+    std::size_t const m = matrix.rowCount ( );
+    std::size_t const n = matrix.colCount ( );
+    if ( m < n )
+    {
+        // A = V * S * transpose ( U ) from transpose ( A ).
+        SVD< V > other { Matrix< V > ( matrix.view ( ).transpose ( ) ) };
+        left   = std::move ( other.right );
+        values = std::move ( other.values );
+        right  = std::move ( other.left );
+        return;
+    }
+    if ( n == 0 )
+    {
+        return;
+    }
+
+    // A = Q * R, and R = QL * B * transpose ( QR ).
+    QR< V > const     factors { std::move ( matrix ) };
+    Matrix< V >       r  = factors.r ( );
+    std::size_t const ld = r.leadingDimension ( );
+    std::vector< V >  diagonal, super, leftScales, rightScales;
+    eigen::bidiagonalize ( r, diagonal, super, leftScales, rightScales );
+
+    // the 2n x 2n tridiagonal matrix with B's elements interleaved beside a
+    // zero diagonal, whose eigenvector for sigma is ( v0, u0, v1, u1, ... )
+    // over the square root of two.
+    std::size_t const size = 2 * n;
+    std::vector< V >  d ( size, V { 0 } ), e ( size - 1, V { 0 } );
+    for ( std::size_t k = 0; k < n; k++ )
+    {
+        e [ 2 * k ] = diagonal [ k ];
+        if ( k + 1 < n )
+        {
+            e [ 2 * k + 1 ] = super [ k ];
+        }
+    }
+    Matrix< V > z { size, size };
+    eigen::tridiagonal ( size,
+                         d.data ( ),
+                         e.data ( ),
+                         z.data ( ),
+                         z.leadingDimension ( ) );
+
+    values.resize ( n );
+    Matrix< V > ub { n, n };
+    Matrix< V > vb { n, n };
+    for ( std::size_t c = 0; c < n; c++ )
+    {
+        std::size_t const col = size - 1 - c;
+        V                 lu  = V { 0 };
+        V                 lv  = V { 0 };
+        values [ c ]          = std::max ( d [ col ], V { 0 } );
+        for ( std::size_t k = 0; k < n; k++ )
+        {
+            vb [ k ][ c ] = z [ 2 * k ][ col ];
+            ub [ k ][ c ] = z [ 2 * k + 1 ][ col ];
+            lv += vb [ k ][ c ] * vb [ k ][ c ];
+            lu += ub [ k ][ c ] * ub [ k ][ c ];
+        }
+        lu = lu == V { 0 } ? V { 1 } : sqrt ( lu );
+        lv = lv == V { 0 } ? V { 1 } : sqrt ( lv );
+        for ( std::size_t k = 0; k < n; k++ )
+        {
+            ub [ k ][ c ] /= lu;
+            vb [ k ][ c ] /= lv;
+        }
+    }
+    // the eigenvectors of sigma and -sigma mix when sigma is lost in the
+    // rounding, so those singular vectors are made up instead.
+    V const tolerance =
+            V ( m ) * std::numeric_limits< V >::epsilon ( ) * values [ 0 ];
+    std::size_t rank = 0;
+    while ( rank < n && values [ rank ] > tolerance ) { rank++; }
+    if ( rank < n )
+    {
+        eigen::complete ( ub, rank );
+        eigen::complete ( vb, rank );
+    }
+
+    eigen::unreflect ( r.data ( ),
+                       ld,
+                       std::size_t { 1 },
+                       n,
+                       std::size_t { 0 },
+                       n,
+                       leftScales.data ( ),
+                       ub );
+    eigen::unreflect ( r.data ( ),
+                       std::size_t { 1 },
+                       ld,
+                       n,
+                       std::size_t { 1 },
+                       n - 1,
+                       rightScales.data ( ),
+                       vb );
+    left  = factors.q ( ).view ( ) * ub.view ( );
+    right = std::move ( vb );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::vector< V > const &ml::SVD< V >::singularValues ( ) const noexcept
+{
+    return values;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > const &ml::SVD< V >::u ( ) const noexcept
+{
+    return left;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > const &ml::SVD< V >::v ( ) const noexcept
+{
+    return right;
+}
@@ -0,0 +1,255 @@
+/**
+ * @file expression.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Element-wise arithmetic on matrices that waits until it has
+ * somewhere to go.
+ * @details Adding, subtracting, or scaling matrices builds a small tree that
+ * says how to compute each element instead of computing anything. Assigning
+ * the tree to a Matrix then runs one loop that computes every element of the
+ * whole expression at once, so A * a + B * b - C reads each input once and
+ * allocates only the result (or nothing when the result already has the
+ * right shape). The simplest trees, A + B, A - B, A * s and A / s of one
+ * element type, run each row through the vectorized kernels instead.
+ * @note The tree refers to the matrices in it, so do not keep an expression
+ * (e.g., with auto) past the end of the statement that makes it. Assign it
+ * to a Matrix instead.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "../thread/pool.hh"
+#include "kernels.hh"
+#include "meta.hh"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ml
+{
+    template < CONCEPT_NAMESPACE Floating V > class Matrix;
+
+    /**
+     * @brief Whether S multiplies and divides matrices element by element.
+     * Specialize this for number types that are not built into C++.
+     */
+    template < class S > struct IsScalar : std::is_arithmetic< S >
+    {
+    };
+
+    /**
+     * @brief The base of everything that can appear in an element-wise
+     * expression, Matrix included. E is the type deriving from this.
+     */
+    template < class E > struct Expression
+    {
+        E const &self ( ) const NOEXCEPT
+        {
+            return static_cast< E const & > ( *this );
+        }
+    };
+
+    namespace expression
+    {
+        // a Matrix inside of an expression.
+        template < class V > struct Dense : Expression< Dense< V > >
+        {
+            using Value = V;
+
+            V const    *origin;
+            std::size_t nRows;
+            std::size_t nCols;
+            std::size_t leading;
+
+            Dense ( V const    *origin,
+                    std::size_t rows,
+                    std::size_t cols,
+                    std::size_t leading ) NOEXCEPT : origin ( origin ),
+                                                     nRows ( rows ),
+                                                     nCols ( cols ),
+                                                     leading ( leading )
+            {
+            }
+
+            std::size_t rowCount ( ) const NOEXCEPT { return nRows; }
+            std::size_t colCount ( ) const NOEXCEPT { return nCols; }
+
+            Value operator( ) ( std::size_t i, std::size_t j ) const NOEXCEPT
+            {
+                return origin [ i * leading + j ];
+            }
+        };
+
+        // how an expression is stored inside of a bigger one: matrices by
+        // reference to their elements, everything else by value.
+        template < class E > struct Operand
+        {
+            using Type = E;
+
+            static E const &of ( E const &e ) NOEXCEPT { return e; }
+        };
+
+        template < class V > struct Operand< Matrix< V > >
+        {
+            using Type = Dense< V >;
+
+            static Dense< V > of ( Matrix< V > const &m ) NOEXCEPT
+            {
+                return Dense< V > { m.data ( ),
+                                    m.rowCount ( ),
+                                    m.colCount ( ),
+                                    m.leadingDimension ( ) };
+            }
+        };
+
+        template < class E > using OperandOf = typename Operand< E >::Type;
+
+        struct Add
+        {
+            template < class L, class R >
+            static auto apply ( L const &l, R const &r ) -> decltype ( l + r )
+            {
+                return l + r;
+            }
+        };
+
+        struct Sub
+        {
+            template < class L, class R >
+            static auto apply ( L const &l, R const &r ) -> decltype ( l - r )
+            {
+                return l - r;
+            }
+        };
+
+        struct Mul
+        {
+            template < class L, class R >
+            static auto apply ( L const &l, R const &r ) -> decltype ( l * r )
+            {
+                return l * r;
+            }
+        };
+
+        struct Div
+        {
+            template < class L, class R >
+            static auto apply ( L const &l, R const &r ) -> decltype ( l / r )
+            {
+                return l / r;
+            }
+        };
+
+        // two expressions of the same shape, combined element by element.
+        template < class L, class R, class Op >
+        struct Binary : Expression< Binary< L, R, Op > >
+        {
+            using Value = decltype ( Op::apply ( std::declval< typename L::Value > ( ),
+                                                 std::declval< typename R::Value > ( ) ) );
+
+            L lhs;
+            R rhs;
+
+            Binary ( L const &lhs, R const &rhs ) : lhs ( lhs ), rhs ( rhs ) { }
+
+            std::size_t rowCount ( ) const NOEXCEPT { return lhs.rowCount ( ); }
+            std::size_t colCount ( ) const NOEXCEPT { return lhs.colCount ( ); }
+
+            Value operator( ) ( std::size_t i, std::size_t j ) const
+            {
+                return Op::apply ( lhs ( i, j ), rhs ( i, j ) );
+            }
+        };
+
+        // every element of an expression combined with the same scalar.
+        template < class E, class S, class Op, bool scalarFirst = false >
+        struct Scalar : Expression< Scalar< E, S, Op, scalarFirst > >
+        {
+            using Value = decltype ( Op::apply ( std::declval< typename E::Value > ( ),
+                                                 std::declval< S > ( ) ) );
+
+            E inner;
+            S scalar;
+
+            Scalar ( E const &inner, S const &scalar ) :
+                inner ( inner ), scalar ( scalar )
+            {
+            }
+
+            std::size_t rowCount ( ) const NOEXCEPT { return inner.rowCount ( ); }
+            std::size_t colCount ( ) const NOEXCEPT { return inner.colCount ( ); }
+
+            Value operator( ) ( std::size_t i, std::size_t j ) const
+            {
+                return scalarFirst ? Op::apply ( scalar, inner ( i, j ) )
+                                   : Op::apply ( inner ( i, j ), scalar );
+            }
+        };
+
+        // the element type a whole expression produces.
+        template < class E > using ValueOf = typename OperandOf< E >::Value;
+
+        /**
+         * @brief Writes every element of e to out, whose rows are ld
+         * elements apart, in one pass split across the thread pool.
+         */
+        template < class X, class E >
+        void evaluate ( Expression< E > const &e, X *out, std::size_t ld );
+
+        /**
+         * @brief Whether two expressions have the same shape and elements.
+         */
+        template < class L, class R >
+        bool equal ( Expression< L > const &lhs, Expression< R > const &rhs );
+    } // namespace expression
+
+    // A + B and A - B, which throw std::out_of_range if the shapes differ.
+    template < class L, class R >
+    expression::Binary< expression::OperandOf< L >,
+                        expression::OperandOf< R >,
+                        expression::Add >
+            operator+ ( Expression< L > const &lhs, Expression< R > const &rhs );
+
+    template < class L, class R >
+    expression::Binary< expression::OperandOf< L >,
+                        expression::OperandOf< R >,
+                        expression::Sub >
+            operator- ( Expression< L > const &lhs, Expression< R > const &rhs );
+
+    // A * s, s * A and A / s
+    template < class E,
+               class S,
+               class = typename std::enable_if< IsScalar< S >::value >::type >
+    expression::Scalar< expression::OperandOf< E >, S, expression::Mul >
+            operator* ( Expression< E > const &lhs, S const &rhs );
+
+    template < class E,
+               class S,
+               class = typename std::enable_if< IsScalar< S >::value >::type >
+    expression::Scalar< expression::OperandOf< E >, S, expression::Mul, true >
+            operator* ( S const &lhs, Expression< E > const &rhs );
+
+    template < class E,
+               class S,
+               class = typename std::enable_if< IsScalar< S >::value >::type >
+    expression::Scalar< expression::OperandOf< E >, S, expression::Div >
+            operator/ ( Expression< E > const &lhs, S const &rhs );
+
+    template < class L, class R >
+    bool operator== ( Expression< L > const &lhs, Expression< R > const &rhs );
+
+    /**
+     * @brief The result of an expression in a new Matrix of the type the
+     * expression produces, for where auto would otherwise keep the
+     * expression itself.
+     */
+    template < class E >
+    Matrix< expression::ValueOf< E > > evaluate ( Expression< E > const &e );
+} // namespace ml
+
+#include "expression.tcc"
@@ -0,0 +1,201 @@
+/**
+ * @file expression.tcc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief This C++ file is meant to be included only in expression.hh
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+
+#include <stdexcept>
+#include <type_traits>
+
+namespace ml
+{
+    namespace expression
+    {
+        // row i of e into row, one element at a time.
+        template < class X, class E, class = void > struct Rows
+        {
+            static void write ( E const &e, std::size_t i, std::size_t cols, X *row )
+            {
+                for ( std::size_t j = 0; j < cols; j++ ) { row [ j ] = X ( e ( i, j ) ); }
+            }
+        };
+
+        // the trees the kernels cover: matrices of X, combined into X.
+        template < class X, class E >
+        using Same = typename std::enable_if<
+                std::is_same< typename E::Value, X >::value >::type;
+
+        template < class X >
+        struct Rows< X, Binary< Dense< X >, Dense< X >, Add >,
+                     Same< X, Binary< Dense< X >, Dense< X >, Add > > >
+        {
+            static void write ( Binary< Dense< X >, Dense< X >, Add > const &e,
+                                std::size_t                             i,
+                                std::size_t                             cols,
+                                X                                      *row )
+            {
+                kernel::add ( cols, e.lhs.origin + i * e.lhs.leading,
+                              e.rhs.origin + i * e.rhs.leading, row );
+            }
+        };
+
+        template < class X >
+        struct Rows< X, Binary< Dense< X >, Dense< X >, Sub >,
+                     Same< X, Binary< Dense< X >, Dense< X >, Sub > > >
+        {
+            static void write ( Binary< Dense< X >, Dense< X >, Sub > const &e,
+                                std::size_t                             i,
+                                std::size_t                             cols,
+                                X                                      *row )
+            {
+                kernel::sub ( cols, e.lhs.origin + i * e.lhs.leading,
+                              e.rhs.origin + i * e.rhs.leading, row );
+            }
+        };
+
+        // s converts to X either way, so the kernels round the same.
+        template < class X, class S, bool scalarFirst >
+        struct Rows< X, Scalar< Dense< X >, S, Mul, scalarFirst >,
+                     Same< X, Scalar< Dense< X >, S, Mul, scalarFirst > > >
+        {
+            static void write ( Scalar< Dense< X >, S, Mul, scalarFirst > const &e,
+                                std::size_t                                   i,
+                                std::size_t                                   cols,
+                                X                                            *row )
+            {
+                kernel::scale ( cols, X ( e.scalar ), e.inner.origin + i * e.inner.leading,
+                                row );
+            }
+        };
+
+        template < class X, class S >
+        struct Rows< X, Scalar< Dense< X >, S, Div >, Same< X, Scalar< Dense< X >, S, Div > > >
+        {
+            static void write ( Scalar< Dense< X >, S, Div > const &e,
+                                std::size_t                        i,
+                                std::size_t                        cols,
+                                X                                 *row )
+            {
+                kernel::divide ( cols, X ( e.scalar ), e.inner.origin + i * e.inner.leading,
+                                 row );
+            }
+        };
+    } // namespace expression
+} // namespace ml
+
+template < class X, class E >
+void ml::expression::evaluate ( Expression< E > const &e, X *out, std::size_t ld )
+{
+    OperandOf< E > const tree = Operand< E >::of ( e.self ( ) );
+    std::size_t const    rows = tree.rowCount ( );
+    std::size_t const    cols = tree.colCount ( );
+    thread::parallelFor (
+            0,
+            rows,
+            thread::grainFor ( rows, cols ),
+            [ & ] ( std::size_t first, std::size_t last ) {
+                for ( std::size_t i = first; i < last; i++ )
+                {
+                    Rows< X, OperandOf< E > >::write ( tree, i, cols, out + i * ld );
+                }
+            } );
+}
+
+template < class L, class R >
+bool ml::expression::equal ( Expression< L > const &lhs, Expression< R > const &rhs )
+{
+    OperandOf< L > const a = Operand< L >::of ( lhs.self ( ) );
+    OperandOf< R > const b = Operand< R >::of ( rhs.self ( ) );
+    if ( a.rowCount ( ) != b.rowCount ( ) || a.colCount ( ) != b.colCount ( ) )
+    {
+        return false;
+    }
+    for ( std::size_t i = 0; i < a.rowCount ( ); i++ )
+    {
+        for ( std::size_t j = 0; j < a.colCount ( ); j++ )
+        {
+            if ( a ( i, j ) != b ( i, j ) )
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template < class L, class R >
+ml::expression::Binary< ml::expression::OperandOf< L >,
+                        ml::expression::OperandOf< R >,
+                        ml::expression::Add >
+        ml::operator+ ( Expression< L > const &lhs, Expression< R > const &rhs )
+{
+    using namespace expression;
+    if ( lhs.self ( ).rowCount ( ) != rhs.self ( ).rowCount ( )
+         || lhs.self ( ).colCount ( ) != rhs.self ( ).colCount ( ) )
+    {
+        throw std::out_of_range ( "Shape mismatch!" );
+    }
+    return Binary< OperandOf< L >, OperandOf< R >, Add > (
+            Operand< L >::of ( lhs.self ( ) ),
+            Operand< R >::of ( rhs.self ( ) ) );
+}
+
+template < class L, class R >
+ml::expression::Binary< ml::expression::OperandOf< L >,
+                        ml::expression::OperandOf< R >,
+                        ml::expression::Sub >
+        ml::operator- ( Expression< L > const &lhs, Expression< R > const &rhs )
+{
+    using namespace expression;
+    if ( lhs.self ( ).rowCount ( ) != rhs.self ( ).rowCount ( )
+         || lhs.self ( ).colCount ( ) != rhs.self ( ).colCount ( ) )
+    {
+        throw std::out_of_range ( "Shape mismatch!" );
+    }
+    return Binary< OperandOf< L >, OperandOf< R >, Sub > (
+            Operand< L >::of ( lhs.self ( ) ),
+            Operand< R >::of ( rhs.self ( ) ) );
+}
+
+template < class E, class S, class >
+ml::expression::Scalar< ml::expression::OperandOf< E >, S, ml::expression::Mul >
+        ml::operator* ( Expression< E > const &lhs, S const &rhs )
+{
+    using namespace expression;
+    return Scalar< OperandOf< E >, S, Mul > ( Operand< E >::of ( lhs.self ( ) ), rhs );
+}
+
+template < class E, class S, class >
+ml::expression::Scalar< ml::expression::OperandOf< E >, S, ml::expression::Mul, true >
+        ml::operator* ( S const &lhs, Expression< E > const &rhs )
+{
+    using namespace expression;
+    return Scalar< OperandOf< E >, S, Mul, true > ( Operand< E >::of ( rhs.self ( ) ),
+                                                    lhs );
+}
+
+template < class E, class S, class >
+ml::expression::Scalar< ml::expression::OperandOf< E >, S, ml::expression::Div >
+        ml::operator/ ( Expression< E > const &lhs, S const &rhs )
+{
+    using namespace expression;
+    return Scalar< OperandOf< E >, S, Div > ( Operand< E >::of ( lhs.self ( ) ), rhs );
+}
+
+template < class L, class R >
+bool ml::operator== ( Expression< L > const &lhs, Expression< R > const &rhs )
+{
+    return expression::equal ( lhs, rhs );
+}
+
+template < class E >
+ml::Matrix< ml::expression::ValueOf< E > > ml::evaluate ( Expression< E > const &e )
+{
+    return Matrix< expression::ValueOf< E > > ( e );
+}
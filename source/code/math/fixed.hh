@@ -0,0 +1,210 @@
+/**
+ * @file fixed.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Matrices whose shape is part of their type.
+ * @details A FixedMatrix keeps its elements inside of itself, so making one
+ * never touches the heap, and every loop over it has a trip count the
+ * compiler knows, so at the small sizes it is meant for (2 x 2 through 8 x 8)
+ * the loops unroll completely. Shapes are checked when compiling: adding a
+ * 2 x 3 to a 3 x 2 or taking the determinant of something that is not square
+ * does not compile. From C++ 14 on, everything but the conversions to and
+ * from Matrix works in constant expressions.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "expression.hh"
+#include "meta.hh"
+#include "view.hh"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ml
+{
+    template < CONCEPT_NAMESPACE Floating V > class Matrix;
+
+    /**
+     * @brief An R x C matrix stored row-major inside of the object itself.
+     * @tparam V the element type.
+     * @tparam R the number of rows.
+     * @tparam C the number of columns.
+     */
+    template < CONCEPT_NAMESPACE Floating V, std::size_t R, std::size_t C >
+    class FixedMatrix
+    {
+        static_assert ( R > 0 && C > 0, "A FixedMatrix cannot be empty!" );
+
+        V elements [ R * C ];
+    public:
+        using Value = V;
+
+        // all zeros.
+        constexpr FixedMatrix ( ) NOEXCEPT : elements { } { }
+
+        // the elements in row-major order, e.g. { a, b, c, d } is [a,b;c,d].
+        template < class... W,
+                   class = typename std::enable_if< sizeof...( W ) == R * C
+                                                    && ( R * C > 1 ) >::type >
+        constexpr FixedMatrix ( W const &...values ) NOEXCEPT :
+            elements { V ( values )... }
+        {
+        }
+
+        /**
+         * @brief Copies a Matrix of the same shape.
+         * @throws std::out_of_range if the shapes differ.
+         */
+        template < CONCEPT_NAMESPACE Floating W >
+        explicit FixedMatrix ( Matrix< W > const &that );
+
+        // the same matrix, on the heap.
+        Matrix< V > toMatrix ( ) const;
+
+        static constexpr std::size_t rowCount ( ) NOEXCEPT { return R; }
+        static constexpr std::size_t colCount ( ) NOEXCEPT { return C; }
+
+        CONSTEXPR14 V &operator( ) ( std::size_t row, std::size_t col ) NOEXCEPT
+        {
+            return elements [ row * C + col ];
+        }
+        constexpr V const &operator( ) ( std::size_t row,
+                                         std::size_t col ) const NOEXCEPT
+        {
+            return elements [ row * C + col ];
+        }
+
+        // element I, J, which does not compile if it is out of range.
+        template < std::size_t I, std::size_t J > CONSTEXPR14 V &at ( ) NOEXCEPT
+        {
+            static_assert ( I < R && J < C, "Element out of range!" );
+            return elements [ I * C + J ];
+        }
+        template < std::size_t I, std::size_t J >
+        constexpr V const &at ( ) const NOEXCEPT
+        {
+            static_assert ( I < R && J < C, "Element out of range!" );
+            return elements [ I * C + J ];
+        }
+
+        CONSTEXPR14 V *data ( ) NOEXCEPT { return elements; }
+        constexpr V const *data ( ) const NOEXCEPT { return elements; }
+
+        // the whole matrix as a view, e.g. to multiply it with a Matrix.
+        MatrixView< V >       view ( ) NOEXCEPT;
+        MatrixView< V const > view ( ) const NOEXCEPT;
+
+        static CONSTEXPR14 FixedMatrix identity ( ) NOEXCEPT;
+
+        CONSTEXPR14 FixedMatrix< V, C, R > transpose ( ) const NOEXCEPT;
+
+        /**
+         * @brief The determinant, written out for 2 x 2 and 3 x 3 and by
+         * elimination with partial pivoting above that.
+         */
+        CONSTEXPR14 V determinant ( ) const NOEXCEPT;
+
+        /**
+         * @brief The inverse, from the adjugate for 2 x 2 and 3 x 3 and by
+         * Gauss-Jordan elimination with partial pivoting above that.
+         * @throws std::runtime_error if the matrix is singular.
+         */
+        CONSTEXPR14 FixedMatrix inverse ( ) const;
+
+        template < CONCEPT_NAMESPACE Floating W >
+        CONSTEXPR14 FixedMatrix &
+                operator+= ( FixedMatrix< W, R, C > const &that ) NOEXCEPT;
+        template < CONCEPT_NAMESPACE Floating W >
+        CONSTEXPR14 FixedMatrix &
+                operator-= ( FixedMatrix< W, R, C > const &that ) NOEXCEPT;
+
+        template < class S,
+                   class = typename std::enable_if< IsScalar< S >::value >::type >
+        CONSTEXPR14 FixedMatrix &operator*= ( S const &scalar ) NOEXCEPT;
+        template < class S,
+                   class = typename std::enable_if< IsScalar< S >::value >::type >
+        CONSTEXPR14 FixedMatrix &operator/= ( S const &scalar ) NOEXCEPT;
+    };
+
+    template < CONCEPT_NAMESPACE Floating V,
+               CONCEPT_NAMESPACE Floating W,
+               std::size_t R,
+               std::size_t C,
+               class X = decltype ( V { 0 } + W { 0 } ) >
+    CONSTEXPR14 FixedMatrix< X, R, C >
+            operator+ ( FixedMatrix< V, R, C > const &lhs,
+                        FixedMatrix< W, R, C > const &rhs ) NOEXCEPT;
+
+    template < CONCEPT_NAMESPACE Floating V,
+               CONCEPT_NAMESPACE Floating W,
+               std::size_t R,
+               std::size_t C,
+               class X = decltype ( V { 0 } + W { 0 } ) >
+    CONSTEXPR14 FixedMatrix< X, R, C >
+            operator- ( FixedMatrix< V, R, C > const &lhs,
+                        FixedMatrix< W, R, C > const &rhs ) NOEXCEPT;
+
+    // the product, which only compiles if the inner dimensions agree.
+    template < CONCEPT_NAMESPACE Floating V,
+               CONCEPT_NAMESPACE Floating W,
+               std::size_t R,
+               std::size_t K,
+               std::size_t C,
+               class X = decltype ( V { 0 } + W { 0 } ) >
+    CONSTEXPR14 FixedMatrix< X, R, C >
+            operator* ( FixedMatrix< V, R, K > const &lhs,
+                        FixedMatrix< W, K, C > const &rhs ) NOEXCEPT;
+
+    // A * s, s * A and A / s
+    template < CONCEPT_NAMESPACE Floating V,
+               std::size_t R,
+               std::size_t C,
+               class S,
+               class = typename std::enable_if< IsScalar< S >::value >::type,
+               class X =
+                       decltype ( std::declval< V > ( ) * std::declval< S > ( ) ) >
+    CONSTEXPR14 FixedMatrix< X, R, C >
+            operator* ( FixedMatrix< V, R, C > const &lhs, S const &rhs ) NOEXCEPT;
+
+    template < CONCEPT_NAMESPACE Floating V,
+               std::size_t R,
+               std::size_t C,
+               class S,
+               class = typename std::enable_if< IsScalar< S >::value >::type,
+               class X =
+                       decltype ( std::declval< S > ( ) * std::declval< V > ( ) ) >
+    CONSTEXPR14 FixedMatrix< X, R, C >
+            operator* ( S const &lhs, FixedMatrix< V, R, C > const &rhs ) NOEXCEPT;
+
+    template < CONCEPT_NAMESPACE Floating V,
+               std::size_t R,
+               std::size_t C,
+               class S,
+               class = typename std::enable_if< IsScalar< S >::value >::type,
+               class X =
+                       decltype ( std::declval< V > ( ) / std::declval< S > ( ) ) >
+    CONSTEXPR14 FixedMatrix< X, R, C >
+            operator/ ( FixedMatrix< V, R, C > const &lhs, S const &rhs ) NOEXCEPT;
+
+    template < CONCEPT_NAMESPACE Floating V,
+               CONCEPT_NAMESPACE Floating W,
+               std::size_t R,
+               std::size_t C >
+    CONSTEXPR14 bool operator== ( FixedMatrix< V, R, C > const &lhs,
+                                  FixedMatrix< W, R, C > const &rhs ) NOEXCEPT;
+
+    template < CONCEPT_NAMESPACE Floating V,
+               CONCEPT_NAMESPACE Floating W,
+               std::size_t R,
+               std::size_t C >
+    CONSTEXPR14 bool operator!= ( FixedMatrix< V, R, C > const &lhs,
+                                  FixedMatrix< W, R, C > const &rhs ) NOEXCEPT;
+} // namespace ml
+
+#include "fixed.tcc"
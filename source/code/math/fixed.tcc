@@ -0,0 +1,449 @@
+/**
+ * @file fixed.tcc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief This C++ file is meant to be included only in fixed.hh
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+
+#include <stdexcept>
+
+namespace ml
+{
+    namespace fixed
+    {
+        // std::abs is not constexpr until C++ 23.
+        template < class V > constexpr V magnitude ( V const &x ) NOEXCEPT
+        {
+            return x < V { 0 } ? -x : x;
+        }
+
+        template < class V >
+        CONSTEXPR14 V determinantOf ( FixedMatrix< V, 1, 1 > const &a ) NOEXCEPT
+        {
+            return a ( 0, 0 );
+        }
+
+        template < class V >
+        CONSTEXPR14 V determinantOf ( FixedMatrix< V, 2, 2 > const &a ) NOEXCEPT
+        {
+            return a ( 0, 0 ) * a ( 1, 1 ) - a ( 0, 1 ) * a ( 1, 0 );
+        }
+
+        template < class V >
+        CONSTEXPR14 V determinantOf ( FixedMatrix< V, 3, 3 > const &a ) NOEXCEPT
+        {
+            // expansion along the first row.
+            return a ( 0, 0 )
+                         * ( a ( 1, 1 ) * a ( 2, 2 ) - a ( 1, 2 ) * a ( 2, 1 ) )
+                 - a ( 0, 1 )
+                           * ( a ( 1, 0 ) * a ( 2, 2 ) - a ( 1, 2 ) * a ( 2, 0 ) )
+                 + a ( 0, 2 )
+                           * ( a ( 1, 0 ) * a ( 2, 1 ) - a ( 1, 1 ) * a ( 2, 0 ) );
+        }
+
+        template < class V, std::size_t N >
+        CONSTEXPR14 V determinantOf ( FixedMatrix< V, N, N > a ) NOEXCEPT
+        {
+            V output = V { 1 };
+            for ( std::size_t k = 0; k < N; k++ )
+            {
+                std::size_t p = k;
+                for ( std::size_t i = k + 1; i < N; i++ )
+                {
+                    if ( magnitude ( a ( i, k ) ) > magnitude ( a ( p, k ) ) )
+                    {
+                        p = i;
+                    }
+                }
+                if ( a ( p, k ) == V { 0 } )
+                {
+                    return V { 0 };
+                }
+                if ( p != k )
+                {
+                    for ( std::size_t j = k; j < N; j++ )
+                    {
+                        V const t = a ( p, j );
+                        a ( p, j ) = a ( k, j );
+                        a ( k, j ) = t;
+                    }
+                    output = -output;
+                }
+                output *= a ( k, k );
+                for ( std::size_t i = k + 1; i < N; i++ )
+                {
+                    V const l = a ( i, k ) / a ( k, k );
+                    for ( std::size_t j = k + 1; j < N; j++ )
+                    {
+                        a ( i, j ) -= l * a ( k, j );
+                    }
+                }
+            }
+            return output;
+        }
+
+        template < class V >
+        CONSTEXPR14 FixedMatrix< V, 1, 1 >
+                inverseOf ( FixedMatrix< V, 1, 1 > const &a )
+        {
+            if ( a ( 0, 0 ) == V { 0 } )
+            {
+                throw std::runtime_error ( "No inverse!" );
+            }
+            FixedMatrix< V, 1, 1 > output;
+            output ( 0, 0 ) = V { 1 } / a ( 0, 0 );
+            return output;
+        }
+
+        template < class V >
+        CONSTEXPR14 FixedMatrix< V, 2, 2 >
+                inverseOf ( FixedMatrix< V, 2, 2 > const &a )
+        {
+            V const det = determinantOf ( a );
+            if ( det == V { 0 } )
+            {
+                throw std::runtime_error ( "No inverse!" );
+            }
+            return FixedMatrix< V, 2, 2 > { a ( 1, 1 ) / det,
+                                            -a ( 0, 1 ) / det,
+                                            -a ( 1, 0 ) / det,
+                                            a ( 0, 0 ) / det };
+        }
+
+        template < class V >
+        CONSTEXPR14 FixedMatrix< V, 3, 3 >
+                inverseOf ( FixedMatrix< V, 3, 3 > const &a )
+        {
+            V const det = determinantOf ( a );
+            if ( det == V { 0 } )
+            {
+                throw std::runtime_error ( "No inverse!" );
+            }
+            // the adjugate (the transposed cofactors) over the determinant.
+            FixedMatrix< V, 3, 3 > output;
+            for ( std::size_t i = 0; i < 3; i++ )
+            {
+                std::size_t const i1 = ( i + 1 ) % 3;
+                std::size_t const i2 = ( i + 2 ) % 3;
+                for ( std::size_t j = 0; j < 3; j++ )
+                {
+                    std::size_t const j1 = ( j + 1 ) % 3;
+                    std::size_t const j2 = ( j + 2 ) % 3;
+                    output ( j, i ) = ( a ( i1, j1 ) * a ( i2, j2 )
+                                        - a ( i1, j2 ) * a ( i2, j1 ) )
+                                    / det;
+                }
+            }
+            return output;
+        }
+
+        template < class V, std::size_t N >
+        CONSTEXPR14 FixedMatrix< V, N, N > inverseOf ( FixedMatrix< V, N, N > a )
+        {
+            FixedMatrix< V, N, N > output = FixedMatrix< V, N, N >::identity ( );
+            // reduce a to the identity while doing the same to output.
+            for ( std::size_t k = 0; k < N; k++ )
+            {
+                std::size_t p = k;
+                for ( std::size_t i = k + 1; i < N; i++ )
+                {
+                    if ( magnitude ( a ( i, k ) ) > magnitude ( a ( p, k ) ) )
+                    {
+                        p = i;
+                    }
+                }
+                if ( a ( p, k ) == V { 0 } )
+                {
+                    throw std::runtime_error ( "No inverse!" );
+                }
+                for ( std::size_t j = 0; j < N; j++ )
+                {
+                    V const t  = a ( p, j );
+                    a ( p, j ) = a ( k, j );
+                    a ( k, j ) = t;
+                    V const u       = output ( p, j );
+                    output ( p, j ) = output ( k, j );
+                    output ( k, j ) = u;
+                }
+                V const pivot = a ( k, k );
+                for ( std::size_t j = 0; j < N; j++ )
+                {
+                    a ( k, j ) /= pivot;
+                    output ( k, j ) /= pivot;
+                }
+                for ( std::size_t i = 0; i < N; i++ )
+                {
+                    if ( i == k )
+                    {
+                        continue;
+                    }
+                    V const l = a ( i, k );
+                    for ( std::size_t j = 0; j < N; j++ )
+                    {
+                        a ( i, j ) -= l * a ( k, j );
+                        output ( i, j ) -= l * output ( k, j );
+                    }
+                }
+            }
+            return output;
+        }
+    } // namespace fixed
+} // namespace ml
+
+template < CONCEPT_NAMESPACE Floating V, std::size_t R, std::size_t C >
+template < CONCEPT_NAMESPACE Floating W >
+ml::FixedMatrix< V, R, C >::FixedMatrix ( Matrix< W > const &that ) : elements { }
+{
+    if ( that.rowCount ( ) != R || that.colCount ( ) != C )
+    {
+        throw std::out_of_range ( "Shape mismatch!" );
+    }
+    view ( ).assign ( that.view ( ) );
+}
+
+template < CONCEPT_NAMESPACE Floating V, std::size_t R, std::size_t C >
+ml::Matrix< V > ml::FixedMatrix< V, R, C >::toMatrix ( ) const
+{
+    return Matrix< V > ( view ( ) );
+}
+
+template < CONCEPT_NAMESPACE Floating V, std::size_t R, std::size_t C >
+ml::MatrixView< V > ml::FixedMatrix< V, R, C >::view ( ) noexcept
+{
+    return MatrixView< V > { elements, R, C, C };
+}
+
+template < CONCEPT_NAMESPACE Floating V, std::size_t R, std::size_t C >
+ml::MatrixView< V const > ml::FixedMatrix< V, R, C >::view ( ) const noexcept
+{
+    return MatrixView< V const > { elements, R, C, C };
+}
+
+template < CONCEPT_NAMESPACE Floating V, std::size_t R, std::size_t C >
+CONSTEXPR14 ml::FixedMatrix< V, R, C >
+        ml::FixedMatrix< V, R, C >::identity ( ) noexcept
+{
+    static_assert ( R == C, "Matrix is not square!" );
+    FixedMatrix output;
+    for ( std::size_t i = 0; i < R; i++ ) { output ( i, i ) = V { 1 }; }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V, std::size_t R, std::size_t C >
+CONSTEXPR14 ml::FixedMatrix< V, C, R >
+        ml::FixedMatrix< V, R, C >::transpose ( ) const noexcept
+{
+    FixedMatrix< V, C, R > output;
+    for ( std::size_t i = 0; i < R; i++ )
+    {
+        for ( std::size_t j = 0; j < C; j++ )
+        {
+            output ( j, i ) = ( *this ) ( i, j );
+        }
+    }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V, std::size_t R, std::size_t C >
+CONSTEXPR14 V ml::FixedMatrix< V, R, C >::determinant ( ) const noexcept
+{
+    static_assert ( R == C, "Matrix is not square!" );
+    return fixed::determinantOf ( *this );
+}
+
+template < CONCEPT_NAMESPACE Floating V, std::size_t R, std::size_t C >
+CONSTEXPR14 ml::FixedMatrix< V, R, C > ml::FixedMatrix< V, R, C >::inverse ( ) const
+{
+    static_assert ( R == C, "Matrix is not square!" );
+    return fixed::inverseOf ( *this );
+}
+
+template < CONCEPT_NAMESPACE Floating V, std::size_t R, std::size_t C >
+template < CONCEPT_NAMESPACE Floating W >
+CONSTEXPR14 ml::FixedMatrix< V, R, C > &ml::FixedMatrix< V, R, C >::operator+= (
+        FixedMatrix< W, R, C > const &that ) noexcept
+{
+    for ( std::size_t i = 0; i < R * C; i++ )
+    {
+        elements [ i ] += that.data ( ) [ i ];
+    }
+    return *this;
+}
+
+template < CONCEPT_NAMESPACE Floating V, std::size_t R, std::size_t C >
+template < CONCEPT_NAMESPACE Floating W >
+CONSTEXPR14 ml::FixedMatrix< V, R, C > &ml::FixedMatrix< V, R, C >::operator-= (
+        FixedMatrix< W, R, C > const &that ) noexcept
+{
+    for ( std::size_t i = 0; i < R * C; i++ )
+    {
+        elements [ i ] -= that.data ( ) [ i ];
+    }
+    return *this;
+}
+
+template < CONCEPT_NAMESPACE Floating V, std::size_t R, std::size_t C >
+template < class S, class >
+CONSTEXPR14 ml::FixedMatrix< V, R, C > &
+        ml::FixedMatrix< V, R, C >::operator*= ( S const &scalar ) noexcept
+{
+    for ( std::size_t i = 0; i < R * C; i++ )
+    {
+        elements [ i ] *= scalar;
+    }
+    return *this;
+}
+
+template < CONCEPT_NAMESPACE Floating V, std::size_t R, std::size_t C >
+template < class S, class >
+CONSTEXPR14 ml::FixedMatrix< V, R, C > &
+        ml::FixedMatrix< V, R, C >::operator/= ( S const &scalar ) noexcept
+{
+    for ( std::size_t i = 0; i < R * C; i++ )
+    {
+        elements [ i ] /= scalar;
+    }
+    return *this;
+}
+
+template < CONCEPT_NAMESPACE Floating V,
+           CONCEPT_NAMESPACE Floating W,
+           std::size_t R,
+           std::size_t C,
+           class X >
+CONSTEXPR14 ml::FixedMatrix< X, R, C >
+        ml::operator+ ( FixedMatrix< V, R, C > const &lhs,
+                        FixedMatrix< W, R, C > const &rhs ) noexcept
+{
+    FixedMatrix< X, R, C > output;
+    for ( std::size_t i = 0; i < R * C; i++ )
+    {
+        output.data ( ) [ i ] = lhs.data ( ) [ i ] + rhs.data ( ) [ i ];
+    }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V,
+           CONCEPT_NAMESPACE Floating W,
+           std::size_t R,
+           std::size_t C,
+           class X >
+CONSTEXPR14 ml::FixedMatrix< X, R, C >
+        ml::operator- ( FixedMatrix< V, R, C > const &lhs,
+                        FixedMatrix< W, R, C > const &rhs ) noexcept
+{
+    FixedMatrix< X, R, C > output;
+    for ( std::size_t i = 0; i < R * C; i++ )
+    {
+        output.data ( ) [ i ] = lhs.data ( ) [ i ] - rhs.data ( ) [ i ];
+    }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V,
+           CONCEPT_NAMESPACE Floating W,
+           std::size_t R,
+           std::size_t K,
+           std::size_t C,
+           class X >
+CONSTEXPR14 ml::FixedMatrix< X, R, C >
+        ml::operator* ( FixedMatrix< V, R, K > const &lhs,
+                        FixedMatrix< W, K, C > const &rhs ) noexcept
+{
+    FixedMatrix< X, R, C > output;
+    for ( std::size_t i = 0; i < R; i++ )
+    {
+        for ( std::size_t p = 0; p < K; p++ )
+        {
+            X const factor = lhs ( i, p );
+            for ( std::size_t j = 0; j < C; j++ )
+            {
+                output ( i, j ) += factor * rhs ( p, j );
+            }
+        }
+    }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V,
+           std::size_t R,
+           std::size_t C,
+           class S,
+           class,
+           class X >
+CONSTEXPR14 ml::FixedMatrix< X, R, C >
+        ml::operator* ( FixedMatrix< V, R, C > const &lhs, S const &rhs ) noexcept
+{
+    FixedMatrix< X, R, C > output;
+    for ( std::size_t i = 0; i < R * C; i++ )
+    {
+        output.data ( ) [ i ] = lhs.data ( ) [ i ] * rhs;
+    }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V,
+           std::size_t R,
+           std::size_t C,
+           class S,
+           class,
+           class X >
+CONSTEXPR14 ml::FixedMatrix< X, R, C >
+        ml::operator* ( S const &lhs, FixedMatrix< V, R, C > const &rhs ) noexcept
+{
+    FixedMatrix< X, R, C > output;
+    for ( std::size_t i = 0; i < R * C; i++ )
+    {
+        output.data ( ) [ i ] = lhs * rhs.data ( ) [ i ];
+    }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V,
+           std::size_t R,
+           std::size_t C,
+           class S,
+           class,
+           class X >
+CONSTEXPR14 ml::FixedMatrix< X, R, C >
+        ml::operator/ ( FixedMatrix< V, R, C > const &lhs, S const &rhs ) noexcept
+{
+    FixedMatrix< X, R, C > output;
+    for ( std::size_t i = 0; i < R * C; i++ )
+    {
+        output.data ( ) [ i ] = lhs.data ( ) [ i ] / rhs;
+    }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V,
+           CONCEPT_NAMESPACE Floating W,
+           std::size_t R,
+           std::size_t C >
+CONSTEXPR14 bool ml::operator== ( FixedMatrix< V, R, C > const &lhs,
+                                  FixedMatrix< W, R, C > const &rhs ) noexcept
+{
+    for ( std::size_t i = 0; i < R * C; i++ )
+    {
+        if ( lhs.data ( ) [ i ] != rhs.data ( ) [ i ] )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template < CONCEPT_NAMESPACE Floating V,
+           CONCEPT_NAMESPACE Floating W,
+           std::size_t R,
+           std::size_t C >
+CONSTEXPR14 bool ml::operator!= ( FixedMatrix< V, R, C > const &lhs,
+                                  FixedMatrix< W, R, C > const &rhs ) noexcept
+{
+    return !( lhs == rhs );
+}
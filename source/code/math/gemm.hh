@@ -0,0 +1,77 @@
+/**
+ * @file gemm.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief General matrix-matrix multiplication on raw, strided memory.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "meta.hh"
+
+#include <cstddef>
+
+namespace ml
+{
+    namespace kernel
+    {
+        /**
+         * @brief Approximate sizes of the data caches that the blocked
+         * kernels try to fit their working sets into. These are on the small
+         * side of current server processors so that they hold on most
+         * machines.
+         */
+        struct CacheSizes
+        {
+            static std::size_t l1 ( ) NOEXCEPT { return 32 * 1024; }
+            static std::size_t l2 ( ) NOEXCEPT { return 1024 * 1024; }
+            static std::size_t l3 ( ) NOEXCEPT { return 4 * 1024 * 1024; }
+        };
+
+        /**
+         * @brief Computes C = alpha * A * B + beta * C where A is m x k, B is
+         * k x n, and C is m x n.
+         * @details A and B are packed (and converted to X) into contiguous
+         * panels sized for the L2 and L1 caches respectively, and a register
+         * blocked micro-kernel produces each mr x nr tile of C. The outer
+         * loop over columns of B keeps the packed panel of B within the L3
+         * cache. Both packed copies are shared, and the tiles of C are spread
+         * across the thread pool.
+         * @note Elements of A live at a [ i * rsa + j * csa ], elements of B
+         * at b [ i * rsb + j * csb ], and elements of C at c [ i * rsc + j ].
+         * Passing swapped strides multiplies by a transpose for free.
+         * @note When beta is zero, C is never read, so it may hold garbage.
+         */
+        template < class X, class V, class W >
+        void gemm ( std::size_t m,
+                    std::size_t n,
+                    std::size_t k,
+                    X           alpha,
+                    V const    *a,
+                    std::size_t rsa,
+                    std::size_t csa,
+                    W const    *b,
+                    std::size_t rsb,
+                    std::size_t csb,
+                    X           beta,
+                    X          *c,
+                    std::size_t rsc );
+
+        /**
+         * @brief Whether a product of this shape is large enough that packing
+         * and blocking pay for themselves.
+         */
+        inline bool worthBlocking ( std::size_t m,
+                                    std::size_t n,
+                                    std::size_t k ) NOEXCEPT
+        {
+            return m * n * k >= 32 * 32 * 32;
+        }
+    } // namespace kernel
+} // namespace ml
+
+#include "gemm.tcc"
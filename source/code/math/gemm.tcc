@@ -0,0 +1,357 @@
+/**
+ * @file gemm.tcc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief This C++ file is meant to be included only in gemm.hh
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+
+#include "../thread/pool.hh"
+#include "simd.hh"
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+namespace ml
+{
+    namespace kernel
+    {
+        template < class X, std::size_t MR, std::size_t NR >
+        void genericMicroKernel ( std::size_t kc,
+                                  X const    *a,
+                                  X const    *b,
+                                  X          *c,
+                                  std::size_t rsc,
+                                  X           alpha,
+                                  X           beta )
+        {
+            X ab [ MR * NR ];
+            for ( std::size_t i = 0; i < MR * NR; i++ ) { ab [ i ] = X { 0 }; }
+            for ( std::size_t p = 0; p < kc; p++ )
+            {
+                for ( std::size_t i = 0; i < MR; i++ )
+                {
+                    X const ai = a [ p * MR + i ];
+                    for ( std::size_t j = 0; j < NR; j++ )
+                    {
+                        ab [ i * NR + j ] += ai * b [ p * NR + j ];
+                    }
+                }
+            }
+            for ( std::size_t i = 0; i < MR; i++ )
+            {
+                for ( std::size_t j = 0; j < NR; j++ )
+                {
+                    X &out = c [ i * rsc + j ];
+                    out    = beta == X { 0 } ? alpha * ab [ i * NR + j ]
+                                             : beta * out + alpha * ab [ i * NR + j ];
+                }
+            }
+        }
+
+        template < class X > MicroKernel< X > microKernel ( )
+        {
+            return MicroKernel< X > { 4, 4, &genericMicroKernel< X, 4, 4 > };
+        }
+
+        // Single, Double and DoubleDouble use the kernels picked for this
+        // processor.
+        template <> inline MicroKernel< Single > microKernel< Single > ( )
+        {
+            return simd::singles ( ).gemm;
+        }
+
+        template <> inline MicroKernel< Double > microKernel< Double > ( )
+        {
+            return simd::doubles ( ).gemm;
+        }
+
+        template <>
+        inline MicroKernel< DoubleDouble > microKernel< DoubleDouble > ( )
+        {
+            return simd::doubleDoubles ( ).gemm;
+        }
+
+        /**
+         * @brief Copies an mc x kc block of A into panels of mr rows. Within a
+         * panel, the mr elements of each column are adjacent. Rows past the
+         * edge of A are zero so the micro-kernel never needs to special-case
+         * them.
+         */
+        template < class X, class V >
+        void packA ( std::size_t mc,
+                     std::size_t kc,
+                     std::size_t mr,
+                     V const    *a,
+                     std::size_t rsa,
+                     std::size_t csa,
+                     X          *packed )
+        {
+            for ( std::size_t ir = 0; ir < mc; ir += mr )
+            {
+                std::size_t const rows = std::min ( mr, mc - ir );
+                for ( std::size_t p = 0; p < kc; p++ )
+                {
+                    V const *column = a + ir * rsa + p * csa;
+                    std::size_t i   = 0;
+                    for ( ; i < rows; i++ ) { packed [ i ] = X ( column [ i * rsa ] ); }
+                    for ( ; i < mr; i++ ) { packed [ i ] = X { 0 }; }
+                    packed += mr;
+                }
+            }
+        }
+
+        /**
+         * @brief Copies a kc x nc block of B into panels of nr columns. Within
+         * a panel, the nr elements of each row are adjacent. Columns past the
+         * edge of B are zero.
+         */
+        template < class X, class W >
+        void packB ( std::size_t kc,
+                     std::size_t nc,
+                     std::size_t nr,
+                     W const    *b,
+                     std::size_t rsb,
+                     std::size_t csb,
+                     X          *packed )
+        {
+            for ( std::size_t jr = 0; jr < nc; jr += nr )
+            {
+                std::size_t const cols = std::min ( nr, nc - jr );
+                for ( std::size_t p = 0; p < kc; p++ )
+                {
+                    W const *row  = b + p * rsb + jr * csb;
+                    std::size_t j = 0;
+                    for ( ; j < cols; j++ ) { packed [ j ] = X ( row [ j * csb ] ); }
+                    for ( ; j < nr; j++ ) { packed [ j ] = X { 0 }; }
+                    packed += nr;
+                }
+            }
+        }
+
+        /**
+         * @brief Runs the micro-kernel over every tile of an mc x nc block of
+         * C. Tiles that hang over the edge of C go through a scratch tile.
+         */
+        template < class X >
+        void macroKernel ( MicroKernel< X > const &micro,
+                           std::size_t             mc,
+                           std::size_t             nc,
+                           std::size_t             kc,
+                           X const                *packedA,
+                           X const                *packedB,
+                           X                       alpha,
+                           X                       beta,
+                           X                      *c,
+                           std::size_t             rsc,
+                           X                      *edge )
+        {
+            for ( std::size_t jr = 0; jr < nc; jr += micro.nr )
+            {
+                std::size_t const cols = std::min ( micro.nr, nc - jr );
+                for ( std::size_t ir = 0; ir < mc; ir += micro.mr )
+                {
+                    std::size_t const rows = std::min ( micro.mr, mc - ir );
+                    X const *a             = packedA + ir * kc;
+                    X const *b             = packedB + jr * kc;
+                    X       *tile          = c + ir * rsc + jr;
+                    if ( rows == micro.mr && cols == micro.nr )
+                    {
+                        micro.run ( kc, a, b, tile, rsc, alpha, beta );
+                        continue;
+                    }
+                    micro.run ( kc, a, b, edge, micro.nr, alpha, X { 0 } );
+                    for ( std::size_t i = 0; i < rows; i++ )
+                    {
+                        for ( std::size_t j = 0; j < cols; j++ )
+                        {
+                            X &out = tile [ i * rsc + j ];
+                            out    = beta == X { 0 }
+                                           ? edge [ i * micro.nr + j ]
+                                           : beta * out + edge [ i * micro.nr + j ];
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Scratch memory that stays with a thread between calls. A
+         * thread that waits on the pool may pick up another product in the
+         * middle of its own, so each nested use gets its own buffer.
+         */
+        template < class X > class Workspace
+        {
+            static std::deque< std::vector< X > > &buffers ( )
+            {
+                thread_local std::deque< std::vector< X > > buffers;
+                return buffers;
+            }
+
+            static std::size_t &depth ( )
+            {
+                thread_local std::size_t depth = 0;
+                return depth;
+            }
+
+            std::vector< X > *buffer;
+        public:
+            explicit Workspace ( std::size_t size )
+            {
+                std::deque< std::vector< X > > &all = buffers ( );
+                if ( depth ( ) == all.size ( ) )
+                {
+                    all.emplace_back ( );
+                }
+                buffer = &all [ depth ( )++ ];
+                buffer->resize ( std::max ( buffer->size ( ), size ) );
+            }
+
+            ~Workspace ( ) { depth ( )--; }
+
+            Workspace ( Workspace const & )            = delete;
+            Workspace &operator= ( Workspace const & ) = delete;
+
+            X *data ( ) NOEXCEPT { return buffer->data ( ); }
+        };
+
+        template < class X >
+        void scale ( std::size_t m, std::size_t n, X beta, X *c, std::size_t rsc )
+        {
+            for ( std::size_t i = 0; i < m; i++ )
+            {
+                for ( std::size_t j = 0; j < n; j++ )
+                {
+                    c [ i * rsc + j ] = beta == X { 0 } ? X { 0 }
+                                                        : beta * c [ i * rsc + j ];
+                }
+            }
+        }
+    } // namespace kernel
+} // namespace ml
+
+template < class X, class V, class W >
+void ml::kernel::gemm ( std::size_t m,
+                        std::size_t n,
+                        std::size_t k,
+                        X           alpha,
+                        V const    *a,
+                        std::size_t rsa,
+                        std::size_t csa,
+                        W const    *b,
+                        std::size_t rsb,
+                        std::size_t csb,
+                        X           beta,
+                        X          *c,
+                        std::size_t rsc )
+{
+    if ( !m || !n )
+    {
+        return;
+    }
+    if ( !k || alpha == X { 0 } )
+    {
+        scale ( m, n, beta, c, rsc );
+        return;
+    }
+
+    MicroKernel< X > const micro = microKernel< X > ( );
+
+    // a kc x nr sliver of B should fill the L1 cache, an mc x kc block of A
+    // half of the L2 cache and a kc x nc panel of B half of the L3 cache.
+    std::size_t kc = CacheSizes::l1 ( ) / ( micro.nr * sizeof ( X ) );
+    kc             = std::max< std::size_t > ( 8, kc - kc % 8 );
+    std::size_t mc = CacheSizes::l2 ( ) / 2 / ( kc * sizeof ( X ) );
+    mc             = std::max ( micro.mr, mc - mc % micro.mr );
+    std::size_t nc = CacheSizes::l3 ( ) / 2 / ( kc * sizeof ( X ) );
+    nc             = std::max ( micro.nr, nc - nc % micro.nr );
+
+    kc = std::min ( kc, k );
+    mc = std::min ( mc, ( m + micro.mr - 1 ) / micro.mr * micro.mr );
+    nc = std::min ( nc, ( n + micro.nr - 1 ) / micro.nr * micro.nr );
+
+    // every thread works from the same packed copies of A and B. All of A
+    // is packed for each pass over k so that threads can share it.
+    std::size_t const panelsA = ( m + micro.mr - 1 ) / micro.mr;
+    Workspace< X >    packedA ( panelsA * micro.mr * kc );
+    Workspace< X >    packedB ( nc * kc );
+
+    // split each block of C into enough tiles that every thread gets a few,
+    // but never narrower than one micro-panel.
+    std::size_t const blocksM = ( m + mc - 1 ) / mc;
+    std::size_t const threads = thread::threadCount ( );
+
+    for ( std::size_t jc = 0; jc < n; jc += nc )
+    {
+        std::size_t const ncur    = std::min ( nc, n - jc );
+        std::size_t const panelsB = ( ncur + micro.nr - 1 ) / micro.nr;
+        std::size_t const wanted  = ( 4 * threads + blocksM - 1 ) / blocksM;
+        std::size_t const blocksN = std::min ( panelsB, wanted );
+        std::size_t const perTile = ( panelsB + blocksN - 1 ) / blocksN;
+        std::size_t const tilesN  = ( panelsB + perTile - 1 ) / perTile;
+        for ( std::size_t pc = 0; pc < k; pc += kc )
+        {
+            std::size_t const kcur = std::min ( kc, k - pc );
+            // only the first pass over k applies beta, the rest accumulate.
+            X const betaNow = pc == 0 ? beta : X { 1 };
+            X      *toB     = packedB.data ( );
+            X      *toA     = packedA.data ( );
+            thread::parallelFor (
+                    0,
+                    panelsB,
+                    thread::grainFor ( panelsB, kcur * micro.nr ),
+                    [ & ] ( std::size_t first, std::size_t last ) {
+                        std::size_t const j = first * micro.nr;
+                        packB ( kcur,
+                                std::min ( last * micro.nr, ncur ) - j,
+                                micro.nr,
+                                b + pc * rsb + ( jc + j ) * csb,
+                                rsb,
+                                csb,
+                                toB + j * kcur );
+                    } );
+            thread::parallelFor (
+                    0,
+                    panelsA,
+                    thread::grainFor ( panelsA, kcur * micro.mr ),
+                    [ & ] ( std::size_t first, std::size_t last ) {
+                        std::size_t const i = first * micro.mr;
+                        packA ( std::min ( last * micro.mr, m ) - i,
+                                kcur,
+                                micro.mr,
+                                a + i * rsa + pc * csa,
+                                rsa,
+                                csa,
+                                toA + i * kcur );
+                    } );
+            thread::parallelFor (
+                    0,
+                    blocksM * tilesN,
+                    1,
+                    [ & ] ( std::size_t first, std::size_t last ) {
+                        Workspace< X > edge ( micro.mr * micro.nr );
+                        for ( std::size_t t = first; t < last; t++ )
+                        {
+                            std::size_t const ic = t / tilesN * mc;
+                            std::size_t const jr = t % tilesN * perTile * micro.nr;
+                            macroKernel ( micro,
+                                          std::min ( mc, m - ic ),
+                                          std::min ( perTile * micro.nr, ncur - jr ),
+                                          kcur,
+                                          toA + ic * kcur,
+                                          toB + jr * kcur,
+                                          alpha,
+                                          betaNow,
+                                          c + ic * rsc + jc + jr,
+                                          rsc,
+                                          edge.data ( ) );
+                        }
+                    } );
+        }
+    }
+}
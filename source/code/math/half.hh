@@ -0,0 +1,239 @@
+/**
+ * @file half.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief 16 bit floating point storage: IEEE half precision and bfloat16.
+ * @details Both are storage types. They hold a value in half the memory of
+ * a Single, and become a Single for any arithmetic, so a Matrix of them
+ * takes half the memory bandwidth to read and its products accumulate in
+ * Single: GEMM widens them as it packs its blocks, and GEMV widens each row
+ * a block at a time before the Single dot kernel.
+ * @note Half has 11 significant bits and a range up to 65504; BFloat16 has
+ * only 8 significant bits but the range of Single. Narrowing rounds to
+ * nearest even, and overflows to infinity.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "meta.hh"
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace ml
+{
+    namespace half
+    {
+        inline std::uint32_t bitsOf ( Single x ) NOEXCEPT
+        {
+            std::uint32_t bits;
+            std::memcpy ( &bits, &x, sizeof bits );
+            return bits;
+        }
+
+        inline Single singleOf ( std::uint32_t bits ) NOEXCEPT
+        {
+            Single x;
+            std::memcpy ( &x, &bits, sizeof x );
+            return x;
+        }
+
+        inline Single widenHalf ( std::uint16_t h ) NOEXCEPT
+        {
+            std::uint32_t const sign     = std::uint32_t ( h & 0x8000u ) << 16;
+            std::uint32_t const exponent = ( h >> 10 ) & 0x1fu;
+            std::uint32_t const mantissa = h & 0x3ffu;
+            if ( exponent == 0 )
+            {
+                // zero or subnormal: mantissa * 2^-24, exact in Single.
+                Single const value = Single ( mantissa ) * 5.9604645e-8f;
+                return sign ? -value : value;
+            }
+            if ( exponent == 0x1f )
+            {
+                return singleOf ( sign | 0x7f800000u | ( mantissa << 13 ) );
+            }
+            return singleOf ( sign | ( ( exponent + 112 ) << 23 )
+                              | ( mantissa << 13 ) );
+        }
+
+        inline std::uint16_t narrowHalf ( Single x ) NOEXCEPT
+        {
+            std::uint32_t       bits = bitsOf ( x );
+            std::uint16_t const sign = std::uint16_t ( ( bits >> 16 ) & 0x8000u );
+            bits &= 0x7fffffffu;
+            if ( bits > 0x7f800000u )
+            {
+                // NaN stays NaN, and quiet.
+                return std::uint16_t ( sign | 0x7e00u | ( ( bits >> 13 ) & 0x3ffu ) );
+            }
+            if ( bits >= 0x477ff000u )
+            {
+                // 65520 and up round past the largest Half, 65504.
+                return std::uint16_t ( sign | 0x7c00u );
+            }
+            if ( bits < 0x38800000u )
+            {
+                // below 2^-14 the result is subnormal. The Single spacing
+                // after 0.5 is 2^-24, that of subnormal Halfs, so adding 0.5
+                // rounds to the Half for us.
+                Single const shifted = singleOf ( bits ) + 0.5f;
+                return std::uint16_t ( sign | ( bitsOf ( shifted ) - 0x3f000000u ) );
+            }
+            // rebias the exponent from 127 to 15 and round the 13 dropped
+            // bits to nearest even; a carry rounds up into the exponent.
+            std::uint32_t const odd = ( bits >> 13 ) & 1u;
+            bits += 0xc8000fffu + odd;
+            return std::uint16_t ( sign | ( bits >> 13 ) );
+        }
+
+        inline Single widenBFloat16 ( std::uint16_t b ) NOEXCEPT
+        {
+            return singleOf ( std::uint32_t ( b ) << 16 );
+        }
+
+        inline std::uint16_t narrowBFloat16 ( Single x ) NOEXCEPT
+        {
+            std::uint32_t const bits = bitsOf ( x );
+            if ( ( bits & 0x7fffffffu ) > 0x7f800000u )
+            {
+                return std::uint16_t ( ( bits >> 16 ) | 0x40u );
+            }
+            // the top 16 bits, rounded to nearest even on the rest.
+            std::uint32_t const odd = ( bits >> 16 ) & 1u;
+            return std::uint16_t ( ( bits + 0x7fffu + odd ) >> 16 );
+        }
+    } // namespace half
+
+    /**
+     * @brief An IEEE 754 binary16 number. Converting from Single rounds and
+     * is explicit; converting to Single is exact and implicit, which is how
+     * any arithmetic on it happens.
+     */
+    class Half
+    {
+        std::uint16_t value = 0;
+    public:
+        constexpr Half ( ) NOEXCEPT = default;
+        explicit Half ( Single x ) NOEXCEPT : value ( half::narrowHalf ( x ) ) { }
+
+        static constexpr Half fromBits ( std::uint16_t bits ) NOEXCEPT
+        {
+            return Half ( bits, 0 );
+        }
+        constexpr std::uint16_t bits ( ) const NOEXCEPT { return value; }
+
+        operator Single ( ) const NOEXCEPT { return half::widenHalf ( value ); }
+    private:
+        constexpr Half ( std::uint16_t bits, int ) NOEXCEPT : value ( bits ) { }
+    };
+
+    /**
+     * @brief The top half of a Single: its sign, all 8 exponent bits, and 7
+     * bits of mantissa. Converts the same ways as Half.
+     */
+    class BFloat16
+    {
+        std::uint16_t value = 0;
+    public:
+        constexpr BFloat16 ( ) NOEXCEPT = default;
+        explicit BFloat16 ( Single x ) NOEXCEPT :
+            value ( half::narrowBFloat16 ( x ) )
+        {
+        }
+
+        static constexpr BFloat16 fromBits ( std::uint16_t bits ) NOEXCEPT
+        {
+            return BFloat16 ( bits, 0 );
+        }
+        constexpr std::uint16_t bits ( ) const NOEXCEPT { return value; }
+
+        operator Single ( ) const NOEXCEPT
+        {
+            return half::widenBFloat16 ( value );
+        }
+    private:
+        constexpr BFloat16 ( std::uint16_t bits, int ) NOEXCEPT : value ( bits )
+        {
+        }
+    };
+
+    template <> struct IsFloating< Half > : std::true_type
+    {
+    };
+
+    template <> struct IsFloating< BFloat16 > : std::true_type
+    {
+    };
+} // namespace ml
+
+namespace std
+{
+    template <> class numeric_limits< ml::Half >
+    {
+        typedef ml::Half H;
+    public:
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed      = true;
+        static constexpr bool is_integer     = false;
+        static constexpr bool is_exact       = false;
+        static constexpr bool has_infinity   = true;
+        static constexpr bool has_quiet_NaN  = true;
+        static constexpr int  digits         = 11;
+        static constexpr int  digits10       = 3;
+        static constexpr int  max_digits10   = 5;
+        static constexpr int  radix          = 2;
+        static constexpr int  min_exponent   = -13;
+        static constexpr int  max_exponent   = 16;
+
+        static constexpr H epsilon ( ) NOEXCEPT { return H::fromBits ( 0x1400 ); }
+        static constexpr H min ( ) NOEXCEPT { return H::fromBits ( 0x0400 ); }
+        static constexpr H max ( ) NOEXCEPT { return H::fromBits ( 0x7bff ); }
+        static constexpr H lowest ( ) NOEXCEPT { return H::fromBits ( 0xfbff ); }
+        static constexpr H infinity ( ) NOEXCEPT
+        {
+            return H::fromBits ( 0x7c00 );
+        }
+        static constexpr H quiet_NaN ( ) NOEXCEPT
+        {
+            return H::fromBits ( 0x7e00 );
+        }
+    };
+
+    template <> class numeric_limits< ml::BFloat16 >
+    {
+        typedef ml::BFloat16 B;
+    public:
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed      = true;
+        static constexpr bool is_integer     = false;
+        static constexpr bool is_exact       = false;
+        static constexpr bool has_infinity   = true;
+        static constexpr bool has_quiet_NaN  = true;
+        static constexpr int  digits         = 8;
+        static constexpr int  digits10       = 2;
+        static constexpr int  max_digits10   = 4;
+        static constexpr int  radix          = 2;
+        static constexpr int  min_exponent   = -125;
+        static constexpr int  max_exponent   = 128;
+
+        static constexpr B epsilon ( ) NOEXCEPT { return B::fromBits ( 0x3c00 ); }
+        static constexpr B min ( ) NOEXCEPT { return B::fromBits ( 0x0080 ); }
+        static constexpr B max ( ) NOEXCEPT { return B::fromBits ( 0x7f7f ); }
+        static constexpr B lowest ( ) NOEXCEPT { return B::fromBits ( 0xff7f ); }
+        static constexpr B infinity ( ) NOEXCEPT
+        {
+            return B::fromBits ( 0x7f80 );
+        }
+        static constexpr B quiet_NaN ( ) NOEXCEPT
+        {
+            return B::fromBits ( 0x7fc0 );
+        }
+    };
+} // namespace std
@@ -0,0 +1,247 @@
+/**
+ * @file kernels.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Vector and matrix-vector kernels on raw spans of memory.
+ * @details The templates work for any mix of element types. When every
+ * operand is the same Single, Double or DoubleDouble, overload resolution
+ * picks the non-template versions instead, which call the SIMD kernels
+ * picked for the processor. A gemv of Half or BFloat16 rows with Single
+ * vectors widens each row a block at a time and takes the Single dot
+ * kernel, so it reads half the memory of a Single gemv at the same speed
+ * of arithmetic.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "meta.hh"
+#include "simd.hh"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace ml
+{
+    namespace kernel
+    {
+        // y = alpha * A * x + beta * y, where A is m x n and its rows are lda
+        // elements apart. y is not read when beta is zero.
+        template < class X, class V, class W >
+        void gemv ( std::size_t m,
+                    std::size_t n,
+                    X           alpha,
+                    V const    *a,
+                    std::size_t lda,
+                    W const    *x,
+                    X           beta,
+                    X          *y )
+        {
+            for ( std::size_t i = 0; i < m; i++ )
+            {
+                X t = X { 0 };
+                for ( std::size_t j = 0; j < n; j++ )
+                {
+                    t += a [ i * lda + j ] * x [ j ];
+                }
+                y [ i ] = beta == X { 0 } ? alpha * t : alpha * t + beta * y [ i ];
+            }
+        }
+
+        // y = alpha * x + y
+        template < class X, class W >
+        void axpy ( std::size_t n, X alpha, W const *x, X *y )
+        {
+            for ( std::size_t i = 0; i < n; i++ ) { y [ i ] += alpha * x [ i ]; }
+        }
+
+        // z = x + y
+        template < class X, class V, class W >
+        void add ( std::size_t n, V const *x, W const *y, X *z )
+        {
+            for ( std::size_t i = 0; i < n; i++ ) { z [ i ] = x [ i ] + y [ i ]; }
+        }
+
+        // z = x - y
+        template < class X, class V, class W >
+        void sub ( std::size_t n, V const *x, W const *y, X *z )
+        {
+            for ( std::size_t i = 0; i < n; i++ ) { z [ i ] = x [ i ] - y [ i ]; }
+        }
+
+        // z = alpha * x
+        template < class X, class V, class W >
+        void scale ( std::size_t n, W alpha, V const *x, X *z )
+        {
+            for ( std::size_t i = 0; i < n; i++ ) { z [ i ] = alpha * x [ i ]; }
+        }
+
+        // z = x / alpha
+        template < class X, class V, class W >
+        void divide ( std::size_t n, W alpha, V const *x, X *z )
+        {
+            for ( std::size_t i = 0; i < n; i++ ) { z [ i ] = x [ i ] / alpha; }
+        }
+
+        // z = alpha * x * y + z, element by element
+        template < class X, class V, class W >
+        void multiplyAdd ( std::size_t n, X alpha, V const *x, W const *y, X *z )
+        {
+            for ( std::size_t i = 0; i < n; i++ )
+            {
+                z [ i ] += alpha * x [ i ] * y [ i ];
+            }
+        }
+
+        // z = x / y, element by element
+        template < class X, class V, class W >
+        void quotient ( std::size_t n, V const *x, W const *y, X *z )
+        {
+            for ( std::size_t i = 0; i < n; i++ ) { z [ i ] = x [ i ] / y [ i ]; }
+        }
+
+        // swaps x [ i ] and y [ i ] wherever |c [ i ]| > |t [ i ]|. x and y
+        // may be t and c.
+        template < class X >
+        void pivot ( std::size_t n, X const *t, X const *c, X *x, X *y )
+        {
+            for ( std::size_t i = 0; i < n; i++ )
+            {
+                bool const swap = ( c [ i ] < 0 ? -c [ i ] : c [ i ] )
+                                > ( t [ i ] < 0 ? -t [ i ] : t [ i ] );
+                X const    lo   = swap ? y [ i ] : x [ i ];
+                X const    hi   = swap ? x [ i ] : y [ i ];
+                x [ i ]         = lo;
+                y [ i ]         = hi;
+            }
+        }
+
+#define ML_ACCELERATED_KERNELS( TYPE, TABLE )                                  \
+    inline void gemv ( std::size_t m,                                          \
+                       std::size_t n,                                          \
+                       TYPE        alpha,                                      \
+                       TYPE const *a,                                          \
+                       std::size_t lda,                                        \
+                       TYPE const *x,                                          \
+                       TYPE        beta,                                       \
+                       TYPE       *y )                                         \
+    {                                                                          \
+        simd::TABLE ( ).gemv ( m, n, alpha, a, lda, x, beta, y );              \
+    }                                                                          \
+    inline void axpy ( std::size_t n, TYPE alpha, TYPE const *x, TYPE *y )     \
+    {                                                                          \
+        simd::TABLE ( ).axpy ( n, alpha, x, y );                               \
+    }                                                                          \
+    inline void add ( std::size_t n, TYPE const *x, TYPE const *y, TYPE *z )   \
+    {                                                                          \
+        simd::TABLE ( ).add ( n, x, y, z );                                    \
+    }                                                                          \
+    inline void sub ( std::size_t n, TYPE const *x, TYPE const *y, TYPE *z )   \
+    {                                                                          \
+        simd::TABLE ( ).sub ( n, x, y, z );                                    \
+    }                                                                          \
+    inline void scale ( std::size_t n, TYPE alpha, TYPE const *x, TYPE *z )    \
+    {                                                                          \
+        simd::TABLE ( ).scale ( n, alpha, x, z );                              \
+    }                                                                          \
+    inline void divide ( std::size_t n, TYPE alpha, TYPE const *x, TYPE *z )   \
+    {                                                                          \
+        simd::TABLE ( ).divide ( n, alpha, x, z );                             \
+    }                                                                          \
+    inline void multiplyAdd ( std::size_t n,                                   \
+                              TYPE        alpha,                               \
+                              TYPE const *x,                                   \
+                              TYPE const *y,                                   \
+                              TYPE       *z )                                  \
+    {                                                                          \
+        simd::TABLE ( ).multiplyAdd ( n, alpha, x, y, z );                     \
+    }                                                                          \
+    inline void quotient ( std::size_t n, TYPE const *x, TYPE const *y, TYPE *z )\
+    {                                                                          \
+        simd::TABLE ( ).quotient ( n, x, y, z );                               \
+    }                                                                          \
+    inline void pivot ( std::size_t n,                                         \
+                        TYPE const *t,                                         \
+                        TYPE const *c,                                         \
+                        TYPE       *x,                                         \
+                        TYPE       *y )                                        \
+    {                                                                          \
+        simd::TABLE ( ).pivot ( n, t, c, x, y );                               \
+    }
+
+        ML_ACCELERATED_KERNELS ( Single, singles )
+        ML_ACCELERATED_KERNELS ( Double, doubles )
+        ML_ACCELERATED_KERNELS ( DoubleDouble, doubleDoubles )
+
+#undef ML_ACCELERATED_KERNELS
+
+        // gemv of 16 bit rows, widened a panel of rows by columns at a
+        // time by widen into a buffer on the stack, which the Single gemv
+        // kernel then accumulates into a column of Singles.
+        template < class S >
+        void widenedGemv ( std::size_t   m,
+                           std::size_t   n,
+                           Single        alpha,
+                           S const      *a,
+                           std::size_t   lda,
+                           Single const *x,
+                           Single        beta,
+                           Single       *y,
+                           void ( *widen ) ( std::size_t, S const *, Single * ) )
+        {
+            std::size_t const rows = 8, columns = 512;
+            Single            panel [ rows * columns ], t [ rows ];
+            auto const        kernel = simd::singles ( ).gemv;
+            for ( std::size_t i = 0; i < m; i += rows )
+            {
+                std::size_t const height = std::min ( rows, m - i );
+                for ( std::size_t j = 0; j < n; j += columns )
+                {
+                    std::size_t const width = std::min ( columns, n - j );
+                    for ( std::size_t r = 0; r < height; r++ )
+                    {
+                        widen ( width, a + ( i + r ) * lda + j,
+                                panel + r * columns );
+                    }
+                    kernel ( height, width, 1, panel, columns, x + j,
+                             j == 0 ? 0 : 1, t );
+                }
+                for ( std::size_t r = 0; r < height; r++ )
+                {
+                    Single const sum = n == 0 ? 0 : t [ r ];
+                    y [ i + r ]      = beta == 0 ? alpha * sum
+                                                 : alpha * sum + beta * y [ i + r ];
+                }
+            }
+        }
+
+        inline void gemv ( std::size_t   m,
+                           std::size_t   n,
+                           Single        alpha,
+                           Half const   *a,
+                           std::size_t   lda,
+                           Single const *x,
+                           Single        beta,
+                           Single       *y )
+        {
+            widenedGemv ( m, n, alpha, a, lda, x, beta, y,
+                          simd::widening ( ).halves );
+        }
+
+        inline void gemv ( std::size_t     m,
+                           std::size_t     n,
+                           Single          alpha,
+                           BFloat16 const *a,
+                           std::size_t     lda,
+                           Single const   *x,
+                           Single          beta,
+                           Single         *y )
+        {
+            widenedGemv ( m, n, alpha, a, lda, x, beta, y,
+                          simd::widening ( ).bfloat16s );
+        }
+    } // namespace kernel
+} // namespace ml
@@ -0,0 +1,122 @@
+/**
+ * @file lowrank.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Low rank approximations of matrices, and matrices kept as the
+ * product of two thin factors.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "eigen.hh"
+#include "matrix.hh"
+#include "qr.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ml
+{
+    /**
+     * @brief An m x n matrix kept as the product L * R of an m x k matrix L
+     * and a k x n matrix R. For k much smaller than m and n this stores
+     * k * ( m + n ) elements instead of m * n, and a product with a vector
+     * is two thin matrix-vector products costing O(k * ( m + n )) instead of
+     * O(m * n), e.g. for a dense layer replaced by its low rank
+     * approximation.
+     */
+    template < CONCEPT_NAMESPACE Floating V > class FactoredMatrix
+    {
+        Matrix< V > lhs;
+        Matrix< V > rhs;
+    public:
+        FactoredMatrix ( ) = default;
+
+        // throws std::out_of_range if left has a different number of
+        // columns than right has rows.
+        FactoredMatrix ( Matrix< V > left, Matrix< V > right );
+
+        std::size_t rowCount ( ) const NOEXCEPT;
+        std::size_t colCount ( ) const NOEXCEPT;
+        // k, the inner dimension of the factors.
+        std::size_t rank ( ) const NOEXCEPT;
+
+        Matrix< V > const &left ( ) const NOEXCEPT;
+        Matrix< V > const &right ( ) const NOEXCEPT;
+
+        // the product of the factors, as a dense m x n matrix.
+        Matrix< V > toMatrix ( ) const;
+
+        // L * ( R * x ), never forming L * R.
+        template < CONCEPT_NAMESPACE Floating W = V,
+                   CONCEPT_NAMESPACE Floating X = decltype ( V { 0 }
+                                                             + W { 0 } ) >
+        std::vector< X > operator* ( std::vector< W > const &input ) const;
+
+        // L * ( R * B ), as two GEMMs through the k x p middle.
+        template < CONCEPT_NAMESPACE Floating W = V,
+                   CONCEPT_NAMESPACE Floating X = decltype ( V { 0 }
+                                                             + W { 0 } ) >
+        Matrix< X > operator* ( Matrix< W > const &that ) const;
+    };
+
+    /**
+     * @brief An m x size matrix with orthonormal columns whose span nearly
+     * holds the range of A: the randomized range finder. A is multiplied by
+     * a size column Gaussian test matrix, and then by transpose ( A ) and A
+     * again iterations more times, orthonormalizing by QR in between, which
+     * sharpens the result when the singular values of A decay slowly.
+     * @details Everything but the small QRs is a product with A through the
+     * blocked, threaded GEMM. The same seed gives the same result.
+     * @throws std::out_of_range if size is zero or more than min ( m, n ).
+     */
+    template < CONCEPT_NAMESPACE Floating V >
+    Matrix< V > randomizedRange ( Matrix< V > const &a,
+                                  std::size_t        size,
+                                  std::size_t        iterations = 2,
+                                  std::uint64_t      seed       = 0 );
+
+    /**
+     * @brief The leading rank singular values and vectors of an m x n
+     * matrix A, approximately, in O(m * n * rank) time instead of the
+     * O(m * n * min ( m, n )) of SVD.
+     * @details With Q from randomizedRange with rank + oversample columns,
+     * A is close to Q * transpose ( Q ) * A. The SVD of the small matrix
+     * transpose ( Q ) * A = W * S * transpose ( V ) then gives U = Q * W,
+     * S, and V, of which the first rank are kept. The extra columns make the
+     * kept ones accurate; the error is near the first singular value that
+     * is dropped.
+     * @throws std::out_of_range if rank is zero or more than min ( m, n ).
+     */
+    template < CONCEPT_NAMESPACE Floating V > class RandomizedSVD
+    {
+        Matrix< V >      left;
+        std::vector< V > values;
+        Matrix< V >      right;
+    public:
+        RandomizedSVD ( Matrix< V > const &matrix,
+                        std::size_t        rank,
+                        std::size_t        oversample = 10,
+                        std::size_t        iterations = 2,
+                        std::uint64_t      seed       = 0 );
+
+        std::size_t rank ( ) const NOEXCEPT;
+
+        // in descending order.
+        std::vector< V > const &singularValues ( ) const NOEXCEPT;
+
+        // m x rank and n x rank, with orthonormal columns.
+        Matrix< V > const &u ( ) const NOEXCEPT;
+        Matrix< V > const &v ( ) const NOEXCEPT;
+
+        // the approximation as ( U * diag ( S ) ) * transpose ( V ).
+        FactoredMatrix< V > factored ( ) const;
+    };
+} // namespace ml
+
+#include "lowrank.tcc"
@@ -0,0 +1,193 @@
+/**
+ * @file lowrank.tcc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief This C++ file is meant to be included only in lowrank.hh
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::FactoredMatrix< V >::FactoredMatrix ( Matrix< V > left,
+                                          Matrix< V > right ) :
+    lhs ( std::move ( left ) ), rhs ( std::move ( right ) )
+{
+    if ( lhs.colCount ( ) != rhs.rowCount ( ) )
+    {
+        throw std::out_of_range ( "Inner dimension mismatch!" );
+    }
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::FactoredMatrix< V >::rowCount ( ) const noexcept
+{
+    return lhs.rowCount ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::FactoredMatrix< V >::colCount ( ) const noexcept
+{
+    return rhs.colCount ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::FactoredMatrix< V >::rank ( ) const noexcept
+{
+    return lhs.colCount ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > const &ml::FactoredMatrix< V >::left ( ) const noexcept
+{
+    return lhs;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > const &ml::FactoredMatrix< V >::right ( ) const noexcept
+{
+    return rhs;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > ml::FactoredMatrix< V >::toMatrix ( ) const
+{
+    return lhs.view ( ) * rhs.view ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+template < CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X >
+std::vector< X >
+ml::FactoredMatrix< V >::operator* ( std::vector< W > const &input ) const
+{
+    if ( input.size ( ) != colCount ( ) )
+    {
+        throw std::out_of_range ( "Vector length mismatch!" );
+    }
+    std::vector< X > middle ( rank ( ) );
+    std::vector< X > output ( rowCount ( ) );
+    gemv< X > ( 1, rhs, input.data ( ), 0, middle.data ( ) );
+    gemv< X > ( 1, lhs, middle.data ( ), 0, output.data ( ) );
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+template < CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X >
+ml::Matrix< X >
+ml::FactoredMatrix< V >::operator* ( Matrix< W > const &that ) const
+{
+    if ( that.rowCount ( ) != colCount ( ) )
+    {
+        throw std::out_of_range ( "Row count mismatch!" );
+    }
+    Matrix< X > middle { rank ( ), that.colCount ( ) };
+    Matrix< X > output { rowCount ( ), that.colCount ( ) };
+    gemm< X > ( 1, rhs, that, 0, middle );
+    gemm< X > ( 1, lhs, middle, 0, output );
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > ml::randomizedRange ( Matrix< V > const &a,
+                                      std::size_t        size,
+                                      std::size_t        iterations,
+                                      std::uint64_t      seed )
+{
+    std::size_t const m = a.rowCount ( );
+    std::size_t const n = a.colCount ( );
+    if ( size == 0 || size > std::min ( m, n ) )
+    {
+        throw std::out_of_range ( "Range size is out of range!" );
+    }
+    // drawn as doubles so that every element type sees the same numbers.
+    std::mt19937_64                    engine { seed };
+    std::normal_distribution< double > normal;
+    Matrix< V >                        omega { n, size };
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        for ( std::size_t j = 0; j < size; j++ )
+        {
+            omega [ i ][ j ] = V ( normal ( engine ) );
+        }
+    }
+
+    Matrix< V > q = QR< V > { a.view ( ) * omega.view ( ) }.q ( );
+    for ( std::size_t k = 0; k < iterations; k++ )
+    {
+        Matrix< V > const w =
+                QR< V > { a.view ( ).transpose ( ) * q.view ( ) }.q ( );
+        q = QR< V > { a.view ( ) * w.view ( ) }.q ( );
+    }
+    return q;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::RandomizedSVD< V >::RandomizedSVD ( Matrix< V > const &matrix,
+                                        std::size_t        rank,
+                                        std::size_t        oversample,
+                                        std::size_t        iterations,
+                                        std::uint64_t      seed )
+{
+    std::size_t const m = matrix.rowCount ( );
+    std::size_t const n = matrix.colCount ( );
+    if ( rank == 0 || rank > std::min ( m, n ) )
+    {
+        throw std::out_of_range ( "Rank is out of range!" );
+    }
+    std::size_t const size = std::min ( rank + oversample, std::min ( m, n ) );
+    Matrix< V > const q    = randomizedRange ( matrix, size, iterations, seed );
+
+    // the size x n matrix transpose ( Q ) * A is small enough for SVD.
+    SVD< V > const small { q.view ( ).transpose ( ) * matrix.view ( ) };
+    left  = q.view ( ) * small.u ( ).view ( ).block ( 0, 0, size, rank );
+    right = Matrix< V > ( small.v ( ).view ( ).block ( 0, 0, n, rank ) );
+    values.assign ( small.singularValues ( ).begin ( ),
+                    small.singularValues ( ).begin ( ) + rank );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::RandomizedSVD< V >::rank ( ) const noexcept
+{
+    return values.size ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::vector< V > const &
+ml::RandomizedSVD< V >::singularValues ( ) const noexcept
+{
+    return values;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > const &ml::RandomizedSVD< V >::u ( ) const noexcept
+{
+    return left;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > const &ml::RandomizedSVD< V >::v ( ) const noexcept
+{
+    return right;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::FactoredMatrix< V > ml::RandomizedSVD< V >::factored ( ) const
+{
+    // R is stored as transpose ( V ) so that both products read rows.
+    Matrix< V > scaled = left;
+    for ( std::size_t i = 0; i < scaled.rowCount ( ); i++ )
+    {
+        for ( std::size_t j = 0; j < rank ( ); j++ )
+        {
+            scaled [ i ][ j ] *= values [ j ];
+        }
+    }
+    return FactoredMatrix< V > { std::move ( scaled ),
+                                 Matrix< V > ( right.view ( ).transpose ( ) ) };
+}
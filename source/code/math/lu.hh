@@ -0,0 +1,84 @@
+/**
+ * @file lu.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief LU factorization with partial pivoting.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "matrix.hh"
+
+#include <cstddef>
+#include <vector>
+
+namespace ml
+{
+    /**
+     * @brief The factorization P * A = L * U of a square matrix A, where P
+     * is a permutation, L is lower triangular with ones on its diagonal, and
+     * U is upper triangular. Factoring costs O(n^3) once; every solve after
+     * that reuses the factors and costs O(n^2) per right hand side.
+     * @details L and U share the storage of A (the ones on the diagonal of L
+     * are implied). Columns are factored in panels, and the rest of the
+     * matrix is updated with one matrix product per panel, so most of the
+     * work runs through the blocked, threaded GEMM.
+     * @note Pass the matrix with std::move to factor it in place without
+     * making a copy.
+     * @note A matrix is singular here if a pivot is exactly zero, or is not
+     * finite because the matrix was not. Solving with, or inverting, a
+     * singular factorization throws std::runtime_error; its determinant is
+     * zero (or not finite). A matrix that is only nearly singular factors,
+     * and its inverse is as inaccurate as its condition number makes it.
+     */
+    template < CONCEPT_NAMESPACE Floating V > class LU
+    {
+        Matrix< V >                factors;
+        std::vector< std::size_t > pivots;
+        int                        parity   = 1;
+        bool                       singular = false;
+
+        void factor ( );
+    public:
+        // throws std::out_of_range if the matrix is not square.
+        explicit LU ( Matrix< V > matrix );
+
+        std::size_t size ( ) const NOEXCEPT;
+
+        bool isSingular ( ) const NOEXCEPT;
+
+        // L, with the ones on its diagonal filled in.
+        Matrix< V > lower ( ) const;
+        Matrix< V > upper ( ) const;
+
+        /**
+         * @brief Row i of P * A is row permutation ( ) [ i ] of A.
+         */
+        std::vector< std::size_t > const &permutation ( ) const NOEXCEPT;
+
+        V determinant ( ) const NOEXCEPT;
+
+        // x such that A * x = b.
+        template < CONCEPT_NAMESPACE Floating W = V,
+                   CONCEPT_NAMESPACE Floating X = decltype ( V { 0 }
+                                                             + W { 0 } ) >
+        std::vector< X > solve ( std::vector< W > const &b ) const;
+
+        // X such that A * X = B, for all columns of B at once: the blocked
+        // triangular solves (kernel::trsm) split the columns across the
+        // thread pool and do most of the work as GEMMs.
+        template < CONCEPT_NAMESPACE Floating W = V,
+                   CONCEPT_NAMESPACE Floating X = decltype ( V { 0 }
+                                                             + W { 0 } ) >
+        Matrix< X > solve ( Matrix< W > const &b ) const;
+
+        // throws std::runtime_error if A is singular.
+        Matrix< V > inverse ( ) const;
+    };
+} // namespace ml
+
+#include "lu.tcc"
@@ -0,0 +1,262 @@
+/**
+ * @file lu.tcc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief This C++ file is meant to be included only in lu.hh
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::LU< V >::LU ( Matrix< V > matrix ) : factors ( std::move ( matrix ) )
+{
+    if ( factors.rowCount ( ) != factors.colCount ( ) )
+    {
+        throw std::out_of_range ( "Matrix is not square!" );
+    }
+    factor ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V > void ml::LU< V >::factor ( )
+{
+    using std::abs;
+    std::size_t const n  = size ( );
+    std::size_t const ld = factors.leadingDimension ( );
+    V *const          a  = factors.data ( );
+    pivots.resize ( n );
+    std::iota ( pivots.begin ( ), pivots.end ( ), std::size_t { 0 } );
+
+    // wide enough that the update of the trailing matrix is a real product,
+    // narrow enough that the panel stays in cache.
+    std::size_t const block = 64;
+    for ( std::size_t k0 = 0; k0 < n; k0 += block )
+    {
+        std::size_t const k1 = std::min ( n, k0 + block );
+        // factor the panel of columns k0 to k1 one column at a time.
+        for ( std::size_t k = k0; k < k1; k++ )
+        {
+            std::size_t p = k;
+            for ( std::size_t i = k + 1; i < n; i++ )
+            {
+                if ( abs ( a [ i * ld + k ] ) > abs ( a [ p * ld + k ] ) )
+                {
+                    p = i;
+                }
+            }
+            if ( p != k )
+            {
+                // swap the whole row so that L is permuted along with U.
+                factors.swapRows ( p, k );
+                std::swap ( pivots [ p ], pivots [ k ] );
+                parity = -parity;
+            }
+            // as in LAPACK's getrf, only a pivot that is exactly zero or not
+            // finite (its difference with itself is NaN) is singular, so
+            // that scaling rows never changes the answer.
+            V const pivot = a [ k * ld + k ];
+            if ( pivot == V { 0 } || !( pivot - pivot == V { 0 } ) )
+            {
+                singular = true;
+                continue;
+            }
+            V const *top = a + k * ld;
+            thread::parallelFor (
+                    k + 1,
+                    n,
+                    thread::grainFor ( n - k - 1, 2 * ( k1 - k ) ),
+                    [ & ] ( std::size_t first, std::size_t last ) {
+                        for ( std::size_t i = first; i < last; i++ )
+                        {
+                            V      *row = a + i * ld;
+                            V const l   = row [ k ] /= pivot;
+                            for ( std::size_t j = k + 1; j < k1; j++ )
+                            {
+                                row [ j ] -= l * top [ j ];
+                            }
+                        }
+                    } );
+        }
+        if ( k1 == n )
+        {
+            break;
+        }
+        // the rows of U to the right of the panel: U12 = inverse ( L11 ) A12
+        kernel::trsm ( kernel::Triangle::Lower,
+                       kernel::Diagonal::Unit,
+                       k1 - k0,
+                       n - k1,
+                       a + k0 * ld + k0,
+                       ld,
+                       std::size_t { 1 },
+                       a + k0 * ld + k1,
+                       ld );
+        // and the rest of the matrix: A22 = A22 - L21 * U12
+        kernel::gemm ( n - k1,
+                       n - k1,
+                       k1 - k0,
+                       V { -1 },
+                       a + k1 * ld + k0,
+                       ld,
+                       std::size_t { 1 },
+                       a + k0 * ld + k1,
+                       ld,
+                       std::size_t { 1 },
+                       V { 1 },
+                       a + k1 * ld + k1,
+                       ld );
+    }
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::LU< V >::size ( ) const noexcept
+{
+    return factors.rowCount ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+bool ml::LU< V >::isSingular ( ) const noexcept
+{
+    return singular;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > ml::LU< V >::lower ( ) const
+{
+    Matrix< V > output { size ( ), size ( ) };
+    for ( std::size_t i = 0; i < size ( ); i++ )
+    {
+        V const *row = factors.data ( ) + i * factors.leadingDimension ( );
+        V       *out = output.data ( ) + i * output.leadingDimension ( );
+        std::copy ( row, row + i, out );
+        out [ i ] = V { 1 };
+    }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > ml::LU< V >::upper ( ) const
+{
+    Matrix< V > output { size ( ), size ( ) };
+    for ( std::size_t i = 0; i < size ( ); i++ )
+    {
+        V const *row = factors.data ( ) + i * factors.leadingDimension ( );
+        V       *out = output.data ( ) + i * output.leadingDimension ( );
+        std::copy ( row + i, row + size ( ), out + i );
+    }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::vector< std::size_t > const &ml::LU< V >::permutation ( ) const noexcept
+{
+    return pivots;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+V ml::LU< V >::determinant ( ) const noexcept
+{
+    V output = V ( parity );
+    for ( std::size_t i = 0; i < size ( ); i++ )
+    {
+        output *= factors.data ( ) [ i * factors.leadingDimension ( ) + i ];
+    }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+template < CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X >
+std::vector< X > ml::LU< V >::solve ( std::vector< W > const &b ) const
+{
+    if ( b.size ( ) != size ( ) )
+    {
+        throw std::out_of_range ( "Vector length mismatch!" );
+    }
+    if ( singular )
+    {
+        throw std::runtime_error ( "Matrix is singular!" );
+    }
+    std::size_t const n  = size ( );
+    std::size_t const ld = factors.leadingDimension ( );
+    V const *const    a  = factors.data ( );
+    std::vector< X >  x ( n );
+    for ( std::size_t i = 0; i < n; i++ ) { x [ i ] = X ( b [ pivots [ i ] ] ); }
+    // L y = P b, then U x = y
+    kernel::trsv ( kernel::Triangle::Lower,
+                   kernel::Diagonal::Unit,
+                   n,
+                   a,
+                   ld,
+                   std::size_t { 1 },
+                   x.data ( ) );
+    kernel::trsv ( kernel::Triangle::Upper,
+                   kernel::Diagonal::General,
+                   n,
+                   a,
+                   ld,
+                   std::size_t { 1 },
+                   x.data ( ) );
+    return x;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+template < CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X >
+ml::Matrix< X > ml::LU< V >::solve ( Matrix< W > const &b ) const
+{
+    if ( b.rowCount ( ) != size ( ) )
+    {
+        throw std::out_of_range ( "Row count mismatch!" );
+    }
+    if ( singular )
+    {
+        throw std::runtime_error ( "Matrix is singular!" );
+    }
+    std::size_t const n  = size ( );
+    std::size_t const m  = b.colCount ( );
+    std::size_t const ld = factors.leadingDimension ( );
+    V const *const    a  = factors.data ( );
+    Matrix< X >       x { n, m };
+    std::size_t const ldx = x.leadingDimension ( );
+    X *const          out = x.data ( );
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        W const *row = b.data ( ) + pivots [ i ] * b.leadingDimension ( );
+        std::copy ( row, row + m, out + i * ldx );
+    }
+    kernel::trsm ( kernel::Triangle::Lower,
+                   kernel::Diagonal::Unit,
+                   n,
+                   m,
+                   a,
+                   ld,
+                   std::size_t { 1 },
+                   out,
+                   ldx );
+    kernel::trsm ( kernel::Triangle::Upper,
+                   kernel::Diagonal::General,
+                   n,
+                   m,
+                   a,
+                   ld,
+                   std::size_t { 1 },
+                   out,
+                   ldx );
+    return x;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > ml::LU< V >::inverse ( ) const
+{
+    if ( singular )
+    {
+        throw std::runtime_error ( "No inverse!" );
+    }
+    return solve ( Matrix< V >::identity ( size ( ) ) );
+}
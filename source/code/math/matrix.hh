@@ -11,40 +11,177 @@
  */
 #pragma once
 
+#include "../thread/pool.hh"
+#include "expression.hh"
+#include "gemm.hh"
+#include "kernels.hh"
 #include "meta.hh"
+#include "trsm.hh"
+#include "view.hh"
 
+#include <algorithm>
+#include <limits>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <iostream>
 
-// if C++ 20, then use concepts to require floating point types.
-// otherwise, just alias the term "Floating" to "class"
-CONCEPT_NAMESPACE_BEGIN
-#if HAS_CONCEPTS
-template < class F >
-concept Floating = std::floating_point< F >;
-#else
-#    define Floating class
-#endif
-CONCEPT_NAMESPACE_END
-
 namespace ml
 {
+    template < CONCEPT_NAMESPACE Floating V > class LU;
 
-    template < CONCEPT_NAMESPACE Floating V > class Matrix
+    /**
+     * @brief A reference to a single row inside of a Matrix. Rows used to be
+     * their own std::vector, so Row behaves like one as much as it can:
+     * indexing, at, size, iteration, and assignment from a std::vector all
+     * work the same way they did before.
+     * @note Assigning to a Row copies the elements into the Matrix, it does
+     * not rebind the reference. Copying a Row (e.g., with auto) still refers
+     * to the same Matrix, so convert to a std::vector if you need a copy of
+     * the values.
+     * @tparam V the element type, const-qualified for a const Matrix.
+     */
+    template < class V > class Row
     {
-        using Column = std::vector< V >;
-        std::vector< Column > rows;
+        using Value = typename std::remove_const< V >::type;
+
+        V          *first;
+        std::size_t length;
+    public:
+        Row ( V *first, std::size_t length ) NOEXCEPT;
+        Row ( Row const & ) = default;
+
+        // allow a Row of a mutable matrix to become a Row of a const one.
+        template < class W >
+        Row ( Row< W > const &that ) NOEXCEPT;
+
+        Row &operator= ( Row const &that );
+        template < class W >
+        Row &operator= ( Row< W > const &that );
+        Row &operator= ( std::vector< Value > const &that );
+
+        operator std::vector< Value > ( ) const;
+
+        std::size_t size ( ) const NOEXCEPT;
+
+        V *data ( ) const NOEXCEPT;
+        V *begin ( ) const NOEXCEPT;
+        V *end ( ) const NOEXCEPT;
+
+        V &operator[] ( std::size_t ) const;
+        V &at ( std::size_t ) const;
+    };
+
+    /**
+     * @brief A matrix with n rows and m columns.
+     * @note The elements live in one contiguous row-major buffer. Row i
+     * starts at data ( ) + i * leadingDimension ( ), and the columns within a
+     * row are adjacent, so every row is a unit-stride span of memory.
+     * @note The buffer is usually the matrix's own, but see wrap.
+     */
+    template < CONCEPT_NAMESPACE Floating V >
+    class Matrix : public Expression< Matrix< V > >
+    {
+        std::vector< V > elements;
+        // the elements when they belong to someone else, see wrap.
+        V          *origin  = nullptr;
+        std::size_t nRows   = 0;
+        std::size_t nCols   = 0;
+        std::size_t leading = 0;
+
+        // leaves this an empty matrix, for after its elements are moved.
+        void release ( ) NOEXCEPT;
     public:
         Matrix ( ) = default;
         Matrix ( std::size_t const rows, std::size_t const cols );
 
+        /**
+         * @brief Copies always own their elements, even copies of a wrapped
+         * matrix. Assigning a matrix of the same shape copies into the
+         * elements this already has (which, for a wrapped matrix, are the
+         * wrapped buffer's) without allocating.
+         * @note Moving hands over the elements, wrapped or not, and leaves
+         * that an empty matrix, so std::swap trades buffers. The one
+         * exception is move assigning to a wrapped matrix of the same shape,
+         * which copies into the wrapped buffer like copy assignment.
+         */
+        Matrix ( Matrix const &that );
+        Matrix ( Matrix &&that ) NOEXCEPT;
+        Matrix &operator= ( Matrix const &that );
+        Matrix &operator= ( Matrix &&that );
+
+        /**
+         * @brief A rows x cols matrix whose elements are the buffer at
+         * origin, row i starting leading elements after row i - 1. Nothing
+         * is copied, and writes to the matrix go straight to the buffer.
+         * @throws std::out_of_range if leading is less than cols.
+         * @note The buffer must outlive the matrix, which never frees it.
+         * Assigning a result of a different shape to the matrix gives it
+         * elements of its own and leaves the buffer alone.
+         */
+        static Matrix wrap ( V          *origin,
+                             std::size_t rows,
+                             std::size_t cols,
+                             std::size_t leading );
+
+        // copies the elements of a view, e.g., a block or a transpose.
+        template < class W > explicit Matrix ( MatrixView< W > const &that );
+
+        /**
+         * @brief Computes an element-wise expression (sums, differences,
+         * and scalar multiples of matrices) in one pass.
+         * @note Assigning to a matrix that already has the right shape
+         * writes straight into its elements, even if the matrix appears in
+         * the expression.
+         */
+        template < class E > Matrix ( Expression< E > const &that );
+        template < class E > Matrix &operator= ( Expression< E > const &that );
+
+        /**
+         * @brief Updates this in place, without allocating.
+         * @throws std::out_of_range if the shapes differ.
+         */
+        template < class E > Matrix &operator+= ( Expression< E > const &that );
+        template < class E > Matrix &operator-= ( Expression< E > const &that );
+
+        template < class S,
+                   class = typename std::enable_if< IsScalar< S >::value >::type >
+        Matrix &operator*= ( S const &scalar );
+        template < class S,
+                   class = typename std::enable_if< IsScalar< S >::value >::type >
+        Matrix &operator/= ( S const &scalar );
+
+        /**
+         * @brief this = alpha * x + this, in place.
+         * @throws std::out_of_range if the shapes differ.
+         */
+        template < CONCEPT_NAMESPACE Floating W >
+        Matrix &axpy ( V const &alpha, Matrix< W > const &x );
+
         std::size_t rowCount ( ) const NOEXCEPT;
         std::size_t colCount ( ) const NOEXCEPT;
 
-        std::vector< V >       &operator[] ( std::size_t );
-        std::vector< V > const &operator[] ( std::size_t ) const;
+        /**
+         * @brief Distance, in elements, between the start of two adjacent
+         * rows.
+         */
+        std::size_t leadingDimension ( ) const NOEXCEPT;
+
+        V       *data ( ) NOEXCEPT;
+        V const *data ( ) const NOEXCEPT;
+
+        // throws std::out_of_range if the row does not exist.
+        Row< V >       operator[] ( std::size_t );
+        Row< V const > operator[] ( std::size_t ) const;
+
+        // the whole matrix as a view, to take blocks or transposes of.
+        MatrixView< V >       view ( ) NOEXCEPT;
+        MatrixView< V const > view ( ) const NOEXCEPT;
+
+        // exchanges two rows in place without allocating.
+        void swapRows ( std::size_t, std::size_t );
 
         // the identity matrix.
         static inline Matrix< V > identity ( std::size_t i )
@@ -64,16 +201,6 @@ namespace ml
         V const &operator[] ( std::size_t row, std::size_t col ) const;
 #endif // if __cplusplus >= 202300
 
-        template < CONCEPT_NAMESPACE Floating W = V,
-                   CONCEPT_NAMESPACE Floating X = decltype ( V { 0 }
-                                                             + W { 0 } ) >
-        Matrix< X > operator+ ( Matrix< W > const & );
-
-        template < CONCEPT_NAMESPACE Floating W = V,
-                   CONCEPT_NAMESPACE Floating X = decltype ( V { 0 }
-                                                             + W { 0 } ) >
-        Matrix< X > operator- ( Matrix< W > const & );
-
         template < CONCEPT_NAMESPACE Floating W = V,
                    CONCEPT_NAMESPACE Floating X = decltype ( V { 0 }
                                                              + W { 0 } ) >
@@ -84,39 +211,35 @@ namespace ml
                                                              + W { 0 } ) >
         std::vector< X > operator* ( std::vector< W > const &input );
 
-        template < CONCEPT_NAMESPACE Floating W = V,
-                   CONCEPT_NAMESPACE Floating X = decltype ( V { 0 }
-                                                             + W { 0 } ) >
-        Matrix< X > operator* ( W const &scalar );
-
-        template < CONCEPT_NAMESPACE Floating W = V,
-                   CONCEPT_NAMESPACE Floating X = decltype ( V { 0 }
-                                                             + W { 0 } ) >
-        Matrix< X > operator/ ( W const &scalar );
-
         template < CONCEPT_NAMESPACE Floating W = V,
                    CONCEPT_NAMESPACE Floating X = decltype ( V { 0 }
                                                              + W { 0 } ) >
         Matrix< X > augment ( Matrix< W > const &rhs );
 
         /**
-         * @brief Gets this in reduced row echelon form. I have not
-         * mathematically proven that this algorithm is correct, but I have not
-         * seen any indication that it performs anything dubious.
-         * @note It solves it more like a human would tho, so there's perhaps
-         * some optimizations possible.
+         * @brief Gets this in reduced row echelon form by Gauss-Jordan
+         * elimination with partial pivoting. Costs O(rows * cols * min(rows,
+         * cols)) and allocates only a scale per row beyond the copy it
+         * returns.
+         * @note A column has no pivot when every candidate is within
+         * max(rows, cols) * epsilon * (the scale of its row) of zero, and
+         * entries that small are zero in the result. A row's scale is its
+         * largest element, grown by the multiples of pivot rows subtracted
+         * from it, so scaling a row does not change its rank.
          * @return Matrix<V> this in rref form.
          */
         Matrix< V > echelon ( ) const;
 
+        // the same as echelon, but reduces this instead of a copy.
+        void echelonInPlace ( );
+
         /**
-         * @brief Attempts to find the inverse of this matrix using the
-         * superaugmented matrix technique (augmenting this with the appropriate
-         * identity matrix and reducing to echelon form).
-         * @note While this technique works, the only
-         * time this function indicates that the inverse cannot be found is if
-         * the matrix is not square and there are other conditions for no
-         * inverse to exist.
+         * @brief Finds the inverse of this matrix from its LU factorization.
+         * To solve several systems with the same matrix, factor it once with
+         * LU instead of multiplying by the inverse.
+         * @throws std::runtime_error if the matrix is not square or LU
+         * finds it singular, i.e. a pivot is exactly zero. A nearly
+         * singular matrix gets an inverse with large entries instead.
          * @note Due to floating point precision issues, this function may not
          * return the exact inverse. This is because most numbers do not have
          * terminating decimals in binary floating point (as in, they have to
@@ -125,7 +248,6 @@ namespace ml
          * combination of powers of 2. So, you may find that A * A.inverse() !=
          * identity(A.rowCount()); but the diference between A * A.inverse() and
          * identity(A.rowCount()) should be markedly small.
-         * @internal This function should work in a constant context.
          * @return Matrix<V>
          */
         Matrix< V > inverse ( );
@@ -134,6 +256,64 @@ namespace ml
         bool operator== ( Matrix< W > const &that ) const noexcept;
     };
 
+
+    /**
+     * @brief C = alpha * A * B + beta * C, written into the storage C
+     * already has. Once the GEMM workspace has grown to fit, this allocates
+     * nothing.
+     * @throws std::out_of_range if the shapes do not line up.
+     * @note C is not read when beta is zero, and must not be A or B.
+     */
+    template < CONCEPT_NAMESPACE Floating X,
+               CONCEPT_NAMESPACE Floating V,
+               CONCEPT_NAMESPACE Floating W >
+    void gemm ( typename std::common_type< X >::type alpha,
+                Matrix< V > const                    &a,
+                Matrix< W > const                    &b,
+                typename std::common_type< X >::type beta,
+                Matrix< X >                          &c );
+
+    /**
+     * @brief y = alpha * A * x + beta * y on raw spans, where x has
+     * A.colCount ( ) elements and y has A.rowCount ( ). The rows of A are
+     * split across the thread pool, each piece through the vectorized
+     * kernel, and nothing is allocated.
+     * @note y is not read when beta is zero, and must not overlap x.
+     */
+    template < CONCEPT_NAMESPACE Floating X,
+               CONCEPT_NAMESPACE Floating V,
+               CONCEPT_NAMESPACE Floating W >
+    void gemv ( typename std::common_type< X >::type alpha,
+                Matrix< V > const                    &a,
+                W const                              *x,
+                typename std::common_type< X >::type beta,
+                X                                    *y );
+
+    /**
+     * @brief The product of two views, through the blocked GEMM. Neither
+     * view is copied first, so multiplying by a transpose or a block costs
+     * the same as multiplying by a Matrix.
+     * @throws std::out_of_range if the inner dimensions differ.
+     */
+    template < class V,
+               class W,
+               class X = decltype ( std::declval< V & > ( )
+                                    * std::declval< W & > ( ) ) >
+    Matrix< X > operator* ( MatrixView< V > const &lhs,
+                            MatrixView< W > const &rhs );
 } // namespace ml
 
-#include "matrix.tcc"
\ No newline at end of file
+#include "matrix.tcc"
+
+#include "batch.hh"
+#include "cholesky.hh"
+#include "eigen.hh"
+#include "fixed.hh"
+#include "half.hh"
+#include "lowrank.hh"
+#include "lu.hh"
+#include "qr.hh"
+#include "quantized.hh"
+#include "rational.hh"
+#include "refine.hh"
+#include "sparse.hh"
@@ -9,163 +9,369 @@
  *
  */
 
-template <CONCEPT_NAMESPACE Floating V>
-ml::Matrix<V>::Matrix(std::size_t const rows, std::size_t const cols)
+template <class V>
+ml::Row<V>::Row(V *first, std::size_t length) noexcept : first(first), length(length)
+{
+}
+
+template <class V>
+template <class W>
+ml::Row<V>::Row(Row<W> const &that) noexcept : first(that.data()), length(that.size())
+{
+}
+
+template <class V>
+ml::Row<V> &ml::Row<V>::operator=(Row const &that)
+{
+    return this->operator=<V>(that);
+}
+
+template <class V>
+template <class W>
+ml::Row<V> &ml::Row<V>::operator=(Row<W> const &that)
 {
-    for (std::size_t i = 0; i < rows; i++)
+    if (that.size() != size())
     {
-        Column col{};
-        for (std::size_t j = 0; j < cols; j++)
-        {
-            col.push_back(V{0});
-        }
-        this->rows.push_back(col);
+        throw std::length_error("Row length mismatch!");
+    }
+    // the rows may belong to the same matrix, but they are either the same
+    // row or they do not overlap.
+    std::copy(that.begin(), that.end(), begin());
+    return *this;
+}
+
+template <class V>
+ml::Row<V> &ml::Row<V>::operator=(std::vector<Value> const &that)
+{
+    if (that.size() != size())
+    {
+        throw std::length_error("Row length mismatch!");
+    }
+    std::copy(that.begin(), that.end(), begin());
+    return *this;
+}
+
+template <class V>
+ml::Row<V>::operator std::vector<Value>() const
+{
+    return std::vector<Value>(begin(), end());
+}
+
+template <class V>
+std::size_t ml::Row<V>::size() const noexcept
+{
+    return length;
+}
+
+template <class V>
+V *ml::Row<V>::data() const noexcept
+{
+    return first;
+}
+
+template <class V>
+V *ml::Row<V>::begin() const noexcept
+{
+    return first;
+}
+
+template <class V>
+V *ml::Row<V>::end() const noexcept
+{
+    return first + length;
+}
+
+template <class V>
+V &ml::Row<V>::operator[](std::size_t col) const
+{
+    return first[col];
+}
+
+template <class V>
+V &ml::Row<V>::at(std::size_t col) const
+{
+    if (col >= length)
+    {
+        throw std::out_of_range("Column out of range!");
     }
+    return first[col];
 }
 
 template <CONCEPT_NAMESPACE Floating V>
-std::size_t ml::Matrix<V>::rowCount() const noexcept
+ml::Matrix<V>::Matrix(std::size_t const rows, std::size_t const cols) :
+    elements(rows * cols, V{0}), nRows(rows), nCols(cols), leading(cols)
 {
-    return rows.size();
 }
 
 template <CONCEPT_NAMESPACE Floating V>
-std::size_t ml::Matrix<V>::colCount() const noexcept
+ml::Matrix<V>::Matrix(Matrix const &that) : Matrix(that.view())
 {
-    return rows.empty() ? 0 : rows.at(0).size();
 }
 
 template <CONCEPT_NAMESPACE Floating V>
-std::vector<V> &ml::Matrix<V>::operator[](std::size_t row)
+ml::Matrix<V>::Matrix(Matrix &&that) noexcept :
+    elements(std::move(that.elements)), origin(that.origin), nRows(that.nRows), nCols(that.nCols),
+    leading(that.leading)
 {
-    return rows.at(row);
+    that.release();
 }
 
 template <CONCEPT_NAMESPACE Floating V>
-std::vector<V> const &ml::Matrix<V>::operator[](std::size_t row) const
+ml::Matrix<V> &ml::Matrix<V>::operator=(Matrix const &that)
 {
-    return rows.at(row);
+    if (this == &that)
+    {
+        return *this;
+    }
+    if (that.rowCount() != rowCount() || that.colCount() != colCount())
+    {
+        Matrix<V> output{that};
+        std::swap(*this, output);
+        return *this;
+    }
+    view().assign(that.view());
+    return *this;
 }
 
 template <CONCEPT_NAMESPACE Floating V>
-template <CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X>
-ml::Matrix<X> ml::Matrix<V>::operator+(Matrix<W> const &that)
+ml::Matrix<V> &ml::Matrix<V>::operator=(Matrix &&that)
 {
-    Matrix<X> output{rowCount(), colCount()};
-    for (std::size_t i = 0; i < rowCount(); i++)
+    if (this == &that)
     {
-        for (std::size_t j = 0; j < colCount(); j++)
-        {
-            output[i][j] = (*this)[i][j] + that[i][j];
-        }
+        return *this;
     }
-    return output;
+    // a wrapped matrix keeps writing to its buffer for as long as it can.
+    if (origin != nullptr && that.rowCount() == rowCount() && that.colCount() == colCount())
+    {
+        view().assign(that.view());
+        return *this;
+    }
+    elements = std::move(that.elements);
+    origin = that.origin;
+    nRows = that.nRows;
+    nCols = that.nCols;
+    leading = that.leading;
+    that.release();
+    return *this;
 }
 
 template <CONCEPT_NAMESPACE Floating V>
-template <CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X>
-ml::Matrix<X> ml::Matrix<V>::operator-(Matrix<W> const &that)
+void ml::Matrix<V>::release() noexcept
 {
-    Matrix<X> output{rowCount(), colCount()};
-    for (std::size_t i = 0; i < rowCount(); i++)
+    elements.clear();
+    origin = nullptr;
+    nRows = 0;
+    nCols = 0;
+    leading = 0;
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+ml::Matrix<V> ml::Matrix<V>::wrap(V *origin, std::size_t rows, std::size_t cols, std::size_t leading)
+{
+    if (leading < cols)
     {
-        for (std::size_t j = 0; j < colCount(); j++)
-        {
-            output[i][j] = (*this)[i][j] - that[i][j];
-        }
+        throw std::out_of_range("Leading dimension too small!");
     }
+    Matrix<V> output;
+    output.origin = origin;
+    output.nRows = rows;
+    output.nCols = cols;
+    output.leading = leading;
     return output;
 }
 
 template <CONCEPT_NAMESPACE Floating V>
-template <CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X>
-ml::Matrix<X> ml::Matrix<V>::operator*(Matrix<W> const &that)
+template <class W>
+ml::Matrix<V>::Matrix(MatrixView<W> const &that) : Matrix(that.rowCount(), that.colCount())
 {
-    // index i, j of output is the dot product of row i of this
-    // and column j of that.
-    Matrix<X> output{rowCount(), that.colCount()};
-    // for each row in this, perform the dot product with that row
-    // and each column in that. The dot product is the ith row, jth
-    // column index of output
-    for (std::size_t i = 0; i < rowCount(); i++)
+    view().assign(that);
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+template <class E>
+ml::Matrix<V>::Matrix(Expression<E> const &that) : Matrix(that.self().rowCount(), that.self().colCount())
+{
+    expression::evaluate(that, data(), leading);
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+template <class E>
+ml::Matrix<V> &ml::Matrix<V>::operator=(Expression<E> const &that)
+{
+    if (that.self().rowCount() != rowCount() || that.self().colCount() != colCount())
     {
-        for (std::size_t j = 0; j < that.colCount(); j++)
-        {
-            X accumulated = 0;
-            for (std::size_t k = 0; k < colCount(); k++)
-            {
-                accumulated += (*this)[i][k] * that[k][j];
-            }
-            output[i][j] = accumulated;
-        }
+        // the expression may still read the old elements.
+        Matrix<V> output{that};
+        std::swap(*this, output);
+        return *this;
     }
-    return output;
+    // every element only depends on the elements in the same place, so
+    // overwriting them one at a time is safe.
+    expression::evaluate(that, data(), leading);
+    return *this;
 }
 
 template <CONCEPT_NAMESPACE Floating V>
-template <CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X>
-std::vector<X> ml::Matrix<V>::operator*(std::vector<W> const &input)
+template <class E>
+ml::Matrix<V> &ml::Matrix<V>::operator+=(Expression<E> const &that)
+{
+    // operator+ checks the shapes.
+    expression::evaluate(*this + that, data(), leading);
+    return *this;
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+template <class E>
+ml::Matrix<V> &ml::Matrix<V>::operator-=(Expression<E> const &that)
+{
+    expression::evaluate(*this - that, data(), leading);
+    return *this;
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+template <class S, class>
+ml::Matrix<V> &ml::Matrix<V>::operator*=(S const &scalar)
+{
+    expression::evaluate(*this * scalar, data(), leading);
+    return *this;
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+template <class S, class>
+ml::Matrix<V> &ml::Matrix<V>::operator/=(S const &scalar)
+{
+    expression::evaluate(*this / scalar, data(), leading);
+    return *this;
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+template <CONCEPT_NAMESPACE Floating W>
+ml::Matrix<V> &ml::Matrix<V>::axpy(V const &alpha, Matrix<W> const &x)
 {
-    std::vector<X> result;
-    for (auto &row : rows)
+    if (x.rowCount() != rowCount() || x.colCount() != colCount())
     {
-        X accumulated = 0;
-        for (std::size_t i = 0; i < row.size(); i++)
+        throw std::out_of_range("Shape mismatch!");
+    }
+    thread::parallelFor(0, rowCount(), thread::grainFor(rowCount(), 2 * colCount()), [&](std::size_t first, std::size_t last)
+    {
+        for (std::size_t i = first; i < last; i++)
         {
-            accumulated += row.at(i) * input.at(i);
+            kernel::axpy(colCount(), alpha, x.data() + i * x.leadingDimension(), data() + i * leading);
         }
-        result.push_back(accumulated);
+    });
+    return *this;
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+std::size_t ml::Matrix<V>::rowCount() const noexcept
+{
+    return nRows;
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+std::size_t ml::Matrix<V>::colCount() const noexcept
+{
+    return nCols;
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+std::size_t ml::Matrix<V>::leadingDimension() const noexcept
+{
+    return leading;
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+V *ml::Matrix<V>::data() noexcept
+{
+    return origin ? origin : elements.data();
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+V const *ml::Matrix<V>::data() const noexcept
+{
+    return origin ? origin : elements.data();
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+ml::MatrixView<V> ml::Matrix<V>::view() noexcept
+{
+    return MatrixView<V>{data(), nRows, nCols, leading};
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+ml::MatrixView<V const> ml::Matrix<V>::view() const noexcept
+{
+    return MatrixView<V const>{data(), nRows, nCols, leading};
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+ml::Row<V> ml::Matrix<V>::operator[](std::size_t row)
+{
+    if (row >= nRows)
+    {
+        throw std::out_of_range("Row out of range!");
     }
-    return result;
+    return Row<V>{data() + row * leading, nCols};
 }
 
 template <CONCEPT_NAMESPACE Floating V>
-template <CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X>
-ml::Matrix<X> ml::Matrix<V>::operator*(W const &scalar)
+ml::Row<V const> ml::Matrix<V>::operator[](std::size_t row) const
 {
-    Matrix<X> output{rowCount(), colCount()};
-    for (std::size_t i = 0; i < rowCount(); i++)
+    if (row >= nRows)
     {
-        for (std::size_t j = 0; j < colCount(); j++)
-        {
-            output[i][j] = scalar * (*this)[i][j];
-        }
+        throw std::out_of_range("Row out of range!");
+    }
+    return Row<V const>{data() + row * leading, nCols};
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+void ml::Matrix<V>::swapRows(std::size_t a, std::size_t b)
+{
+    if (a >= nRows || b >= nRows)
+    {
+        throw std::out_of_range("Row out of range!");
     }
+    if (a != b)
+    {
+        std::swap_ranges(data() + a * leading, data() + a * leading + nCols, data() + b * leading);
+    }
+}
+
+template <CONCEPT_NAMESPACE Floating V>
+template <CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X>
+ml::Matrix<X> ml::Matrix<V>::operator*(Matrix<W> const &that)
+{
+    // index i, j of output is the dot product of row i of this
+    // and column j of that.
+    Matrix<X> output{rowCount(), that.colCount()};
+    gemm<X>(X{1}, *this, that, X{0}, output);
     return output;
 }
 
 template <CONCEPT_NAMESPACE Floating V>
 template <CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X>
-ml::Matrix<X> ml::Matrix<V>::operator/(W const &scalar)
+std::vector<X> ml::Matrix<V>::operator*(std::vector<W> const &input)
 {
-    Matrix<X> output{rowCount(), colCount()};
-    for (std::size_t i = 0; i < rowCount(); i++)
+    if (input.size() != colCount())
     {
-        for (std::size_t j = 0; j < colCount(); j++)
-        {
-            output[i][j] = (*this)[i][j] / scalar;
-        }
+        throw std::out_of_range("Vector length mismatch!");
     }
-    return output;
+    std::vector<X> result(rowCount());
+    gemv<X>(X{1}, *this, input.data(), X{0}, result.data());
+    return result;
 }
 
 template<CONCEPT_NAMESPACE Floating V>
 template<CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X>
 ml::Matrix<X> ml::Matrix<V>::augment(Matrix<W> const &that)
 {
-    Matrix<X> output { rowCount(), colCount() + that.colCount()};
-    for ( std::size_t i = 0; i < rowCount(); i++)
+    if (rowCount() != that.rowCount())
     {
-        std::size_t j = 0;
-        for (; j < colCount(); j++)
-        {
-            output[i][j] = X{(*this)[i][j]};
-        }
-        for (; j - colCount() < that.colCount(); j++)
-        {
-            output[i][j] = X{that[i][j - colCount()]};
-        }
+        throw std::out_of_range("Row count mismatch!");
     }
+    Matrix<X> output { rowCount(), colCount() + that.colCount()};
+    output.view().block(0, 0, rowCount(), colCount()).assign(view());
+    output.view().block(0, colCount(), rowCount(), that.colCount()).assign(that.view());
     return output;
 }
 
@@ -173,138 +379,94 @@ ml::Matrix<X> ml::Matrix<V>::augment(Matrix<W> const &that)
 template<CONCEPT_NAMESPACE Floating V>
 ml::Matrix<V> ml::Matrix<V>::echelon() const
 {
-    // some useful lambda functions
-    auto allZeros = [](std::vector<V> const &v) -> bool
-    {
-        for (auto const &x : v)
-        {
-            if (x != 0)
-            {
-                return false;
-            }
-        }
-        return true;
-    };
-    // if there is one row or less, then we are trivially in rref form.
-    if (rowCount() < 2 || !colCount())
-    {
-        return *this;
-    }
-
     Matrix<V> result{*this};
+    result.echelonInPlace();
+    return result;
+}
 
-    for (std::size_t i = 0; i < std::min(rowCount(), colCount()); i++)
+template<CONCEPT_NAMESPACE Floating V>
+void ml::Matrix<V>::echelonInPlace()
+{
+    using std::abs;
+    std::size_t const m = rowCount();
+    std::size_t const n = colCount();
+    // an entry within tolerance times the magnitudes its row has been built
+    // from is rounding error left over from elimination. Each row keeps that
+    // scale, so rows of very different sizes are judged each on their own.
+    V const tolerance = V(std::max(m, n)) * std::numeric_limits<V>::epsilon();
+    std::vector<V> scales(m, V{0});
+    std::vector<std::size_t> pivots;
+    for (std::size_t i = 0; i < m; i++)
     {
-        for (std::size_t r = 0; r < rowCount(); r++)
+        V const *row = data() + i * leading;
+        for (std::size_t j = 0; j < n; j++)
         {
-            auto temp = result[r];
-            result[r] = result[(r + 1) % rowCount()];
-            result[(r + 1) % rowCount()] = temp;
-        }
-
-        if (result[i][i] == 0)
-        {
-            continue;
+            scales[i] = std::max<V>(scales[i], abs(row[j]));
         }
+    }
 
-        // multiply the row in the diagonal by 1 / the item in the diagonal
-        V factor = result[i][i];
-        for (auto &x : result[i])
+    std::size_t pivotRow = 0;
+    for (std::size_t col = 0; col < n && pivotRow < m; col++)
+    {
+        // partial pivoting: the largest candidate in the column that is not
+        // rounding error.
+        std::size_t p = m;
+        for (std::size_t i = pivotRow; i < m; i++)
         {
-            x /= factor;
-            if (x == -0.0)
+            V const candidate = abs(data()[i * leading + col]);
+            if (candidate > tolerance * scales[i] && (p == m || candidate > abs(data()[p * leading + col])))
             {
-                x = 0.0;
+                p = i;
             }
         }
-
-        // eliminate the other elements in the column
-        for (std::size_t r = 0; r < rowCount(); r++)
+        if (p == m)
         {
-            if (r == i)
-            {
-                continue;
-            }
-            else
-            {
-                V k = result[r][i];
-                for (std::size_t j = 0; j < colCount(); j++)
-                {
-                    result[r][j] -= k * result[i][j];
-                    if (result[r][j] == -0.0)
-                    {
-                        result[r][j] = 0.0;
-                    }
-                }
-            }
+            continue;
         }
-        auto zeroRow = [](std::vector<V> v) -> bool
-        {
-            for (auto const &x : v)
-            {
-                if (x != 0)
-                {
-                    return false;
-                }
-            }
-            return true;
-        };
+        swapRows(p, pivotRow);
+        std::swap(scales[p], scales[pivotRow]);
 
-        bool madeSwap = false;
-        do
+        // columns left of col are already zero in the pivot row.
+        V *pivot = data() + pivotRow * leading;
+        V const factor = pivot[col];
+        kernel::divide(n - col, factor, pivot + col, pivot + col);
+        pivot[col] = V{1};
+        scales[pivotRow] /= abs(factor);
+        V const scale = scales[pivotRow];
+
+        // every other row only reads the pivot row, so the rows can go in
+        // any order.
+        thread::parallelFor(0, m, thread::grainFor(m, 2 * (n - col)), [&](std::size_t first, std::size_t last)
         {
-            madeSwap = false;
-            for (std::size_t r = 1; r < rowCount(); r++)
+            for (std::size_t r = first; r < last; r++)
             {
-                if (zeroRow(result[r - 1]) && !zeroRow(result[r]))
+                V *row = data() + r * leading;
+                if (r == pivotRow || row[col] == V{0})
                 {
-                    auto temp = result[r - 1];
-                    result[r - 1] = result[r];
-                    result[r] = temp;
-
-                    madeSwap = true;
+                    continue;
                 }
+                scales[r] = std::max<V>(scales[r], abs(row[col]) * scale);
+                kernel::axpy(n - col, V(-row[col]), pivot + col, row + col);
+                row[col] = V{0};
             }
-        } while (madeSwap);
+        });
+        pivots.push_back(col);
+        pivotRow++;
     }
-    // for each row, make sure that the first nonzero element is 1.
-    // if not, make it 1 and zero out the other elements of that column
-    // via row operations.
-    for (std::size_t r = 0; r < rowCount(); r++)
+
+    // clean up what is left of the rounding error, including -0.0. The
+    // pivots are exact already, and stay ones however large their rows.
+    for (std::size_t i = 0; i < m; i++)
     {
-        for (std::size_t c = 0; c < colCount(); c++)
+        V *row = data() + i * leading;
+        for (std::size_t j = 0; j < n; j++)
         {
-            if (result[r][c] != 0)
+            if ((i >= pivots.size() || j != pivots[i]) && abs(row[j]) <= tolerance * scales[i])
             {
-                if (result[r][c] != 1)
-                {
-                    // divide the entire row by this element
-                    V pivotElement = result[r][c];
-                    for (auto &elem : result[r])
-                    {
-                        elem /= pivotElement;
-                    }
-                    // zero out the other rows with respect to this
-                    // column
-                    for (std::size_t i = 0; i < rowCount(); i++)
-                    {
-                        if (i == r)
-                        {
-                            continue;
-                        }
-                        V factor = result[i][c] / result[r][c];
-                        for (std::size_t j = 0; j < colCount(); j++)
-                        {
-                            result[i][j] -= factor * result[r][j];
-                        }
-                    }
-                }
-                break;
+                row[j] = V{0};
             }
         }
     }
-
-    return result;
 }
 
 template<CONCEPT_NAMESPACE Floating V>
@@ -314,22 +476,7 @@ ml::Matrix<V> ml::Matrix<V>::inverse()
     {
         throw std::runtime_error("No inverse!");
     }
-    else
-    {
-        Matrix<V> superaugmented{rowCount(), 2 * colCount()};
-        superaugmented = this->augment(identity(rowCount()));
-        superaugmented = superaugmented.echelon();
-        // result is right half of superaugmented.
-        Matrix<V> result{rowCount(), colCount()};
-        for (std::size_t i = 0; i < rowCount(); i++)
-        {
-            for (std::size_t j = 0; j < colCount(); j++)
-            {
-                result[i][j] = superaugmented[i][j + colCount()];
-            }
-        }
-        return result;
-    }
+    return LU<V>{*this}.inverse();
 }
 
 template <CONCEPT_NAMESPACE Floating V>
@@ -344,9 +491,11 @@ bool ml::Matrix<V>::operator==(Matrix<W> const &that) const noexcept
     {
         for (std::size_t i = 0; i < rowCount(); i++)
         {
+            V const *a = data() + i * leading;
+            W const *b = that.data() + i * that.leadingDimension();
             for (std::size_t j = 0; j < colCount(); j++)
             {
-                if ((*this)[i][j] != that[i][j])
+                if (a[j] != b[j])
                 {
                     return false;
                 }
@@ -369,4 +518,69 @@ V const &ml::Matrix<V>::operator[](std::size_t row, std::size_t col) const
 {
     return (*this)[row].at(col);
 }
-#endif
\ No newline at end of file
+#endif
+
+template <class V, class W, class X>
+ml::Matrix<X> ml::operator*(MatrixView<V> const &lhs, MatrixView<W> const &rhs)
+{
+    if (lhs.colCount() != rhs.rowCount())
+    {
+        throw std::out_of_range("Shape mismatch!");
+    }
+    Matrix<X> output{lhs.rowCount(), rhs.colCount()};
+    gemm(X{1}, lhs, rhs, X{0}, output.view());
+    return output;
+}
+
+template <CONCEPT_NAMESPACE Floating X, CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W>
+void ml::gemm(typename std::common_type<X>::type alpha, Matrix<V> const &a, Matrix<W> const &b, typename std::common_type<X>::type beta, Matrix<X> &c)
+{
+    std::size_t const m = c.rowCount();
+    std::size_t const n = c.colCount();
+    std::size_t const k = a.colCount();
+    if (a.rowCount() != m || b.rowCount() != k || b.colCount() != n)
+    {
+        throw std::out_of_range("Shape mismatch!");
+    }
+    if (kernel::worthBlocking(m, n, k))
+    {
+        gemm<X>(alpha, a.view(), b.view(), beta, c.view());
+        return;
+    }
+    // too small to be worth packing: accumulate row p of b, scaled by
+    // element i, p of a, into row i of c. Every inner loop then walks
+    // unit-stride memory.
+    for (std::size_t i = 0; i < m; i++)
+    {
+        X *row = c.data() + i * c.leadingDimension();
+        if (beta == X{0})
+        {
+            std::fill(row, row + n, X{0});
+        }
+        else if (beta != X{1})
+        {
+            kernel::scale(n, X(beta), row, row);
+        }
+        for (std::size_t p = 0; p < k; p++)
+        {
+            X const factor = X(alpha) * a.data()[i * a.leadingDimension() + p];
+            W const *from = b.data() + p * b.leadingDimension();
+            for (std::size_t j = 0; j < n; j++)
+            {
+                row[j] += factor * from[j];
+            }
+        }
+    }
+}
+
+template <CONCEPT_NAMESPACE Floating X, CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W>
+void ml::gemv(typename std::common_type<X>::type alpha, Matrix<V> const &a, W const *x, typename std::common_type<X>::type beta, X *y)
+{
+    std::size_t const m = a.rowCount();
+    std::size_t const n = a.colCount();
+    std::size_t const lda = a.leadingDimension();
+    thread::parallelFor(0, m, thread::grainFor(m, 2 * n), [&](std::size_t first, std::size_t last)
+    {
+        kernel::gemv(last - first, n, X(alpha), a.data() + first * lda, lda, x, X(beta), y + first);
+    });
+}
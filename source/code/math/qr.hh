@@ -0,0 +1,101 @@
+/**
+ * @file qr.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Householder QR factorization and linear least squares.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "matrix.hh"
+
+#include <cstddef>
+#include <vector>
+
+namespace ml
+{
+    /**
+     * @brief The factorization A = Q * R of an m x n matrix A, where Q is
+     * orthogonal and R is upper triangular. Its main use is fitting: the x
+     * that minimizes the length of A * x - b comes from R alone, without
+     * forming transpose ( A ) * A, which squares the condition number.
+     * @details Q is a product of Householder reflections, kept as their
+     * vectors below the diagonal of R. Columns are factored in panels, and
+     * each panel's reflections are gathered into the compact WY form
+     * I - Y * T * transpose ( Y ), so the rest of the matrix (and anything Q
+     * is later applied to) is updated with three matrix products per panel
+     * through the blocked, threaded GEMM.
+     * @note Pass the matrix with std::move to factor it in place without
+     * making a copy.
+     * @note A is rank deficient here if some diagonal element of R is
+     * exactly zero. Solving with such a factorization throws
+     * std::runtime_error.
+     */
+    template < CONCEPT_NAMESPACE Floating V > class QR
+    {
+        Matrix< V >                factors;
+        std::vector< V >           scales;
+        std::vector< Matrix< V > > blocks;
+        bool                       deficient = false;
+
+        void factor ( );
+
+        // the reflection vectors of the panel of columns first to last,
+        // from row first down, with their ones and zeros filled in.
+        Matrix< V > reflections ( std::size_t first, std::size_t last ) const;
+
+        // b <- transpose ( Q ) * b, or Q * b.
+        template < class X >
+        void apply ( Matrix< X > &b, bool transposed ) const;
+    public:
+        explicit QR ( Matrix< V > matrix );
+
+        std::size_t rowCount ( ) const NOEXCEPT;
+        std::size_t colCount ( ) const NOEXCEPT;
+
+        bool isRankDeficient ( ) const NOEXCEPT;
+
+        // the first min ( m, n ) columns of Q, which is all A needs.
+        Matrix< V > q ( ) const;
+        // the first min ( m, n ) rows of R; the rest are zeros.
+        Matrix< V > r ( ) const;
+
+        /**
+         * @brief x minimizing the length of A * x - b, which solves A * x = b
+         * when A is square.
+         * @throws std::out_of_range if A has more columns than rows or b is
+         * the wrong length, and std::runtime_error if A is rank deficient.
+         */
+        template < CONCEPT_NAMESPACE Floating W = V,
+                   CONCEPT_NAMESPACE Floating X = decltype ( V { 0 }
+                                                             + W { 0 } ) >
+        std::vector< X > solve ( std::vector< W > const &b ) const;
+
+        // the same for every column of B at once.
+        template < CONCEPT_NAMESPACE Floating W = V,
+                   CONCEPT_NAMESPACE Floating X = decltype ( V { 0 }
+                                                             + W { 0 } ) >
+        Matrix< X > solve ( Matrix< W > const &b ) const;
+    };
+
+    /**
+     * @brief The least squares solution of A * x = b, by QR. Factor once
+     * with QR instead to fit several right hand sides one at a time.
+     * @throws as QR::solve.
+     */
+    template < CONCEPT_NAMESPACE Floating V,
+               CONCEPT_NAMESPACE Floating W,
+               CONCEPT_NAMESPACE Floating X = decltype ( V { 0 } + W { 0 } ) >
+    std::vector< X > leastSquares ( Matrix< V > a, std::vector< W > const &b );
+
+    template < CONCEPT_NAMESPACE Floating V,
+               CONCEPT_NAMESPACE Floating W,
+               CONCEPT_NAMESPACE Floating X = decltype ( V { 0 } + W { 0 } ) >
+    Matrix< X > leastSquares ( Matrix< V > a, Matrix< W > const &b );
+} // namespace ml
+
+#include "qr.tcc"
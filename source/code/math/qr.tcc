@@ -0,0 +1,403 @@
+/**
+ * @file qr.tcc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief This C++ file is meant to be included only in qr.hh
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace ml
+{
+    namespace qr
+    {
+        // turns the count elements of x, stride apart, into the reflection
+        // that takes them to a multiple of the first: x [ 0 ] becomes that
+        // multiple and the rest become the reflection's vector after its
+        // leading one. Returns the reflection's scale, which is zero when
+        // there is nothing to reflect. The elements are scaled by the
+        // largest so that squaring them cannot overflow.
+        template < class V >
+        V householder ( V *x, std::size_t count, std::size_t stride )
+        {
+            using std::abs;
+            using std::sqrt;
+            V largest = V { 0 };
+            for ( std::size_t i = 0; i < count; i++ )
+            {
+                largest = std::max ( largest, V ( abs ( x [ i * stride ] ) ) );
+            }
+            if ( largest == V { 0 } )
+            {
+                return V { 0 };
+            }
+            V const alpha = x [ 0 ];
+            V       below = V { 0 };
+            for ( std::size_t i = 1; i < count; i++ )
+            {
+                V const y = x [ i * stride ] / largest;
+                below += y * y;
+            }
+            if ( below == V { 0 } )
+            {
+                return V { 0 };
+            }
+            V const ratio = alpha / largest;
+            V const norm  = largest * sqrt ( ratio * ratio + below );
+            V const beta  = alpha < V { 0 } ? norm : -norm;
+            V const f     = V { 1 } / ( alpha - beta );
+            for ( std::size_t i = 1; i < count; i++ ) { x [ i * stride ] *= f; }
+            x [ 0 ] = beta;
+            return ( beta - alpha ) / beta;
+        }
+
+        // T such that the reflections in the columns of Y, with the scales
+        // given, multiply out to I - Y * T * transpose ( Y ). T is built a
+        // column at a time from the inner products of the reflections.
+        template < class V >
+        Matrix< V > gather ( Matrix< V > const &y, V const *scales )
+        {
+            std::size_t const width = y.colCount ( );
+            Matrix< V >       g { width, width };
+            kernel::gemm ( width,
+                           width,
+                           y.rowCount ( ),
+                           V { 1 },
+                           y.data ( ),
+                           std::size_t { 1 },
+                           y.leadingDimension ( ),
+                           y.data ( ),
+                           y.leadingDimension ( ),
+                           std::size_t { 1 },
+                           V { 0 },
+                           g.data ( ),
+                           g.leadingDimension ( ) );
+            Matrix< V > t { width, width };
+            for ( std::size_t i = 0; i < width; i++ )
+            {
+                for ( std::size_t p = 0; p < i; p++ )
+                {
+                    V s = V { 0 };
+                    for ( std::size_t q = p; q < i; q++ )
+                    {
+                        s += t [ p ][ q ] * g [ q ][ i ];
+                    }
+                    t [ p ][ i ] = -scales [ i ] * s;
+                }
+                t [ i ][ i ] = scales [ i ];
+            }
+            return t;
+        }
+
+        // b <- ( I - Y * T * transpose ( Y ) ) * b, with T transposed if
+        // asked, for the rows x cols block b. Y is rows x width.
+        template < class X, class V >
+        void reflect ( Matrix< V > const &y,
+                       Matrix< V > const &t,
+                       bool               transposed,
+                       X                 *b,
+                       std::size_t        ldb,
+                       std::size_t        cols )
+        {
+            std::size_t const rows  = y.rowCount ( );
+            std::size_t const width = y.colCount ( );
+            if ( cols == 0 )
+            {
+                return;
+            }
+            std::size_t const ldy = y.leadingDimension ( );
+            std::size_t const ldt = t.leadingDimension ( );
+            Matrix< X >       w { width, cols };
+            Matrix< X >       tw { width, cols };
+            // W = transpose ( Y ) * B
+            kernel::gemm ( width,
+                           cols,
+                           rows,
+                           X { 1 },
+                           y.data ( ),
+                           std::size_t { 1 },
+                           ldy,
+                           b,
+                           ldb,
+                           std::size_t { 1 },
+                           X { 0 },
+                           w.data ( ),
+                           w.leadingDimension ( ) );
+            // W = T * W, or transpose ( T ) * W
+            kernel::gemm ( width,
+                           cols,
+                           width,
+                           X { 1 },
+                           t.data ( ),
+                           transposed ? std::size_t { 1 } : ldt,
+                           transposed ? ldt : std::size_t { 1 },
+                           w.data ( ),
+                           w.leadingDimension ( ),
+                           std::size_t { 1 },
+                           X { 0 },
+                           tw.data ( ),
+                           tw.leadingDimension ( ) );
+            // B = B - Y * W
+            kernel::gemm ( rows,
+                           cols,
+                           width,
+                           X { -1 },
+                           y.data ( ),
+                           ldy,
+                           std::size_t { 1 },
+                           tw.data ( ),
+                           tw.leadingDimension ( ),
+                           std::size_t { 1 },
+                           X { 1 },
+                           b,
+                           ldb );
+        }
+    } // namespace qr
+} // namespace ml
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::QR< V >::QR ( Matrix< V > matrix ) : factors ( std::move ( matrix ) )
+{
+    factor ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V > void ml::QR< V >::factor ( )
+{
+    std::size_t const m  = rowCount ( );
+    std::size_t const n  = colCount ( );
+    std::size_t const k  = std::min ( m, n );
+    std::size_t const ld = factors.leadingDimension ( );
+    V *const          a  = factors.data ( );
+    scales.assign ( k, V { 0 } );
+
+    // the panel is worked on a column at a time, so it is kept narrower
+    // than LU's.
+    std::size_t const block = 32;
+    std::vector< V >  w ( block );
+    for ( std::size_t k0 = 0; k0 < k; k0 += block )
+    {
+        std::size_t const k1 = std::min ( k, k0 + block );
+        for ( std::size_t j = k0; j < k1; j++ )
+        {
+            // the reflection that zeros column j below the diagonal.
+            V const tau = qr::householder ( a + j * ld + j, m - j, ld );
+            deficient   = deficient || a [ j * ld + j ] == V { 0 };
+            if ( tau == V { 0 } )
+            {
+                continue;
+            }
+            scales [ j ] = tau;
+
+            // and its effect on the rest of the panel, a row at a time.
+            std::size_t const rest = k1 - j - 1;
+            std::copy ( a + j * ld + j + 1, a + j * ld + k1, w.begin ( ) );
+            for ( std::size_t i = j + 1; i < m; i++ )
+            {
+                V const *row = a + i * ld;
+                for ( std::size_t c = 0; c < rest; c++ )
+                {
+                    w [ c ] += row [ j ] * row [ j + 1 + c ];
+                }
+            }
+            for ( std::size_t c = 0; c < rest; c++ )
+            {
+                a [ j * ld + j + 1 + c ] -= tau * w [ c ];
+            }
+            for ( std::size_t i = j + 1; i < m; i++ )
+            {
+                V *row = a + i * ld;
+                for ( std::size_t c = 0; c < rest; c++ )
+                {
+                    row [ j + 1 + c ] -= tau * row [ j ] * w [ c ];
+                }
+            }
+        }
+
+        // gather the panel into I - Y * T * transpose ( Y ).
+        Matrix< V > const y = reflections ( k0, k1 );
+        Matrix< V >       t = qr::gather ( y, scales.data ( ) + k0 );
+        if ( k1 < n )
+        {
+            qr::reflect ( y, t, true, a + k0 * ld + k1, ld, n - k1 );
+        }
+        blocks.push_back ( std::move ( t ) );
+    }
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > ml::QR< V >::reflections ( std::size_t first,
+                                           std::size_t last ) const
+{
+    std::size_t const rows = rowCount ( ) - first;
+    Matrix< V >       y { rows, last - first };
+    std::size_t const ld = factors.leadingDimension ( );
+    V const          *a  = factors.data ( ) + first * ld;
+    for ( std::size_t i = 0; i < rows; i++ )
+    {
+        V const *row = a + i * ld + first;
+        for ( std::size_t j = 0; j < last - first && j <= i; j++ )
+        {
+            y [ i ][ j ] = i == j ? V { 1 } : row [ j ];
+        }
+    }
+    return y;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+template < class X >
+void ml::QR< V >::apply ( Matrix< X > &b, bool transposed ) const
+{
+    std::size_t const k     = scales.size ( );
+    std::size_t const block = k == 0 ? 1 : blocks.front ( ).rowCount ( );
+    std::size_t const ldb   = b.leadingDimension ( );
+    for ( std::size_t p = 0; p < blocks.size ( ); p++ )
+    {
+        // transpose ( Q ) takes the panels first to last, Q last to first.
+        std::size_t const which = transposed ? p : blocks.size ( ) - 1 - p;
+        std::size_t const k0    = which * block;
+        std::size_t const k1    = std::min ( k, k0 + block );
+        qr::reflect ( reflections ( k0, k1 ),
+                      blocks [ which ],
+                      transposed,
+                      b.data ( ) + k0 * ldb,
+                      ldb,
+                      b.colCount ( ) );
+    }
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::QR< V >::rowCount ( ) const noexcept
+{
+    return factors.rowCount ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::QR< V >::colCount ( ) const noexcept
+{
+    return factors.colCount ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+bool ml::QR< V >::isRankDeficient ( ) const noexcept
+{
+    return deficient || rowCount ( ) < colCount ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > ml::QR< V >::q ( ) const
+{
+    std::size_t const k = scales.size ( );
+    Matrix< V >       output { rowCount ( ), k };
+    for ( std::size_t i = 0; i < k; i++ ) { output [ i ][ i ] = V { 1 }; }
+    apply ( output, false );
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > ml::QR< V >::r ( ) const
+{
+    std::size_t const k = scales.size ( );
+    std::size_t const n = colCount ( );
+    Matrix< V >       output { k, n };
+    for ( std::size_t i = 0; i < k; i++ )
+    {
+        V const *row = factors.data ( ) + i * factors.leadingDimension ( );
+        V       *out = output.data ( ) + i * output.leadingDimension ( );
+        std::copy ( row + i, row + n, out + i );
+    }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+template < CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X >
+std::vector< X > ml::QR< V >::solve ( std::vector< W > const &b ) const
+{
+    if ( b.size ( ) != rowCount ( ) )
+    {
+        throw std::out_of_range ( "Vector length mismatch!" );
+    }
+    Matrix< X > column { rowCount ( ), 1 };
+    for ( std::size_t i = 0; i < b.size ( ); i++ )
+    {
+        column [ i ][ 0 ] = X ( b [ i ] );
+    }
+    Matrix< X > const x = solve< X, X > ( column );
+    std::vector< X >  output ( colCount ( ) );
+    for ( std::size_t i = 0; i < output.size ( ); i++ )
+    {
+        output [ i ] = x [ i ][ 0 ];
+    }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+template < CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X >
+ml::Matrix< X > ml::QR< V >::solve ( Matrix< W > const &b ) const
+{
+    if ( b.rowCount ( ) != rowCount ( ) )
+    {
+        throw std::out_of_range ( "Row count mismatch!" );
+    }
+    if ( rowCount ( ) < colCount ( ) )
+    {
+        throw std::out_of_range ( "More columns than rows!" );
+    }
+    if ( deficient )
+    {
+        throw std::runtime_error ( "Matrix is rank deficient!" );
+    }
+    std::size_t const m = rowCount ( );
+    std::size_t const n = colCount ( );
+    std::size_t const c = b.colCount ( );
+    Matrix< X >       y { m, c };
+    for ( std::size_t i = 0; i < m; i++ )
+    {
+        W const *row = b.data ( ) + i * b.leadingDimension ( );
+        std::copy ( row, row + c, y.data ( ) + i * y.leadingDimension ( ) );
+    }
+    // transpose ( Q ) * b, whose first n rows are R * x and whose other rows
+    // are the residual, which no x can reduce.
+    apply ( y, true );
+
+    std::size_t const ldy = y.leadingDimension ( );
+    X *const          out = y.data ( );
+    kernel::trsm ( kernel::Triangle::Upper,
+                   kernel::Diagonal::General,
+                   n,
+                   c,
+                   factors.data ( ),
+                   factors.leadingDimension ( ),
+                   std::size_t { 1 },
+                   out,
+                   ldy );
+    Matrix< X > x { n, c };
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        X const *row = out + i * ldy;
+        std::copy ( row, row + c, x.data ( ) + i * x.leadingDimension ( ) );
+    }
+    return x;
+}
+
+template < CONCEPT_NAMESPACE Floating V,
+           CONCEPT_NAMESPACE Floating W,
+           CONCEPT_NAMESPACE Floating X >
+std::vector< X > ml::leastSquares ( Matrix< V > a, std::vector< W > const &b )
+{
+    return QR< V > ( std::move ( a ) ).template solve< W, X > ( b );
+}
+
+template < CONCEPT_NAMESPACE Floating V,
+           CONCEPT_NAMESPACE Floating W,
+           CONCEPT_NAMESPACE Floating X >
+ml::Matrix< X > ml::leastSquares ( Matrix< V > a, Matrix< W > const &b )
+{
+    return QR< V > ( std::move ( a ) ).template solve< W, X > ( b );
+}
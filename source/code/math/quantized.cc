@@ -0,0 +1,320 @@
+/**
+ * @file quantized.cc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Quantizing to 8 bit integers, and products that dequantize as they
+ * write.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#include "quantized.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+    // the byte kernels need every integer in [-127, 127].
+    std::int32_t clamp ( long x ) NOEXCEPT
+    {
+        return std::int32_t ( std::min ( 127L, std::max ( -127L, x ) ) );
+    }
+
+    // rows x columns of C for each call of the byte kernel: the integer
+    // sums stay in a 16 kB tile on the stack until they are dequantized.
+    std::size_t const tileRows = 32;
+    std::size_t const tileCols = 128;
+} // namespace
+
+ml::QuantizedMatrix::QuantizedMatrix ( Matrix< Single > const &matrix,
+                                       Quantization            quantization,
+                                       Scales                  scaling ) :
+    entries ( matrix.rowCount ( ) * matrix.colCount ( ) ),
+    nRows ( matrix.rowCount ( ) ),
+    nCols ( matrix.colCount ( ) ),
+    kind ( quantization ),
+    axis ( scaling )
+{
+    std::size_t const groups = axis == Scales::Rows ? nRows : nCols;
+    std::size_t const ld     = matrix.leadingDimension ( );
+    Single const     *data   = matrix.data ( );
+
+    // the range of each group, which always takes in zero.
+    std::vector< Single > low ( groups, 0 ), high ( groups, 0 );
+    for ( std::size_t i = 0; i < nRows; i++ )
+    {
+        for ( std::size_t j = 0; j < nCols; j++ )
+        {
+            std::size_t const g = axis == Scales::Rows ? i : j;
+            low [ g ]           = std::min ( low [ g ], data [ i * ld + j ] );
+            high [ g ]          = std::max ( high [ g ], data [ i * ld + j ] );
+        }
+    }
+    factors.assign ( groups, 1 );
+    if ( kind == Quantization::Asymmetric )
+    {
+        zeros.assign ( groups, 0 );
+    }
+    for ( std::size_t g = 0; g < groups; g++ )
+    {
+        if ( kind == Quantization::Symmetric )
+        {
+            Single const top = std::max ( -low [ g ], high [ g ] );
+            factors [ g ]    = top > 0 ? top / 127 : 1;
+        }
+        else
+        {
+            Single const span = high [ g ] - low [ g ];
+            factors [ g ]     = span > 0 ? span / 254 : 1;
+            zeros [ g ] = clamp ( std::lround ( -127 - low [ g ] / factors [ g ] ) );
+        }
+    }
+
+    for ( std::size_t i = 0; i < nRows; i++ )
+    {
+        for ( std::size_t j = 0; j < nCols; j++ )
+        {
+            std::size_t const g = axis == Scales::Rows ? i : j;
+            long const        q = std::lround ( data [ i * ld + j ] / factors [ g ] );
+            entries [ i * nCols + j ] =
+                    std::int8_t ( clamp ( q + ( zeros.empty ( ) ? 0 : zeros [ g ] ) ) );
+        }
+    }
+}
+
+ml::Matrix< Single > ml::QuantizedMatrix::toMatrix ( ) const
+{
+    Matrix< Single > output { nRows, nCols };
+    for ( std::size_t i = 0; i < nRows; i++ )
+    {
+        for ( std::size_t j = 0; j < nCols; j++ )
+        {
+            output [ i ][ j ] = ( *this ) ( i, j );
+        }
+    }
+    return output;
+}
+
+std::size_t ml::QuantizedMatrix::rowCount ( ) const NOEXCEPT { return nRows; }
+
+std::size_t ml::QuantizedMatrix::colCount ( ) const NOEXCEPT { return nCols; }
+
+ml::Quantization ml::QuantizedMatrix::quantization ( ) const NOEXCEPT
+{
+    return kind;
+}
+
+ml::Scales ml::QuantizedMatrix::scaling ( ) const NOEXCEPT { return axis; }
+
+std::vector< std::int8_t > const &ml::QuantizedMatrix::values ( ) const NOEXCEPT
+{
+    return entries;
+}
+
+std::vector< Single > const &ml::QuantizedMatrix::scales ( ) const NOEXCEPT
+{
+    return factors;
+}
+
+std::vector< std::int32_t > const &
+ml::QuantizedMatrix::zeroPoints ( ) const NOEXCEPT
+{
+    return zeros;
+}
+
+Single ml::QuantizedMatrix::operator( ) ( std::size_t row, std::size_t col ) const
+{
+    if ( row >= nRows || col >= nCols )
+    {
+        throw std::out_of_range ( "Element out of range!" );
+    }
+    std::size_t const  g    = axis == Scales::Rows ? row : col;
+    std::int32_t const zero = zeros.empty ( ) ? 0 : zeros [ g ];
+    return factors [ g ] * Single ( entries [ row * nCols + col ] - zero );
+}
+
+std::vector< Single >
+ml::QuantizedMatrix::operator* ( std::vector< Single > const &input ) const
+{
+    if ( input.size ( ) != nCols )
+    {
+        throw std::out_of_range ( "Vector length mismatch!" );
+    }
+    std::vector< Single > output ( nRows );
+    qgemv ( 1, *this, input.data ( ), 0, output.data ( ) );
+    return output;
+}
+
+ml::Matrix< Single >
+ml::QuantizedMatrix::operator* ( Matrix< Single > const &that ) const
+{
+    return *this * QuantizedMatrix { that, Quantization::Symmetric, Scales::Columns };
+}
+
+ml::Matrix< Single >
+ml::QuantizedMatrix::operator* ( QuantizedMatrix const &that ) const
+{
+    Matrix< Single > output { nRows, that.colCount ( ) };
+    qgemm ( 1, *this, that, 0, output );
+    return output;
+}
+
+void ml::qgemv ( Single                 alpha,
+                 QuantizedMatrix const &a,
+                 Single const          *x,
+                 Single                 beta,
+                 Single                *y )
+{
+    std::size_t const m       = a.rowCount ( );
+    std::size_t const n       = a.colCount ( );
+    bool const        columns = a.scaling ( ) == Scales::Columns;
+    std::vector< Single > const       &scales = a.scales ( );
+    std::vector< std::int32_t > const &zeros  = a.zeroPoints ( );
+
+    // with A = sA * ( qA - zA ) per column, A * x = qA * ( sA x ) - zA . sA x,
+    // so the column scales go into x and the zero points make one number.
+    std::vector< Single > scaled ( x, x + n );
+    Single                offset = 0, top = 0;
+    for ( std::size_t j = 0; j < n; j++ )
+    {
+        if ( columns )
+        {
+            scaled [ j ] *= scales [ j ];
+            offset += zeros.empty ( ) ? 0 : zeros [ j ] * scaled [ j ];
+        }
+        top = std::max ( top, std::abs ( scaled [ j ] ) );
+    }
+    Single const               step = top > 0 ? top / 127 : 1;
+    std::vector< std::int8_t > q ( n );
+    std::int64_t               total = 0;
+    for ( std::size_t j = 0; j < n; j++ )
+    {
+        q [ j ] = std::int8_t ( clamp ( std::lround ( scaled [ j ] / step ) ) );
+        total += q [ j ];
+    }
+
+    // per row, A * x = sA * step * ( qA . q - zA * the sum of q ).
+    std::int8_t const *values = a.values ( ).data ( );
+    simd::Bytes const &bytes  = simd::bytes ( );
+    thread::parallelFor (
+            0, m, thread::grainFor ( m, n ), [ & ] ( std::size_t first, std::size_t last ) {
+                std::int32_t sums [ tileRows ];
+                for ( std::size_t i = first; i < last; i += tileRows )
+                {
+                    std::size_t const count = std::min ( tileRows, last - i );
+                    bytes.gemm ( count, 1, n, values + i * n, n, q.data ( ), n, sums, 1 );
+                    for ( std::size_t r = 0; r < count; r++ )
+                    {
+                        Single value;
+                        if ( columns )
+                        {
+                            value = step * Single ( sums [ r ] ) - offset;
+                        }
+                        else
+                        {
+                            std::int64_t const zero = zeros.empty ( ) ? 0 : zeros [ i + r ];
+                            value = scales [ i + r ] * step
+                                  * Single ( sums [ r ] - zero * total );
+                        }
+                        y [ i + r ] = beta == 0 ? alpha * value
+                                                : alpha * value + beta * y [ i + r ];
+                    }
+                }
+            } );
+}
+
+void ml::qgemm ( Single                 alpha,
+                 QuantizedMatrix const &a,
+                 QuantizedMatrix const &b,
+                 Single                 beta,
+                 Matrix< Single >      &c )
+{
+    std::size_t const m = a.rowCount ( );
+    std::size_t const k = a.colCount ( );
+    std::size_t const n = b.colCount ( );
+    if ( b.rowCount ( ) != k || c.rowCount ( ) != m || c.colCount ( ) != n )
+    {
+        throw std::out_of_range ( "Shape mismatch!" );
+    }
+    if ( a.scaling ( ) != Scales::Rows || b.scaling ( ) != Scales::Columns )
+    {
+        throw std::invalid_argument ( "Scales along the inner dimension!" );
+    }
+
+    // the kernels take B by columns, and the zero points of each side need
+    // the integer sums of the other.
+    std::vector< std::int8_t > columns ( n * k );
+    std::vector< std::int64_t > rowSums, colSums;
+    std::vector< std::int32_t > const &za = a.zeroPoints ( ), &zb = b.zeroPoints ( );
+    std::int8_t const *const           qa = a.values ( ).data ( );
+    std::int8_t const *const           qb = b.values ( ).data ( );
+    for ( std::size_t p = 0; p < k; p++ )
+    {
+        for ( std::size_t j = 0; j < n; j++ ) { columns [ j * k + p ] = qb [ p * n + j ]; }
+    }
+    if ( !zb.empty ( ) )
+    {
+        rowSums.assign ( m, 0 );
+        for ( std::size_t i = 0; i < m; i++ )
+        {
+            for ( std::size_t p = 0; p < k; p++ ) { rowSums [ i ] += qa [ i * k + p ]; }
+        }
+    }
+    if ( !za.empty ( ) )
+    {
+        colSums.assign ( n, 0 );
+        for ( std::size_t j = 0; j < n; j++ )
+        {
+            for ( std::size_t p = 0; p < k; p++ ) { colSums [ j ] += columns [ j * k + p ]; }
+        }
+    }
+
+    std::vector< Single > const &sa    = a.scales ( );
+    std::vector< Single > const &sb    = b.scales ( );
+    simd::Bytes const           &bytes = simd::bytes ( );
+    std::size_t const            ldc   = c.leadingDimension ( );
+    Single *const                out   = c.data ( );
+    std::size_t const            tiles = ( m + tileRows - 1 ) / tileRows;
+    thread::parallelFor (
+            0, tiles, thread::grainFor ( tiles, 2 * tileRows * k * n ),
+            [ & ] ( std::size_t first, std::size_t last ) {
+                std::int32_t sums [ tileRows * tileCols ];
+                for ( std::size_t j = 0; j < n; j += tileCols )
+                {
+                    std::size_t const width = std::min ( tileCols, n - j );
+                    for ( std::size_t t = first; t < last; t++ )
+                    {
+                        std::size_t const i      = t * tileRows;
+                        std::size_t const height = std::min ( tileRows, m - i );
+                        bytes.gemm ( height, width, k, qa + i * k, k,
+                                     columns.data ( ) + j * k, k, sums, tileCols );
+                        for ( std::size_t r = 0; r < height; r++ )
+                        {
+                            std::int64_t const zr = za.empty ( ) ? 0 : za [ i + r ];
+                            Single *const      row = out + ( i + r ) * ldc + j;
+                            for ( std::size_t s = 0; s < width; s++ )
+                            {
+                                std::int64_t sum = sums [ r * tileCols + s ];
+                                if ( !zb.empty ( ) )
+                                {
+                                    sum -= zb [ j + s ] * ( rowSums [ i + r ]
+                                                            - std::int64_t ( k ) * zr );
+                                }
+                                if ( zr != 0 )
+                                {
+                                    sum -= zr * colSums [ j + s ];
+                                }
+                                Single const value =
+                                        sa [ i + r ] * sb [ j + s ] * Single ( sum );
+                                row [ s ] = beta == 0 ? alpha * value
+                                                      : alpha * value + beta * row [ s ];
+                            }
+                        }
+                    }
+                }
+            } );
+}
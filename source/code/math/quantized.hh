@@ -0,0 +1,131 @@
+/**
+ * @file quantized.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Matrices of 8 bit integers with Single scales, for inference.
+ * @details A QuantizedMatrix keeps a Matrix< Single > in a quarter of the
+ * memory. Its products multiply the bytes on the integer kernels of
+ * simd::bytes, which sum them exactly in 32 bits (with VNNI or the dot
+ * product instructions where the processor has them), and each sum turns
+ * back into a Single as it is written, so no matrix of Singles is ever
+ * rebuilt.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "matrix.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ml
+{
+    /**
+     * @brief How the values of a QuantizedMatrix map to integers. Symmetric
+     * maps zero to zero and the largest magnitude to 127, so x = scale * q.
+     * Asymmetric maps the range of the values (widened to take in zero)
+     * onto [-127, 127], so x = scale * ( q - zero point ), which spends all
+     * the levels on values that are mostly of one sign, e.g. after a ReLU.
+     */
+    enum class Quantization
+    {
+        Symmetric,
+        Asymmetric,
+    };
+
+    /**
+     * @brief Which elements share a scale (and zero point): those of each
+     * row, or those of each column.
+     */
+    enum class Scales
+    {
+        Rows,
+        Columns,
+    };
+
+    /**
+     * @brief A Matrix< Single > as 8 bit integers in [-127, 127], with a
+     * scale (and for Asymmetric, a zero point) per row or per column.
+     * @note Each element is off by at most half of its scale, e.g. 1 / 254
+     * of the largest magnitude of its row for Symmetric per row.
+     */
+    class QuantizedMatrix
+    {
+        std::vector< std::int8_t >  entries;
+        std::vector< Single >       factors;
+        std::vector< std::int32_t > zeros;
+        std::size_t                 nRows = 0;
+        std::size_t                 nCols = 0;
+        Quantization                kind  = Quantization::Symmetric;
+        Scales                      axis  = Scales::Rows;
+    public:
+        QuantizedMatrix ( ) = default;
+
+        explicit QuantizedMatrix (
+                Matrix< Single > const &matrix,
+                Quantization            quantization = Quantization::Symmetric,
+                Scales                  scaling      = Scales::Rows );
+
+        // the Singles that the integers stand for.
+        Matrix< Single > toMatrix ( ) const;
+
+        std::size_t  rowCount ( ) const NOEXCEPT;
+        std::size_t  colCount ( ) const NOEXCEPT;
+        Quantization quantization ( ) const NOEXCEPT;
+        Scales       scaling ( ) const NOEXCEPT;
+
+        // the integers, row major with colCount ( ) to a row.
+        std::vector< std::int8_t > const &values ( ) const NOEXCEPT;
+        // one per row or per column, as scaling ( ) says.
+        std::vector< Single > const &scales ( ) const NOEXCEPT;
+        // the same, but empty when Symmetric.
+        std::vector< std::int32_t > const &zeroPoints ( ) const NOEXCEPT;
+
+        // element row, col, as a Single.
+        Single operator( ) ( std::size_t row, std::size_t col ) const;
+
+        // see qgemv.
+        std::vector< Single > operator* ( std::vector< Single > const &input ) const;
+
+        // see qgemm, with that quantized Symmetric per column first.
+        Matrix< Single > operator* ( Matrix< Single > const &that ) const;
+        Matrix< Single > operator* ( QuantizedMatrix const &that ) const;
+    };
+
+    /**
+     * @brief y = alpha * A * x + beta * y for a quantized A on raw spans,
+     * where x has A.colCount ( ) elements and y has A.rowCount ( ). x is
+     * quantized Symmetric with one scale, after A's column scales are
+     * multiplied into it if it has them, each row is one integer dot
+     * product, and the scales and zero point turn it back into a Single as
+     * it is written. The rows are split across the thread pool.
+     * @note y is not read when beta is zero, and must not overlap x.
+     */
+    void qgemv ( Single                 alpha,
+                 QuantizedMatrix const &a,
+                 Single const          *x,
+                 Single                 beta,
+                 Single                *y );
+
+    /**
+     * @brief C = alpha * A * B + beta * C for quantized A and B, written
+     * into the storage C already has. The integer product runs on the byte
+     * kernels a block at a time, and each block is dequantized while it is
+     * still in cache, as sA * sB * ( the sum of qA * qB - zB * the row sum
+     * of qA - zA * the column sum of qB + k * zA * zB ).
+     * @throws std::out_of_range if the shapes do not line up, and
+     * std::invalid_argument if A has a scale per column or B per row: a
+     * scale that changes along the sum does not come out of it.
+     * @note C is not read when beta is zero.
+     */
+    void qgemm ( Single                 alpha,
+                 QuantizedMatrix const &a,
+                 QuantizedMatrix const &b,
+                 Single                 beta,
+                 Matrix< Single >      &c );
+} // namespace ml
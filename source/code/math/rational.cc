@@ -0,0 +1,368 @@
+/**
+ * @file rational.cc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Rational arithmetic, and Bareiss' elimination for the exact
+ * echelon, inverse, and determinant.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#include "rational.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using ml::BigInt;
+    using ml::Rational;
+
+#if defined( __SIZEOF_INT128__ )
+    __extension__ typedef __int128 Wide;
+#endif
+
+    // ( d * x - f * y ) / previous, which Bareiss guarantees is exact. When
+    // everything is small the products are done in 128 bits, so that
+    // intermediates too large for 64 bits do not leave the fast path when
+    // the result fits.
+    BigInt step ( BigInt const &d,
+                  BigInt const &x,
+                  BigInt const &f,
+                  BigInt const &y,
+                  BigInt const &previous )
+    {
+#if defined( __SIZEOF_INT128__ )
+        if ( d.isSmall ( ) && x.isSmall ( ) && f.isSmall ( ) && y.isSmall ( )
+             && previous.isSmall ( ) )
+        {
+            Wide const t = ( Wide ( d.smallValue ( ) ) * x.smallValue ( )
+                             - Wide ( f.smallValue ( ) ) * y.smallValue ( ) )
+                         / previous.smallValue ( );
+            if ( t >= INT64_MIN && t <= INT64_MAX )
+            {
+                return std::int64_t ( t );
+            }
+        }
+#endif
+        return ( d * x - f * y ) / previous;
+    }
+
+    /**
+     * @brief Bareiss' elimination on the m x n integers at a, row major,
+     * with pivots from the first columns columns. Each step replaces every
+     * other row by ( pivot * row - factor * pivot row ) / previous pivot,
+     * which is exact. Gauss-Jordan (jordan) clears above the pivots too and
+     * leaves the last pivot times the reduced echelon form; otherwise only
+     * below, as for a determinant, stopping at the first column without a
+     * pivot.
+     * @return the number of pivots, with last the last one and odd whether
+     * rows were swapped an odd number of times.
+     */
+    std::size_t bareiss ( std::vector< BigInt > &a,
+                          std::size_t            m,
+                          std::size_t            n,
+                          std::size_t            columns,
+                          bool                   jordan,
+                          BigInt                &last,
+                          bool                  &odd )
+    {
+        BigInt      previous = 1;
+        std::size_t row      = 0;
+        odd                  = false;
+        for ( std::size_t col = 0; col < columns && row < m; col++ )
+        {
+            // the smallest candidate keeps the products smallest.
+            std::size_t p = m;
+            for ( std::size_t i = row; i < m; i++ )
+            {
+                BigInt const &candidate = a [ i * n + col ];
+                if ( candidate.sign ( ) != 0
+                     && ( p == m
+                          || candidate.bitLength ( )
+                                     < a [ p * n + col ].bitLength ( ) ) )
+                {
+                    p = i;
+                }
+            }
+            if ( p == m )
+            {
+                if ( !jordan )
+                {
+                    break;
+                }
+                continue;
+            }
+            if ( p != row )
+            {
+                std::swap_ranges ( a.begin ( ) + p * n, a.begin ( ) + p * n + n,
+                                   a.begin ( ) + row * n );
+                odd = !odd;
+            }
+
+            // unlike floating point elimination, rows with a zero in the
+            // pivot column are still scaled, so no row can be skipped. Rows
+            // past the pivot row are zero left of col.
+            BigInt const     *pivot = a.data ( ) + row * n;
+            std::size_t const first = jordan ? 0 : row + 1;
+            ml::thread::parallelFor (
+                    first, m, ml::thread::grainFor ( m - first, 16 * n ),
+                    [ & ] ( std::size_t begin, std::size_t end ) {
+                        for ( std::size_t i = begin; i < end; i++ )
+                        {
+                            if ( i == row )
+                            {
+                                continue;
+                            }
+                            BigInt           *r      = a.data ( ) + i * n;
+                            BigInt const      factor = r [ col ];
+                            std::size_t const start  = i < row ? 0 : col + 1;
+                            for ( std::size_t j = start; j < n; j++ )
+                            {
+                                if ( j != col )
+                                {
+                                    r [ j ] = step ( pivot [ col ], r [ j ],
+                                                     factor, pivot [ j ],
+                                                     previous );
+                                }
+                            }
+                            r [ col ] = 0;
+                        }
+                    } );
+            previous = pivot [ col ];
+            row++;
+        }
+        last = previous;
+        return row;
+    }
+
+    // the rows of matrix as integers in the first columns of the width
+    // wide rows of a, each scaled by the least common multiple of its
+    // denominators, which goes in scales.
+    void toIntegers ( ml::Matrix< Rational > const &matrix,
+                      std::vector< BigInt >        &a,
+                      std::size_t                   width,
+                      std::vector< BigInt >        &scales )
+    {
+        std::size_t const m = matrix.rowCount ( );
+        std::size_t const n = matrix.colCount ( );
+        scales.assign ( m, 1 );
+        for ( std::size_t i = 0; i < m; i++ )
+        {
+            BigInt &scale = scales [ i ];
+            for ( Rational const &element : matrix [ i ] )
+            {
+                BigInt const &den = element.denominator ( );
+                scale             = scale / ml::gcd ( scale, den ) * den;
+            }
+            for ( std::size_t j = 0; j < n; j++ )
+            {
+                Rational const &element = matrix [ i ][ j ];
+                a [ i * width + j ] =
+                        element.numerator ( ) * ( scale / element.denominator ( ) );
+            }
+        }
+    }
+} // namespace
+
+ml::Rational::Rational ( BigInt numerator, BigInt denominator ) :
+    num ( std::move ( numerator ) ), den ( std::move ( denominator ) )
+{
+    if ( den.sign ( ) == 0 )
+    {
+        throw std::domain_error ( "Division by zero!" );
+    }
+    BigInt const g = gcd ( num, den );
+    if ( g != 1 )
+    {
+        num /= g;
+        den /= g;
+    }
+    if ( den.sign ( ) < 0 )
+    {
+        num = -num;
+        den = -den;
+    }
+}
+
+ml::Rational::Rational ( Double x )
+{
+    if ( !std::isfinite ( x ) )
+    {
+        throw std::domain_error ( "Rational of infinity or NaN!" );
+    }
+    // x = mantissa * 2^( exponent - 53 ) with a 53 bit integer mantissa.
+    int                exponent = 0;
+    Double const       fraction = std::frexp ( x, &exponent );
+    std::int64_t const mantissa = std::int64_t ( std::ldexp ( fraction, 53 ) );
+    if ( exponent >= 53 )
+    {
+        num = BigInt ( mantissa ) << std::size_t ( exponent - 53 );
+        return;
+    }
+    *this = Rational ( mantissa, BigInt ( 1 ) << std::size_t ( 53 - exponent ) );
+}
+
+ml::Rational::operator Double ( ) const NOEXCEPT
+{
+    // both exact as Doubles, so one rounding.
+    std::size_t const top = num.bitLength ( );
+    std::size_t const bottom = den.bitLength ( );
+    if ( top <= 53 && bottom <= 53 )
+    {
+        return Double ( num ) / Double ( den );
+    }
+    // otherwise a quotient of at least 64 bits, scaled back.
+    int const shift = 64 + int ( bottom ) - int ( top );
+    BigInt const q  = shift >= 0 ? ( num << std::size_t ( shift ) ) / den
+                                 : num / ( den << std::size_t ( -shift ) );
+    return std::ldexp ( Double ( q ), -shift );
+}
+
+ml::Rational ml::Rational::operator- ( ) const
+{
+    Rational output = *this;
+    output.num      = -num;
+    return output;
+}
+
+ml::Rational ml::operator+ ( Rational const &a, Rational const &b )
+{
+    if ( a.den == b.den )
+    {
+        return Rational ( a.num + b.num, a.den );
+    }
+    return Rational ( a.num * b.den + b.num * a.den, a.den * b.den );
+}
+
+ml::Rational ml::operator- ( Rational const &a, Rational const &b )
+{
+    if ( a.den == b.den )
+    {
+        return Rational ( a.num - b.num, a.den );
+    }
+    return Rational ( a.num * b.den - b.num * a.den, a.den * b.den );
+}
+
+ml::Rational ml::operator* ( Rational const &a, Rational const &b )
+{
+    return Rational ( a.num * b.num, a.den * b.den );
+}
+
+ml::Rational ml::operator/ ( Rational const &a, Rational const &b )
+{
+    return Rational ( a.num * b.den, a.den * b.num );
+}
+
+std::ostream &ml::operator<< ( std::ostream &out, Rational const &x )
+{
+    if ( x.denominator ( ) == 1 )
+    {
+        return out << x.numerator ( );
+    }
+    return out << x.numerator ( ).toString ( ) + "/"
+                          + x.denominator ( ).toString ( );
+}
+
+template <> void ml::Matrix< ml::Rational >::echelonInPlace ( )
+{
+    std::size_t const     m = rowCount ( );
+    std::size_t const     n = colCount ( );
+    std::vector< BigInt > a ( m * n ), scales;
+    toIntegers ( *this, a, n, scales );
+
+    BigInt            last;
+    bool              odd  = false;
+    std::size_t const rank = bareiss ( a, m, n, n, true, last, odd );
+    for ( std::size_t i = 0; i < m; i++ )
+    {
+        for ( std::size_t j = 0; j < n; j++ )
+        {
+            ( *this ) [ i ][ j ] =
+                    i < rank ? Rational ( a [ i * n + j ], last ) : Rational ( );
+        }
+    }
+}
+
+template <> ml::Matrix< ml::Rational > ml::Matrix< ml::Rational >::inverse ( )
+{
+    if ( rowCount ( ) != colCount ( ) )
+    {
+        throw std::runtime_error ( "No inverse!" );
+    }
+    // with S the row scales, M = S * A is integers and the inverse of A is
+    // the inverse of M times S.
+    std::size_t const     n = rowCount ( );
+    std::vector< BigInt > a ( 2 * n * n ), scales;
+    toIntegers ( *this, a, 2 * n, scales );
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        a [ i * 2 * n + n + i ] = 1;
+    }
+
+    BigInt last;
+    bool   odd = false;
+    if ( bareiss ( a, n, 2 * n, n, true, last, odd ) < n )
+    {
+        throw std::runtime_error ( "No inverse!" );
+    }
+    // the left half is now last * I, and the right last * the inverse of M.
+    Matrix< Rational > output { n, n };
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        for ( std::size_t j = 0; j < n; j++ )
+        {
+            output [ i ][ j ] =
+                    Rational ( a [ i * 2 * n + n + j ] * scales [ j ], last );
+        }
+    }
+    return output;
+}
+
+ml::BigInt ml::determinant ( Matrix< BigInt > const &matrix )
+{
+    std::size_t const n = matrix.rowCount ( );
+    if ( matrix.colCount ( ) != n )
+    {
+        throw std::out_of_range ( "Matrix is not square!" );
+    }
+    std::vector< BigInt > a ( n * n );
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        std::copy ( matrix [ i ].begin ( ), matrix [ i ].end ( ),
+                    a.begin ( ) + i * n );
+    }
+    BigInt last;
+    bool   odd = false;
+    if ( bareiss ( a, n, n, n, false, last, odd ) < n )
+    {
+        return 0;
+    }
+    return odd ? -last : last;
+}
+
+ml::Rational ml::determinant ( Matrix< Rational > const &matrix )
+{
+    std::size_t const n = matrix.rowCount ( );
+    if ( matrix.colCount ( ) != n )
+    {
+        throw std::out_of_range ( "Matrix is not square!" );
+    }
+    std::vector< BigInt > a ( n * n ), scales;
+    toIntegers ( matrix, a, n, scales );
+    BigInt last;
+    bool   odd = false;
+    if ( bareiss ( a, n, n, n, false, last, odd ) < n )
+    {
+        return 0;
+    }
+    // the determinant of S * A is that of A times every scale.
+    BigInt product = 1;
+    for ( BigInt const &scale : scales ) { product *= scale; }
+    return Rational ( odd ? -last : last, product );
+}
@@ -0,0 +1,190 @@
+/**
+ * @file rational.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Exact fractions, and exact elimination on matrices of them.
+ * @details A * A.inverse ( ) is only close to the identity in floating
+ * point. With Rational elements it is the identity: echelon, inverse and
+ * determinant of a Matrix< Rational > are computed exactly by Bareiss'
+ * fraction-free elimination, which works on integers and divides every
+ * intermediate exactly by the previous pivot, so that each intermediate is
+ * a minor of the matrix and its size stays bounded by Hadamard's bound
+ * instead of doubling with every step as in naive integer elimination, and
+ * no fraction is reduced until the very end.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "bigint.hh"
+#include "matrix.hh"
+
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+namespace ml
+{
+    /**
+     * @brief A fraction of BigInts, always in lowest terms with a positive
+     * denominator, so equal values compare equal member by member.
+     * @note Every finite Double is a Rational exactly, e.g. Rational ( 0.1 )
+     * is 3602879701896397 / 36028797018963968, not 1 / 10; write Rational (
+     * 1, 10 ) for that.
+     */
+    class Rational
+    {
+        BigInt num;
+        BigInt den = 1;
+    public:
+        Rational ( ) = default;
+
+        template < class I,
+                   class = typename std::enable_if<
+                           std::is_integral< I >::value >::type >
+        Rational ( I x ) : num ( x )
+        {
+        }
+
+        Rational ( BigInt x ) : num ( std::move ( x ) ) { }
+
+        // numerator / denominator in lowest terms. Throws std::domain_error
+        // if denominator is zero.
+        Rational ( BigInt numerator, BigInt denominator );
+
+        // exactly x. Throws std::domain_error if x is infinite or NaN.
+        explicit Rational ( Double x );
+
+        BigInt const &numerator ( ) const NOEXCEPT { return num; }
+        BigInt const &denominator ( ) const NOEXCEPT { return den; }
+
+        // the nearest Double (to within an ulp), or infinity past its range.
+        explicit operator Double ( ) const NOEXCEPT;
+
+        Rational operator- ( ) const;
+        Rational operator+ ( ) const { return *this; }
+
+        friend Rational operator+ ( Rational const &a, Rational const &b );
+        friend Rational operator- ( Rational const &a, Rational const &b );
+        friend Rational operator* ( Rational const &a, Rational const &b );
+        // throws std::domain_error if b is zero.
+        friend Rational operator/ ( Rational const &a, Rational const &b );
+
+        Rational &operator+= ( Rational const &that )
+        {
+            return *this = *this + that;
+        }
+        Rational &operator-= ( Rational const &that )
+        {
+            return *this = *this - that;
+        }
+        Rational &operator*= ( Rational const &that )
+        {
+            return *this = *this * that;
+        }
+        Rational &operator/= ( Rational const &that )
+        {
+            return *this = *this / that;
+        }
+
+        friend bool operator== ( Rational const &a, Rational const &b )
+        {
+            return a.num == b.num && a.den == b.den;
+        }
+        friend bool operator!= ( Rational const &a, Rational const &b )
+        {
+            return !( a == b );
+        }
+        friend bool operator< ( Rational const &a, Rational const &b )
+        {
+            return a.num * b.den < b.num * a.den;
+        }
+        friend bool operator> ( Rational const &a, Rational const &b )
+        {
+            return b < a;
+        }
+        friend bool operator<= ( Rational const &a, Rational const &b )
+        {
+            return !( b < a );
+        }
+        friend bool operator>= ( Rational const &a, Rational const &b )
+        {
+            return !( a < b );
+        }
+    };
+
+    Rational operator+ ( Rational const &a, Rational const &b );
+    Rational operator- ( Rational const &a, Rational const &b );
+    Rational operator* ( Rational const &a, Rational const &b );
+    Rational operator/ ( Rational const &a, Rational const &b );
+
+    inline Rational abs ( Rational const &x )
+    {
+        return x.numerator ( ).sign ( ) < 0 ? -x : x;
+    }
+
+    // numerator / denominator, or just the numerator for integers.
+    std::ostream &operator<< ( std::ostream &out, Rational const &x );
+
+    template <> struct IsFloating< Rational > : std::true_type
+    {
+    };
+
+    template <> struct IsScalar< Rational > : std::true_type
+    {
+    };
+
+    /**
+     * @brief The reduced row echelon form, exactly. Each row is scaled to
+     * integers by the least common multiple of its denominators, and
+     * fraction-free Gauss-Jordan elimination leaves d times the reduced
+     * form with d the last pivot, which is divided out at the end. The rows
+     * are updated in parallel at every pivot.
+     */
+    template <> void Matrix< Rational >::echelonInPlace ( );
+
+    // exactly, from the same elimination on this next to the identity.
+    // Throws std::runtime_error if this is not square or is singular.
+    template <> Matrix< Rational > Matrix< Rational >::inverse ( );
+
+    // BigInt has no division that stays exact, so take a Matrix< Rational >.
+    template <> void Matrix< BigInt >::echelonInPlace ( )         = delete;
+    template <> Matrix< BigInt > Matrix< BigInt >::inverse ( ) = delete;
+
+    /**
+     * @brief The determinant, exactly, by Bareiss' elimination: the last
+     * pivot, up to the sign of the row swaps. A Matrix< BigInt > is
+     * eliminated as it is, and a Matrix< Rational > after its rows are
+     * scaled to integers.
+     * @throws std::out_of_range if the matrix is not square.
+     */
+    BigInt   determinant ( Matrix< BigInt > const &matrix );
+    Rational determinant ( Matrix< Rational > const &matrix );
+} // namespace ml
+
+namespace std
+{
+    template <> class numeric_limits< ml::Rational >
+    {
+    public:
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed      = true;
+        static constexpr bool is_integer     = false;
+        static constexpr bool is_exact       = true;
+        static constexpr bool is_bounded     = false;
+        static constexpr bool has_infinity   = false;
+        static constexpr bool has_quiet_NaN  = false;
+        static constexpr int  radix          = 2;
+
+        // rounding never happens.
+        static ml::Rational epsilon ( ) { return 0; }
+        static ml::Rational min ( ) { return 0; }
+        static ml::Rational max ( ) { return 0; }
+        static ml::Rational lowest ( ) { return 0; }
+    };
+} // namespace std
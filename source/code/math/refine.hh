@@ -0,0 +1,81 @@
+/**
+ * @file refine.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Solving in one precision with the factorization from a lower one.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "lu.hh"
+#include "matrix.hh"
+
+#include <cstddef>
+#include <vector>
+
+namespace ml
+{
+    /**
+     * @brief The result of an iteratively refined solve, and how it went.
+     */
+    template < CONCEPT_NAMESPACE Floating W > struct Refinement
+    {
+        std::vector< W > solution;
+        // the number of corrections added to the first solution.
+        std::size_t iterations = 0;
+        // whether the backward error reached working precision.
+        bool converged = false;
+        // the max norm of b - A * x over ||A|| * ||x|| + ||b||, for the
+        // returned x.
+        W backwardError = W { 0 };
+    };
+
+    /**
+     * @brief Solves A * x = b to the accuracy of W with the factorization of
+     * A in the lower precision V, e.g. Single and Double: the O(n^3) LU runs
+     * through the Single SIMD kernels, at about twice the speed of the
+     * Double one, and only O(n^2) work per iteration is done in W.
+     * @details The first solution comes from the factors. Each iteration
+     * then computes the residual r = b - A * x against A kept in W, solves
+     * A * d = r with the same factors, and adds d to x. This converges
+     * while A is not too ill-conditioned for V (its condition number well
+     * below 1 / epsilon of V), each iteration gaining about as many digits
+     * as V has; otherwise the residual stops shrinking and the result says
+     * so, and LU< W > is the fallback.
+     * @note A is kept in W as well as factored in V, so this takes 1.5
+     * times the memory of LU< W > for Single and Double. Elements of A too
+     * large for V make the factors infinite, which never converges.
+     */
+    template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
+    class RefinedLU
+    {
+        Matrix< W > original;
+        LU< V >     factors;
+        W           norm = W { 0 };
+        std::size_t limit;
+    public:
+        // throws std::out_of_range if the matrix is not square.
+        explicit RefinedLU ( Matrix< W > matrix,
+                             std::size_t maxIterations = 30 );
+
+        std::size_t size ( ) const NOEXCEPT;
+
+        // whether the factors in V are singular, which A itself may not be.
+        bool isSingular ( ) const NOEXCEPT;
+
+        /**
+         * @brief x such that A * x = b, refined until its backward error is
+         * within sqrt ( n ) * epsilon of W, it stops halving, or the
+         * iterations run out.
+         * @throws std::out_of_range if b is the wrong length, and
+         * std::runtime_error if the factors are singular.
+         */
+        Refinement< W > solve ( std::vector< W > const &b ) const;
+    };
+} // namespace ml
+
+#include "refine.tcc"
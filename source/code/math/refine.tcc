@@ -0,0 +1,119 @@
+/**
+ * @file refine.tcc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief This C++ file is meant to be included only in refine.hh
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace ml
+{
+    namespace refine
+    {
+        // the largest magnitude in x.
+        template < class W >
+        W largest ( W const *x, std::size_t count ) NOEXCEPT
+        {
+            using std::abs;
+            W output = W { 0 };
+            for ( std::size_t i = 0; i < count; i++ )
+            {
+                output = std::max ( output, W ( abs ( x [ i ] ) ) );
+            }
+            return output;
+        }
+    } // namespace refine
+} // namespace ml
+
+template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
+ml::RefinedLU< V, W >::RefinedLU ( Matrix< W > matrix,
+                                   std::size_t maxIterations ) :
+    original ( std::move ( matrix ) ),
+    factors ( Matrix< V > ( original.view ( ) ) ),
+    limit ( maxIterations )
+{
+    // the max norm of A is its largest absolute row sum.
+    for ( std::size_t i = 0; i < size ( ); i++ )
+    {
+        W sum = W { 0 };
+        for ( W const &element : original [ i ] )
+        {
+            using std::abs;
+            sum += abs ( element );
+        }
+        norm = std::max ( norm, sum );
+    }
+}
+
+template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
+std::size_t ml::RefinedLU< V, W >::size ( ) const noexcept
+{
+    return original.rowCount ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
+bool ml::RefinedLU< V, W >::isSingular ( ) const noexcept
+{
+    return factors.isSingular ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
+ml::Refinement< W >
+ml::RefinedLU< V, W >::solve ( std::vector< W > const &b ) const
+{
+    using std::sqrt;
+    // LU checks the length and the pivots, and substitutes in W with the
+    // factors converted on the fly.
+    Refinement< W > output;
+    output.solution = factors.template solve< W, W > ( b );
+
+    std::size_t const n = size ( );
+    std::vector< W > &x = output.solution;
+    std::vector< W >  r ( n ), last;
+    W const           scale = refine::largest ( b.data ( ), n );
+    W const           tolerance =
+            sqrt ( W ( n ) ) * std::numeric_limits< W >::epsilon ( );
+    W previous = std::numeric_limits< W >::infinity ( );
+    while ( true )
+    {
+        std::copy ( b.begin ( ), b.end ( ), r.begin ( ) );
+        gemv< W > ( -1, original, x.data ( ), 1, r.data ( ) );
+        W const denominator = norm * refine::largest ( x.data ( ), n ) + scale;
+        W const residual    = refine::largest ( r.data ( ), n );
+        W const error =
+                denominator == W { 0 } ? W { 0 } : residual / denominator;
+        if ( output.iterations > 0 && !( error < previous ) )
+        {
+            // the last correction made things worse, so undo it.
+            x = std::move ( last );
+            output.iterations--;
+            break;
+        }
+        output.backwardError = error;
+        if ( error <= tolerance )
+        {
+            output.converged = true;
+            break;
+        }
+        // not halving means A is too ill-conditioned for V.
+        if ( output.iterations == limit || !( error < previous / 2 ) )
+        {
+            break;
+        }
+        previous = error;
+        last     = x;
+        std::vector< W > const d = factors.template solve< W, W > ( r );
+        for ( std::size_t i = 0; i < n; i++ ) { x [ i ] += d [ i ]; }
+        output.iterations++;
+    }
+    return output;
+}
@@ -0,0 +1,424 @@
+/**
+ * @file simd.cc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Picks the kernels for the processor ML runs on.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#include "simd.hh"
+
+#include "gemm.hh"
+
+#if ML_SIMD_X86
+#    if defined( _MSC_VER )
+#        include <intrin.h>
+#    else
+#        include <cpuid.h>
+#    endif
+#endif
+
+namespace
+{
+    template < class X >
+    void genericGemv ( std::size_t m,
+                       std::size_t n,
+                       X           alpha,
+                       X const    *a,
+                       std::size_t lda,
+                       X const    *x,
+                       X           beta,
+                       X          *y )
+    {
+        for ( std::size_t i = 0; i < m; i++ )
+        {
+            X t = X { 0 };
+            for ( std::size_t j = 0; j < n; j++ ) { t += a [ i * lda + j ] * x [ j ]; }
+            y [ i ] = beta == X { 0 } ? alpha * t : alpha * t + beta * y [ i ];
+        }
+    }
+
+    template < class X > X genericDot ( std::size_t n, X const *x, X const *y )
+    {
+        X t = X { 0 };
+        for ( std::size_t i = 0; i < n; i++ ) { t += x [ i ] * y [ i ]; }
+        return t;
+    }
+
+    template < class X >
+    void genericAxpy ( std::size_t n, X alpha, X const *x, X *y )
+    {
+        for ( std::size_t i = 0; i < n; i++ ) { y [ i ] += alpha * x [ i ]; }
+    }
+
+    template < class X >
+    void genericAdd ( std::size_t n, X const *x, X const *y, X *z )
+    {
+        for ( std::size_t i = 0; i < n; i++ ) { z [ i ] = x [ i ] + y [ i ]; }
+    }
+
+    template < class X >
+    void genericSub ( std::size_t n, X const *x, X const *y, X *z )
+    {
+        for ( std::size_t i = 0; i < n; i++ ) { z [ i ] = x [ i ] - y [ i ]; }
+    }
+
+    template < class X >
+    void genericScale ( std::size_t n, X alpha, X const *x, X *z )
+    {
+        for ( std::size_t i = 0; i < n; i++ ) { z [ i ] = alpha * x [ i ]; }
+    }
+
+    template < class X >
+    void genericDivide ( std::size_t n, X alpha, X const *x, X *z )
+    {
+        for ( std::size_t i = 0; i < n; i++ ) { z [ i ] = x [ i ] / alpha; }
+    }
+
+    template < class X >
+    void genericMultiplyAdd ( std::size_t n, X alpha, X const *x, X const *y, X *z )
+    {
+        for ( std::size_t i = 0; i < n; i++ )
+        {
+            z [ i ] += alpha * x [ i ] * y [ i ];
+        }
+    }
+
+    template < class X >
+    void genericQuotient ( std::size_t n, X const *x, X const *y, X *z )
+    {
+        for ( std::size_t i = 0; i < n; i++ ) { z [ i ] = x [ i ] / y [ i ]; }
+    }
+
+    template < class X >
+    void genericPivot ( std::size_t n, X const *t, X const *c, X *x, X *y )
+    {
+        for ( std::size_t i = 0; i < n; i++ )
+        {
+            bool const swap = ( c [ i ] < 0 ? -c [ i ] : c [ i ] )
+                            > ( t [ i ] < 0 ? -t [ i ] : t [ i ] );
+            X const    lo   = swap ? y [ i ] : x [ i ];
+            X const    hi   = swap ? x [ i ] : y [ i ];
+            x [ i ]         = lo;
+            y [ i ]         = hi;
+        }
+    }
+
+    template < class S >
+    void genericWiden ( std::size_t n, S const *x, Single *y )
+    {
+        for ( std::size_t i = 0; i < n; i++ ) { y [ i ] = x [ i ]; }
+    }
+
+    void genericByteGemm ( std::size_t        m,
+                           std::size_t        n,
+                           std::size_t        k,
+                           std::int8_t const *a,
+                           std::size_t        lda,
+                           std::int8_t const *b,
+                           std::size_t        ldb,
+                           std::int32_t      *c,
+                           std::size_t        ldc )
+    {
+        for ( std::size_t i = 0; i < m; i++ )
+        {
+            for ( std::size_t j = 0; j < n; j++ )
+            {
+                std::int32_t t = 0;
+                for ( std::size_t p = 0; p < k; p++ )
+                {
+                    t += std::int32_t ( a [ i * lda + p ] ) * b [ j * ldb + p ];
+                }
+                c [ i * ldc + j ] = t;
+            }
+        }
+    }
+
+    template < class X > ml::simd::Kernels< X > genericTable ( )
+    {
+        ml::simd::Kernels< X > kernels;
+        kernels.gemm.mr     = 4;
+        kernels.gemm.nr     = 4;
+        kernels.gemm.run    = &ml::kernel::genericMicroKernel< X, 4, 4 >;
+        kernels.gemv        = &genericGemv< X >;
+        kernels.dot         = &genericDot< X >;
+        kernels.axpy        = &genericAxpy< X >;
+        kernels.add         = &genericAdd< X >;
+        kernels.sub         = &genericSub< X >;
+        kernels.scale       = &genericScale< X >;
+        kernels.divide      = &genericDivide< X >;
+        kernels.multiplyAdd = &genericMultiplyAdd< X >;
+        kernels.quotient    = &genericQuotient< X >;
+        kernels.pivot       = &genericPivot< X >;
+        return kernels;
+    }
+
+    struct Features
+    {
+        bool sse2   = false;
+        bool avx2   = false;
+        bool avx512 = false;
+        // for the bytes only.
+        bool avx512bw   = false;
+        bool avx512vnni = false;
+    };
+
+#if ML_SIMD_X86
+    void cpuid ( unsigned leaf, unsigned sub, unsigned regs [ 4 ] )
+    {
+#    if defined( _MSC_VER )
+        int out [ 4 ];
+        __cpuidex ( out, ( int ) leaf, ( int ) sub );
+        for ( int i = 0; i < 4; i++ ) { regs [ i ] = ( unsigned ) out [ i ]; }
+#    else
+        __cpuid_count ( leaf, sub, regs [ 0 ], regs [ 1 ], regs [ 2 ], regs [ 3 ] );
+#    endif
+    }
+
+    // which register states the operating system saves on a context switch.
+    unsigned long long enabledStates ( )
+    {
+#    if defined( _MSC_VER )
+        return _xgetbv ( 0 );
+#    else
+        unsigned lo = 0, hi = 0;
+        __asm__ __volatile__ ( "xgetbv" : "=a"( lo ), "=d"( hi ) : "c"( 0 ) );
+        return ( ( unsigned long long ) hi << 32 ) | lo;
+#    endif
+    }
+#endif // if ML_SIMD_X86
+
+    Features detect ( )
+    {
+        Features found;
+#if ML_SIMD_X86
+        unsigned regs [ 4 ] = { 0, 0, 0, 0 };
+        cpuid ( 0, 0, regs );
+        unsigned const highest = regs [ 0 ];
+        if ( highest < 1 )
+        {
+            return found;
+        }
+        cpuid ( 1, 0, regs );
+        unsigned const ecx1 = regs [ 2 ];
+        unsigned const edx1 = regs [ 3 ];
+        found.sse2          = ( edx1 >> 26 ) & 1;
+
+        bool const osxsave = ( ecx1 >> 27 ) & 1;
+        bool const avx     = ( ecx1 >> 28 ) & 1;
+        bool const fma     = ( ecx1 >> 12 ) & 1;
+        // every AVX2 processor converts Halfs too, but check anyway.
+        bool const f16c = ( ecx1 >> 29 ) & 1;
+        if ( !osxsave || !avx || highest < 7 )
+        {
+            return found;
+        }
+        unsigned long long const states = enabledStates ( );
+        // xmm and ymm state
+        bool const ymm = ( states & 0x6 ) == 0x6;
+        // opmask and both halves of the zmm state
+        bool const zmm = ( states & 0xe0 ) == 0xe0;
+
+        cpuid ( 7, 0, regs );
+        unsigned const ebx7 = regs [ 1 ];
+        found.avx2          = ymm && fma && f16c && ( ( ebx7 >> 5 ) & 1 );
+        unsigned const ecx7 = regs [ 2 ];
+        found.avx512        = found.avx2 && zmm && ( ( ebx7 >> 16 ) & 1 );
+        found.avx512bw      = found.avx512 && ( ( ebx7 >> 30 ) & 1 );
+        found.avx512vnni    = found.avx512bw && ( ( ecx7 >> 11 ) & 1 );
+#endif // if ML_SIMD_X86
+        return found;
+    }
+
+    Features const &features ( )
+    {
+        static Features const found = detect ( );
+        return found;
+    }
+
+    struct State
+    {
+        ml::simd::Isa               isa;
+        ml::simd::Kernels< Single >           singles;
+        ml::simd::Kernels< Double >           doubles;
+        ml::simd::Kernels< ml::DoubleDouble > doubleDoubles;
+        ml::simd::Widening                    widening;
+        ml::simd::Bytes                       bytes;
+    };
+
+    void use ( State &state, ml::simd::Isa isa )
+    {
+        using ml::simd::Isa;
+        state.isa     = isa;
+        state.singles = ml::simd::genericSingles ( );
+        state.doubles       = ml::simd::genericDoubles ( );
+        state.doubleDoubles = ml::simd::genericDoubleDoubles ( );
+        state.widening      = ml::simd::genericWidening ( );
+        state.bytes         = ml::simd::genericBytes ( );
+        switch ( isa )
+        {
+#if ML_SIMD_X86
+            case Isa::Sse2:
+                state.singles  = ml::simd::sse2Singles ( );
+                state.doubles  = ml::simd::sse2Doubles ( );
+                state.widening = ml::simd::sse2Widening ( );
+                state.bytes    = ml::simd::sse2Bytes ( );
+                break;
+            case Isa::Avx2:
+                state.singles       = ml::simd::avx2Singles ( );
+                state.doubles       = ml::simd::avx2Doubles ( );
+                state.doubleDoubles = ml::simd::avx2DoubleDoubles ( );
+                state.widening      = ml::simd::avx2Widening ( );
+                state.bytes         = ml::simd::avx2Bytes ( );
+                break;
+            case Isa::Avx512:
+                state.singles       = ml::simd::avx512Singles ( );
+                state.doubles       = ml::simd::avx512Doubles ( );
+                state.doubleDoubles = ml::simd::avx512DoubleDoubles ( );
+                state.widening      = ml::simd::avx512Widening ( );
+                state.bytes         = ml::simd::avx2Bytes ( );
+                if ( features ( ).avx512vnni )
+                {
+                    state.bytes = ml::simd::avx512VnniBytes ( );
+                }
+                else if ( features ( ).avx512bw )
+                {
+                    state.bytes = ml::simd::avx512Bytes ( );
+                }
+                break;
+#endif // if ML_SIMD_X86
+#if ML_SIMD_NEON
+            case Isa::Neon:
+                state.singles       = ml::simd::neonSingles ( );
+                state.doubles       = ml::simd::neonDoubles ( );
+                state.doubleDoubles = ml::simd::neonDoubleDoubles ( );
+                state.widening      = ml::simd::neonWidening ( );
+                state.bytes         = ml::simd::neonBytes ( );
+                break;
+#endif // if ML_SIMD_NEON
+            default: break;
+        }
+    }
+
+    State best ( )
+    {
+        using ml::simd::Isa;
+        State state;
+        Isa   preferred [] = { Isa::Avx512, Isa::Avx2, Isa::Sse2, Isa::Neon };
+        use ( state, Isa::Generic );
+        for ( Isa isa : preferred )
+        {
+            if ( ml::simd::supports ( isa ) )
+            {
+                use ( state, isa );
+                break;
+            }
+        }
+        return state;
+    }
+
+    State &state ( )
+    {
+        static State current = best ( );
+        return current;
+    }
+
+    // make the choice while the library loads rather than on first use.
+    struct ChooseOnLoad
+    {
+        ChooseOnLoad ( ) { state ( ); }
+    } const chooseOnLoad;
+} // namespace
+
+ml::simd::Isa ml::simd::isa ( ) NOEXCEPT { return state ( ).isa; }
+
+char const *ml::simd::name ( Isa isa ) NOEXCEPT
+{
+    switch ( isa )
+    {
+        case Isa::Sse2: return "SSE2";
+        case Isa::Avx2: return "AVX2";
+        case Isa::Avx512: return "AVX-512";
+        case Isa::Neon: return "NEON";
+        default: return "Generic";
+    }
+}
+
+bool ml::simd::supports ( Isa isa ) NOEXCEPT
+{
+    switch ( isa )
+    {
+        case Isa::Generic: return true;
+#if ML_SIMD_X86
+        case Isa::Sse2: return features ( ).sse2;
+        case Isa::Avx2: return features ( ).avx2;
+        case Isa::Avx512: return features ( ).avx512;
+#endif // if ML_SIMD_X86
+#if ML_SIMD_NEON
+        case Isa::Neon: return true;
+#endif // if ML_SIMD_NEON
+        default: return false;
+    }
+}
+
+bool ml::simd::select ( Isa isa ) NOEXCEPT
+{
+    if ( !supports ( isa ) )
+    {
+        return false;
+    }
+    use ( state ( ), isa );
+    return true;
+}
+
+ml::simd::Kernels< Single > const &ml::simd::singles ( ) NOEXCEPT
+{
+    return state ( ).singles;
+}
+
+ml::simd::Kernels< Double > const &ml::simd::doubles ( ) NOEXCEPT
+{
+    return state ( ).doubles;
+}
+
+ml::simd::Kernels< ml::DoubleDouble > const &
+ml::simd::doubleDoubles ( ) NOEXCEPT
+{
+    return state ( ).doubleDoubles;
+}
+
+ml::simd::Widening const &ml::simd::widening ( ) NOEXCEPT
+{
+    return state ( ).widening;
+}
+
+ml::simd::Bytes const &ml::simd::bytes ( ) NOEXCEPT { return state ( ).bytes; }
+
+ml::simd::Kernels< Single > ml::simd::genericSingles ( ) NOEXCEPT
+{
+    return genericTable< Single > ( );
+}
+
+ml::simd::Kernels< Double > ml::simd::genericDoubles ( ) NOEXCEPT
+{
+    return genericTable< Double > ( );
+}
+
+ml::simd::Kernels< ml::DoubleDouble >
+ml::simd::genericDoubleDoubles ( ) NOEXCEPT
+{
+    return genericTable< DoubleDouble > ( );
+}
+
+ml::simd::Widening ml::simd::genericWidening ( ) NOEXCEPT
+{
+    return Widening { &genericWiden< Half >, &genericWiden< BFloat16 > };
+}
+
+ml::simd::Bytes ml::simd::genericBytes ( ) NOEXCEPT
+{
+    return Bytes { &genericByteGemm };
+}
@@ -0,0 +1,228 @@
+/**
+ * @file simd.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Hand-tuned kernels for Single, Double and DoubleDouble, widening from
+ * Half and BFloat16, and products of 8 bit integers, picked at load time for
+ * the instruction set that the running processor supports.
+ * @note The library is built once for the baseline of its target. The kernels
+ * for newer instruction sets are compiled alongside the baseline and only run
+ * when CPUID (or the platform equivalent) says that the processor and the
+ * operating system both support them.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "doubledouble.hh"
+#include "half.hh"
+#include "meta.hh"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined( __x86_64__ ) || defined( _M_X64 ) || defined( __i386__ )          \
+        || defined( _M_IX86 )
+#    define ML_SIMD_X86 1
+#endif
+
+#if defined( __aarch64__ ) || defined( _M_ARM64 )
+#    define ML_SIMD_NEON 1
+#endif
+
+namespace ml
+{
+    namespace kernel
+    {
+        /**
+         * @brief A register-blocked kernel computing one mr x nr tile of C
+         * from a packed panel of A (kc columns of mr elements) and a packed
+         * panel of B (kc rows of nr elements). The tile is written as
+         * C = alpha * A * B + beta * C, and C is not read if beta is zero.
+         */
+        template < class X > struct MicroKernel
+        {
+            typedef void ( *Function ) ( std::size_t kc,
+                                         X const    *a,
+                                         X const    *b,
+                                         X          *c,
+                                         std::size_t rsc,
+                                         X           alpha,
+                                         X           beta );
+            std::size_t mr;
+            std::size_t nr;
+            Function    run;
+        };
+    } // namespace kernel
+
+    namespace simd
+    {
+        /**
+         * @brief The instruction sets that ML has kernels for, in the order
+         * that ML prefers them.
+         */
+        enum class Isa
+        {
+            Generic,
+            Sse2,
+            Avx2,
+            Avx512,
+            Neon,
+        };
+
+        /**
+         * @brief The kernels for one element type. Every pointer is always
+         * valid, the generic versions fill in for anything an instruction set
+         * does not accelerate.
+         */
+        template < class X > struct Kernels
+        {
+            kernel::MicroKernel< X > gemm;
+
+            // y = alpha * A * x + beta * y where A is m x n with rows lda
+            // elements apart. y is not read when beta is zero.
+            void ( *gemv ) ( std::size_t m,
+                             std::size_t n,
+                             X           alpha,
+                             X const    *a,
+                             std::size_t lda,
+                             X const    *x,
+                             X           beta,
+                             X          *y );
+            // returns the sum of x [ i ] * y [ i ]
+            X ( *dot ) ( std::size_t n, X const *x, X const *y );
+            // y = alpha * x + y
+            void ( *axpy ) ( std::size_t n, X alpha, X const *x, X *y );
+            // z = x + y
+            void ( *add ) ( std::size_t n, X const *x, X const *y, X *z );
+            // z = x - y
+            void ( *sub ) ( std::size_t n, X const *x, X const *y, X *z );
+            // z = alpha * x
+            void ( *scale ) ( std::size_t n, X alpha, X const *x, X *z );
+            // z = x / alpha
+            void ( *divide ) ( std::size_t n, X alpha, X const *x, X *z );
+            // z = alpha * x * y + z, element by element
+            void ( *multiplyAdd ) ( std::size_t n,
+                                    X           alpha,
+                                    X const    *x,
+                                    X const    *y,
+                                    X          *z );
+            // z = x / y, element by element
+            void ( *quotient ) ( std::size_t n, X const *x, X const *y, X *z );
+            // swaps x [ i ] and y [ i ] wherever |c [ i ]| > |t [ i ]|, which
+            // is one partial pivoting step across a batch of matrices. x and
+            // y may be t and c.
+            void ( *pivot ) ( std::size_t n, X const *t, X const *c, X *x, X *y );
+        };
+
+        /**
+         * @brief Conversions from the 16 bit storage types to Single, which
+         * feed them to the Single kernels a block at a time.
+         */
+        struct Widening
+        {
+            // y [ i ] = x [ i ]
+            void ( *halves ) ( std::size_t n, Half const *x, Single *y );
+            void ( *bfloat16s ) ( std::size_t n, BFloat16 const *x, Single *y );
+        };
+
+        /**
+         * @brief Products of 8 bit integers for quantized matrices, summed
+         * exactly in 32 bits. Every element must be in [-127, 127]: the x86
+         * instructions multiply unsigned by signed bytes, so the kernels
+         * take the sign of one operand over to the other, which -128 would
+         * overflow, and keep the sums of adjacent pairs in 16 bits.
+         */
+        struct Bytes
+        {
+            // c [ i * ldc + j ] = the sum over p < k of a [ i * lda + p ] *
+            // b [ j * ldb + p ]: the rows of A times the rows of B, which
+            // are the columns of the transpose. n = 1 is a gemv.
+            void ( *gemm ) ( std::size_t        m,
+                             std::size_t        n,
+                             std::size_t        k,
+                             std::int8_t const *a,
+                             std::size_t        lda,
+                             std::int8_t const *b,
+                             std::size_t        ldb,
+                             std::int32_t      *c,
+                             std::size_t        ldc );
+        };
+
+        /**
+         * @brief The instruction set in use.
+         */
+        Isa isa ( ) NOEXCEPT;
+
+        /**
+         * @brief The human readable name of an instruction set.
+         */
+        char const *name ( Isa ) NOEXCEPT;
+
+        /**
+         * @brief Whether this build has kernels for the instruction set and the
+         * processor (and operating system) can run them.
+         */
+        bool supports ( Isa ) NOEXCEPT;
+
+        /**
+         * @brief Switches to another instruction set. ML already picks the
+         * best one when it loads, so this mostly exists for testing.
+         * @note Not thread safe, call it while nothing else uses ML.
+         * @return false (and nothing changes) if the instruction set is not
+         * supported.
+         */
+        bool select ( Isa ) NOEXCEPT;
+
+        Kernels< Single > const       &singles ( ) NOEXCEPT;
+        Kernels< Double > const       &doubles ( ) NOEXCEPT;
+        Kernels< DoubleDouble > const &doubleDoubles ( ) NOEXCEPT;
+        Widening const                &widening ( ) NOEXCEPT;
+        Bytes const                   &bytes ( ) NOEXCEPT;
+
+        /**
+         * @brief The table for one instruction set. Only the ones that this
+         * build targets exist. These are compiled for their instruction set,
+         * so only call them after supports says that the processor can run
+         * it.
+         */
+        Kernels< Single >       genericSingles ( ) NOEXCEPT;
+        Kernels< Double >       genericDoubles ( ) NOEXCEPT;
+        Kernels< DoubleDouble > genericDoubleDoubles ( ) NOEXCEPT;
+        Widening                genericWidening ( ) NOEXCEPT;
+        Bytes                   genericBytes ( ) NOEXCEPT;
+#if ML_SIMD_X86
+        Kernels< Single > sse2Singles ( ) NOEXCEPT;
+        Kernels< Double > sse2Doubles ( ) NOEXCEPT;
+        // SSE2 has no conversion from Half, which stays generic.
+        Widening sse2Widening ( ) NOEXCEPT;
+        Bytes    sse2Bytes ( ) NOEXCEPT;
+        // SSE2 has no fused multiply-add, which the DoubleDouble kernels
+        // need, so it uses the generic ones.
+        Kernels< Single >       avx2Singles ( ) NOEXCEPT;
+        Kernels< Double >       avx2Doubles ( ) NOEXCEPT;
+        Kernels< DoubleDouble > avx2DoubleDoubles ( ) NOEXCEPT;
+        Widening                avx2Widening ( ) NOEXCEPT;
+        Bytes                   avx2Bytes ( ) NOEXCEPT;
+        Kernels< Single >       avx512Singles ( ) NOEXCEPT;
+        Kernels< Double >       avx512Doubles ( ) NOEXCEPT;
+        Kernels< DoubleDouble > avx512DoubleDoubles ( ) NOEXCEPT;
+        Widening                avx512Widening ( ) NOEXCEPT;
+        // the bytes need AVX512BW, and AVX512_VNNI for the second one, which
+        // not every AVX-512 processor has; without BW they use AVX2's.
+        Bytes avx512Bytes ( ) NOEXCEPT;
+        Bytes avx512VnniBytes ( ) NOEXCEPT;
+#endif // if ML_SIMD_X86
+#if ML_SIMD_NEON
+        Kernels< Single >       neonSingles ( ) NOEXCEPT;
+        Kernels< Double >       neonDoubles ( ) NOEXCEPT;
+        Kernels< DoubleDouble > neonDoubleDoubles ( ) NOEXCEPT;
+        Widening                neonWidening ( ) NOEXCEPT;
+        // with sdot when the build targets the dot product extension.
+        Bytes neonBytes ( ) NOEXCEPT;
+#endif // if ML_SIMD_NEON
+    } // namespace simd
+} // namespace ml
@@ -0,0 +1,222 @@
+/**
+ * @file simd_avx2.cc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Kernels for AVX2 with FMA3 and F16C (Haswell, Zen and later).
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#include "simd.hh"
+
+#if ML_SIMD_X86
+
+#    include <cstddef>
+#    include <cstdint>
+#    include <immintrin.h>
+
+#    if defined( __clang__ )
+#        pragma clang attribute push(                                          \
+                __attribute__( ( target( "avx2,fma,f16c" ) ) ),                \
+                apply_to = function )
+#    elif defined( __GNUC__ )
+#        pragma GCC push_options
+#        pragma GCC target( "avx2,fma,f16c" )
+// GCC contracts a * b - c into an FMA by default, which breaks the
+// error-free transformations of the DoubleDouble operators inlined here.
+#        pragma GCC optimize( "fp-contract=off" )
+#    endif
+
+namespace ml
+{
+    namespace simd
+    {
+        namespace avx2
+        {
+            struct Singles
+            {
+                typedef Single Scalar;
+                typedef __m256 Reg;
+                enum
+                {
+                    width = 8
+                };
+
+                static Reg zero ( ) { return _mm256_setzero_ps ( ); }
+                static Reg set1 ( Scalar x ) { return _mm256_set1_ps ( x ); }
+                static Reg load ( Scalar const *p ) { return _mm256_loadu_ps ( p ); }
+                static void store ( Scalar *p, Reg x ) { _mm256_storeu_ps ( p, x ); }
+                static Reg add ( Reg a, Reg b ) { return _mm256_add_ps ( a, b ); }
+                static Reg sub ( Reg a, Reg b ) { return _mm256_sub_ps ( a, b ); }
+                static Reg mul ( Reg a, Reg b ) { return _mm256_mul_ps ( a, b ); }
+                static Reg div ( Reg a, Reg b ) { return _mm256_div_ps ( a, b ); }
+                static Reg fma ( Reg a, Reg b, Reg c )
+                {
+                    return _mm256_fmadd_ps ( a, b, c );
+                }
+                // y where |c| > |t| and x elsewhere
+                static Reg larger ( Reg t, Reg c, Reg x, Reg y )
+                {
+                    Reg const sign = _mm256_set1_ps ( -0.0f );
+                    Reg const mask = _mm256_cmp_ps ( _mm256_andnot_ps ( sign, c ),
+                                                     _mm256_andnot_ps ( sign, t ),
+                                                     _CMP_GT_OQ );
+                    return _mm256_blendv_ps ( x, y, mask );
+                }
+                static Scalar sum ( Reg x )
+                {
+                    __m128 const half = _mm_add_ps ( _mm256_castps256_ps128 ( x ),
+                                                     _mm256_extractf128_ps ( x, 1 ) );
+                    __m128 const pair = _mm_add_ps ( half, _mm_movehl_ps ( half, half ) );
+                    return _mm_cvtss_f32 (
+                            _mm_add_ss ( pair, _mm_shuffle_ps ( pair, pair, 1 ) ) );
+                }
+            };
+
+            struct Doubles
+            {
+                typedef Double  Scalar;
+                typedef __m256d Reg;
+                enum
+                {
+                    width = 4
+                };
+
+                static Reg zero ( ) { return _mm256_setzero_pd ( ); }
+                static Reg set1 ( Scalar x ) { return _mm256_set1_pd ( x ); }
+                static Reg load ( Scalar const *p ) { return _mm256_loadu_pd ( p ); }
+                static void store ( Scalar *p, Reg x ) { _mm256_storeu_pd ( p, x ); }
+                static Reg add ( Reg a, Reg b ) { return _mm256_add_pd ( a, b ); }
+                static Reg sub ( Reg a, Reg b ) { return _mm256_sub_pd ( a, b ); }
+                static Reg mul ( Reg a, Reg b ) { return _mm256_mul_pd ( a, b ); }
+                static Reg div ( Reg a, Reg b ) { return _mm256_div_pd ( a, b ); }
+                static Reg fma ( Reg a, Reg b, Reg c )
+                {
+                    return _mm256_fmadd_pd ( a, b, c );
+                }
+                static Reg larger ( Reg t, Reg c, Reg x, Reg y )
+                {
+                    Reg const sign = _mm256_set1_pd ( -0.0 );
+                    Reg const mask = _mm256_cmp_pd ( _mm256_andnot_pd ( sign, c ),
+                                                     _mm256_andnot_pd ( sign, t ),
+                                                     _CMP_GT_OQ );
+                    return _mm256_blendv_pd ( x, y, mask );
+                }
+                static Scalar sum ( Reg x )
+                {
+                    __m128d const half = _mm_add_pd ( _mm256_castpd256_pd128 ( x ),
+                                                      _mm256_extractf128_pd ( x, 1 ) );
+                    return _mm_cvtsd_f64 (
+                            _mm_add_sd ( half, _mm_unpackhi_pd ( half, half ) ) );
+                }
+            };
+
+#    include "simd_kernels.tcc"
+
+            void widenHalves ( std::size_t n, Half const *x, Single *y )
+            {
+                std::size_t i = 0;
+                for ( ; i + 8 <= n; i += 8 )
+                {
+                    __m128i const h = _mm_loadu_si128 (
+                            reinterpret_cast< __m128i const * > ( x + i ) );
+                    _mm256_storeu_ps ( y + i, _mm256_cvtph_ps ( h ) );
+                }
+                for ( ; i < n; i++ ) { y [ i ] = x [ i ]; }
+            }
+
+            // a BFloat16 is the top half of its Single.
+            void widenBFloat16s ( std::size_t n, BFloat16 const *x, Single *y )
+            {
+                std::size_t i = 0;
+                for ( ; i + 8 <= n; i += 8 )
+                {
+                    __m256i const w = _mm256_cvtepu16_epi32 ( _mm_loadu_si128 (
+                            reinterpret_cast< __m128i const * > ( x + i ) ) );
+                    _mm256_storeu_ps ( y + i, _mm256_castsi256_ps (
+                                                      _mm256_slli_epi32 ( w, 16 ) ) );
+                }
+                for ( ; i < n; i++ ) { y [ i ] = x [ i ]; }
+            }
+
+            struct Int8s
+            {
+                typedef __m256i Reg;
+                typedef __m256i Vector;
+                enum
+                {
+                    width  = 32,
+                    offset = 0
+                };
+
+                static Vector lift ( Vector a ) { return a; }
+                static Reg    zero ( ) { return _mm256_setzero_si256 ( ); }
+                static Vector load ( std::int8_t const *p )
+                {
+                    return _mm256_loadu_si256 ( reinterpret_cast< __m256i const * > ( p ) );
+                }
+                // |a| times b with the sign of a, as unsigned by signed bytes,
+                // then the pairs of 16 bit products summed into 32 bits.
+                static Reg dot ( Reg s, Vector a, Vector b )
+                {
+                    Reg const pairs = _mm256_maddubs_epi16 ( _mm256_sign_epi8 ( a, a ),
+                                                             _mm256_sign_epi8 ( b, a ) );
+                    return _mm256_add_epi32 (
+                            s, _mm256_madd_epi16 ( pairs, _mm256_set1_epi16 ( 1 ) ) );
+                }
+                static std::int32_t sum ( Reg x )
+                {
+                    __m128i const half = _mm_add_epi32 ( _mm256_castsi256_si128 ( x ),
+                                                         _mm256_extracti128_si256 ( x, 1 ) );
+                    __m128i const pair =
+                            _mm_add_epi32 ( half, _mm_shuffle_epi32 ( half, 0x4e ) );
+                    return _mm_cvtsi128_si32 (
+                            _mm_add_epi32 ( pair, _mm_shuffle_epi32 ( pair, 0xb1 ) ) );
+                }
+            };
+
+#    include "simd_bytes.tcc"
+        } // namespace avx2
+    }     // namespace simd
+} // namespace ml
+
+// 16 ymm registers: 12 accumulators, two for the row of B and one for the
+// broadcast of A.
+ml::simd::Kernels< Single > ml::simd::avx2Singles ( ) NOEXCEPT
+{
+    return avx2::table< avx2::Singles, 6, 2 > ( );
+}
+
+ml::simd::Kernels< Double > ml::simd::avx2Doubles ( ) NOEXCEPT
+{
+    return avx2::table< avx2::Doubles, 6, 2 > ( );
+}
+
+// 8 accumulators for the high and low parts of a 4 x 4 tile, two for the
+// row of B, two for the broadcast of A, and the rest for the error-free
+// transformations.
+ml::simd::Kernels< ml::DoubleDouble >
+ml::simd::avx2DoubleDoubles ( ) NOEXCEPT
+{
+    return avx2::ddTable< avx2::Doubles, 4, 1 > ( genericDoubleDoubles ( ) );
+}
+
+ml::simd::Widening ml::simd::avx2Widening ( ) NOEXCEPT
+{
+    return Widening { &avx2::widenHalves, &avx2::widenBFloat16s };
+}
+
+ml::simd::Bytes ml::simd::avx2Bytes ( ) NOEXCEPT
+{
+    return avx2::byteTable< avx2::Int8s > ( );
+}
+
+#    if defined( __clang__ )
+#        pragma clang attribute pop
+#    elif defined( __GNUC__ )
+#        pragma GCC pop_options
+#    endif
+
+#endif // if ML_SIMD_X86
@@ -0,0 +1,300 @@
+/**
+ * @file simd_avx512.cc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Kernels for AVX-512F (Skylake-SP, Zen 4 and later), and for bytes
+ * with AVX512BW and AVX512_VNNI (Cascade Lake, Zen 4 and later).
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#include "simd.hh"
+
+#if ML_SIMD_X86
+
+#    include <cstddef>
+#    include <cstdint>
+#    include <immintrin.h>
+
+#    if defined( __clang__ )
+#        pragma clang attribute push(                                          \
+                __attribute__( ( target( "avx512f,avx2,fma" ) ) ),             \
+                apply_to = function )
+#    elif defined( __GNUC__ )
+#        pragma GCC push_options
+#        pragma GCC target( "avx512f,avx2,fma" )
+// GCC contracts a * b - c into an FMA by default, which breaks the
+// error-free transformations of the DoubleDouble operators inlined here.
+#        pragma GCC optimize( "fp-contract=off" )
+// the horizontal reductions in GCC's headers start from _mm256_undefined_pd,
+// which -Wuninitialized flags on every use.
+#        pragma GCC diagnostic push
+#        pragma GCC diagnostic ignored "-Wuninitialized"
+#        pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#    endif
+
+namespace ml
+{
+    namespace simd
+    {
+        namespace avx512
+        {
+            struct Singles
+            {
+                typedef Single Scalar;
+                typedef __m512 Reg;
+                enum
+                {
+                    width = 16
+                };
+
+                static Reg zero ( ) { return _mm512_setzero_ps ( ); }
+                static Reg set1 ( Scalar x ) { return _mm512_set1_ps ( x ); }
+                static Reg load ( Scalar const *p ) { return _mm512_loadu_ps ( p ); }
+                static void store ( Scalar *p, Reg x ) { _mm512_storeu_ps ( p, x ); }
+                static Reg add ( Reg a, Reg b ) { return _mm512_add_ps ( a, b ); }
+                static Reg sub ( Reg a, Reg b ) { return _mm512_sub_ps ( a, b ); }
+                static Reg mul ( Reg a, Reg b ) { return _mm512_mul_ps ( a, b ); }
+                static Reg div ( Reg a, Reg b ) { return _mm512_div_ps ( a, b ); }
+                static Reg fma ( Reg a, Reg b, Reg c )
+                {
+                    return _mm512_fmadd_ps ( a, b, c );
+                }
+                // y where |c| > |t| and x elsewhere
+                static Reg larger ( Reg t, Reg c, Reg x, Reg y )
+                {
+                    __mmask16 const mask = _mm512_cmp_ps_mask (
+                            _mm512_abs_ps ( c ), _mm512_abs_ps ( t ), _CMP_GT_OQ );
+                    return _mm512_mask_blend_ps ( mask, x, y );
+                }
+                static Scalar sum ( Reg x ) { return _mm512_reduce_add_ps ( x ); }
+            };
+
+            struct Doubles
+            {
+                typedef Double  Scalar;
+                typedef __m512d Reg;
+                enum
+                {
+                    width = 8
+                };
+
+                static Reg zero ( ) { return _mm512_setzero_pd ( ); }
+                static Reg set1 ( Scalar x ) { return _mm512_set1_pd ( x ); }
+                static Reg load ( Scalar const *p ) { return _mm512_loadu_pd ( p ); }
+                static void store ( Scalar *p, Reg x ) { _mm512_storeu_pd ( p, x ); }
+                static Reg add ( Reg a, Reg b ) { return _mm512_add_pd ( a, b ); }
+                static Reg sub ( Reg a, Reg b ) { return _mm512_sub_pd ( a, b ); }
+                static Reg mul ( Reg a, Reg b ) { return _mm512_mul_pd ( a, b ); }
+                static Reg div ( Reg a, Reg b ) { return _mm512_div_pd ( a, b ); }
+                static Reg fma ( Reg a, Reg b, Reg c )
+                {
+                    return _mm512_fmadd_pd ( a, b, c );
+                }
+                static Reg larger ( Reg t, Reg c, Reg x, Reg y )
+                {
+                    __mmask8 const mask = _mm512_cmp_pd_mask (
+                            _mm512_abs_pd ( c ), _mm512_abs_pd ( t ), _CMP_GT_OQ );
+                    return _mm512_mask_blend_pd ( mask, x, y );
+                }
+                static Scalar sum ( Reg x ) { return _mm512_reduce_add_pd ( x ); }
+            };
+
+#    include "simd_kernels.tcc"
+
+            void widenHalves ( std::size_t n, Half const *x, Single *y )
+            {
+                std::size_t i = 0;
+                for ( ; i + 16 <= n; i += 16 )
+                {
+                    __m256i const h = _mm256_loadu_si256 (
+                            reinterpret_cast< __m256i const * > ( x + i ) );
+                    _mm512_storeu_ps ( y + i, _mm512_cvtph_ps ( h ) );
+                }
+                for ( ; i < n; i++ ) { y [ i ] = x [ i ]; }
+            }
+
+            void widenBFloat16s ( std::size_t n, BFloat16 const *x, Single *y )
+            {
+                std::size_t i = 0;
+                for ( ; i + 16 <= n; i += 16 )
+                {
+                    __m512i const w = _mm512_cvtepu16_epi32 ( _mm256_loadu_si256 (
+                            reinterpret_cast< __m256i const * > ( x + i ) ) );
+                    _mm512_storeu_ps ( y + i, _mm512_castsi512_ps (
+                                                      _mm512_slli_epi32 ( w, 16 ) ) );
+                }
+                for ( ; i < n; i++ ) { y [ i ] = x [ i ]; }
+            }
+        } // namespace avx512
+    }     // namespace simd
+} // namespace ml
+
+// 32 zmm registers: 24 accumulators, two for the row of B and one for the
+// broadcast of A.
+ml::simd::Kernels< Single > ml::simd::avx512Singles ( ) NOEXCEPT
+{
+    return avx512::table< avx512::Singles, 12, 2 > ( );
+}
+
+ml::simd::Kernels< Double > ml::simd::avx512Doubles ( ) NOEXCEPT
+{
+    return avx512::table< avx512::Doubles, 12, 2 > ( );
+}
+
+// 16 accumulators for the high and low parts of a 4 x 16 tile, out of 32
+// zmm registers.
+ml::simd::Kernels< ml::DoubleDouble >
+ml::simd::avx512DoubleDoubles ( ) NOEXCEPT
+{
+    return avx512::ddTable< avx512::Doubles, 4, 2 > (
+            genericDoubleDoubles ( ) );
+}
+
+ml::simd::Widening ml::simd::avx512Widening ( ) NOEXCEPT
+{
+    return Widening { &avx512::widenHalves, &avx512::widenBFloat16s };
+}
+
+#    if defined( __clang__ )
+#        pragma clang attribute pop
+#    elif defined( __GNUC__ )
+#        pragma GCC diagnostic pop
+#        pragma GCC pop_options
+#    endif
+
+// the bytes are compiled apart from the rest, for their own extensions, so
+// that nothing else picks up instructions that some AVX-512 processors lack.
+
+#    if defined( __clang__ )
+#        pragma clang attribute push(                                          \
+                __attribute__( ( target( "avx512f,avx512bw,avx2,fma" ) ) ),    \
+                apply_to = function )
+#    elif defined( __GNUC__ )
+#        pragma GCC push_options
+#        pragma GCC target( "avx512f,avx512bw,avx2,fma" )
+#        pragma GCC diagnostic push
+#        pragma GCC diagnostic ignored "-Wuninitialized"
+#        pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#    endif
+
+namespace ml
+{
+    namespace simd
+    {
+        namespace avx512bw
+        {
+            struct Int8s
+            {
+                typedef __m512i Reg;
+                typedef __m512i Vector;
+                enum
+                {
+                    width  = 64,
+                    offset = 0
+                };
+
+                static Reg    zero ( ) { return _mm512_setzero_si512 ( ); }
+                static Vector load ( std::int8_t const *p )
+                {
+                    return _mm512_loadu_si512 ( p );
+                }
+                static Vector lift ( Vector a ) { return a; }
+                // |a| times b with the sign of a, as unsigned by signed bytes,
+                // then the pairs of 16 bit products summed into 32 bits.
+                static Reg dot ( Reg s, Vector a, Vector b )
+                {
+                    Vector const signs = _mm512_mask_sub_epi8 (
+                            b, _mm512_movepi8_mask ( a ), _mm512_setzero_si512 ( ), b );
+                    Reg const pairs =
+                            _mm512_maddubs_epi16 ( _mm512_abs_epi8 ( a ), signs );
+                    return _mm512_add_epi32 (
+                            s, _mm512_madd_epi16 ( pairs, _mm512_set1_epi16 ( 1 ) ) );
+                }
+                static std::int32_t sum ( Reg x ) { return _mm512_reduce_add_epi32 ( x ); }
+            };
+
+#    include "simd_bytes.tcc"
+        } // namespace avx512bw
+    }     // namespace simd
+} // namespace ml
+
+#    if defined( __clang__ )
+#        pragma clang attribute pop
+#    elif defined( __GNUC__ )
+#        pragma GCC diagnostic pop
+#        pragma GCC pop_options
+#    endif
+
+#    if defined( __clang__ )
+#        pragma clang attribute push(                                          \
+                __attribute__( ( target( "avx512f,avx512bw,avx512vnni,avx2,fma" ) ) ),\
+                apply_to = function )
+#    elif defined( __GNUC__ )
+#        pragma GCC push_options
+#        pragma GCC target( "avx512f,avx512bw,avx512vnni,avx2,fma" )
+#        pragma GCC diagnostic push
+#        pragma GCC diagnostic ignored "-Wuninitialized"
+#        pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#    endif
+
+namespace ml
+{
+    namespace simd
+    {
+        namespace avx512vnni
+        {
+            struct Int8s
+            {
+                typedef __m512i Reg;
+                typedef __m512i Vector;
+                enum
+                {
+                    width  = 64,
+                    offset = 128
+                };
+
+                static Reg    zero ( ) { return _mm512_setzero_si512 ( ); }
+                static Vector load ( std::int8_t const *p )
+                {
+                    return _mm512_loadu_si512 ( p );
+                }
+                // a + 128 as unsigned bytes: flipping the top bit.
+                static Vector lift ( Vector a )
+                {
+                    return _mm512_xor_si512 ( a, _mm512_set1_epi8 ( -128 ) );
+                }
+                // four products of unsigned by signed bytes summed straight
+                // into each 32 bit sum by one instruction.
+                static Reg dot ( Reg s, Vector a, Vector b )
+                {
+                    return _mm512_dpbusd_epi32 ( s, a, b );
+                }
+                static std::int32_t sum ( Reg x ) { return _mm512_reduce_add_epi32 ( x ); }
+            };
+
+#    include "simd_bytes.tcc"
+        } // namespace avx512vnni
+    }     // namespace simd
+} // namespace ml
+
+#    if defined( __clang__ )
+#        pragma clang attribute pop
+#    elif defined( __GNUC__ )
+#        pragma GCC diagnostic pop
+#        pragma GCC pop_options
+#    endif
+
+ml::simd::Bytes ml::simd::avx512Bytes ( ) NOEXCEPT
+{
+    return avx512bw::byteTable< avx512bw::Int8s > ( );
+}
+
+ml::simd::Bytes ml::simd::avx512VnniBytes ( ) NOEXCEPT
+{
+    return avx512vnni::byteTable< avx512vnni::Int8s > ( );
+}
+
+#endif // if ML_SIMD_X86
@@ -0,0 +1,146 @@
+/**
+ * @file simd_bytes.tcc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief This C++ file is meant to be included only in the simd_*.cc files,
+ * once per instruction set, inside of a namespace for that instruction set,
+ * like simd_kernels.tcc.
+ * @details The products of 8 bit integers are written once against a policy
+ * class B with:
+ *
+ * - B::Vector, a register of B::width bytes, and B::Reg, a register of 32
+ *   bit sums (the same type on x86).
+ * - zero, load (unaligned, of bytes) and sum (the horizontal add of the 32
+ *   bit sums).
+ * - lift ( a ), which is a row of A as dot takes it, and B::offset, what
+ *   lift adds to each byte: instructions that multiply unsigned by signed
+ *   bytes take a + 128, and offset * the sum of the column is taken back
+ *   out of every sum at the end. Otherwise a and 0.
+ * - dot ( s, lift ( a ), b ), which adds the products of the bytes to the
+ *   32 bit sums in s, four to each.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+
+#ifndef ML_UNROLL
+#    if defined( __clang__ )
+#        define ML_UNROLL _Pragma ( "unroll" )
+#    elif defined( __GNUC__ )
+#        define ML_UNROLL _Pragma ( "GCC unroll 16" )
+#    else
+#        define ML_UNROLL
+#    endif
+#endif
+
+// the R x C tile of dot products of R rows of A and C rows of B, where
+// lifted [ j ] is B::offset * the sum of the bytes of row j of B that the
+// vectors cover.
+template < class B, std::size_t R, std::size_t C >
+void byteTile ( std::size_t         k,
+                std::int8_t const  *a,
+                std::size_t         lda,
+                std::int8_t const  *b,
+                std::size_t         ldb,
+                std::int32_t const *lifted,
+                std::int32_t       *c,
+                std::size_t         ldc )
+{
+    typename B::Reg sums [ R ][ C ];
+    ML_UNROLL
+    for ( std::size_t r = 0; r < R; r++ )
+    {
+        ML_UNROLL
+        for ( std::size_t j = 0; j < C; j++ ) { sums [ r ][ j ] = B::zero ( ); }
+    }
+    std::size_t p = 0;
+    for ( ; p + B::width <= k; p += B::width )
+    {
+        typename B::Vector columns [ C ];
+        ML_UNROLL
+        for ( std::size_t j = 0; j < C; j++ )
+        {
+            columns [ j ] = B::load ( b + j * ldb + p );
+        }
+        ML_UNROLL
+        for ( std::size_t r = 0; r < R; r++ )
+        {
+            typename B::Vector const row = B::lift ( B::load ( a + r * lda + p ) );
+            ML_UNROLL
+            for ( std::size_t j = 0; j < C; j++ )
+            {
+                sums [ r ][ j ] = B::dot ( sums [ r ][ j ], row, columns [ j ] );
+            }
+        }
+    }
+    ML_UNROLL
+    for ( std::size_t r = 0; r < R; r++ )
+    {
+        ML_UNROLL
+        for ( std::size_t j = 0; j < C; j++ )
+        {
+            std::int32_t t = B::sum ( sums [ r ][ j ] ) - lifted [ j ];
+            for ( std::size_t q = p; q < k; q++ )
+            {
+                t += std::int32_t ( a [ r * lda + q ] ) * b [ j * ldb + q ];
+            }
+            c [ r * ldc + j ] = t;
+        }
+    }
+}
+
+// 4 x 2 tiles: each row of A loaded is used twice and each row of B four
+// times, in 8 of the 16 registers of the smallest register files. The
+// columns are the outer loop, so that their sums for lift are found once.
+template < class B >
+void byteGemm ( std::size_t        m,
+                std::size_t        n,
+                std::size_t        k,
+                std::int8_t const *a,
+                std::size_t        lda,
+                std::int8_t const *b,
+                std::size_t        ldb,
+                std::int32_t      *c,
+                std::size_t        ldc )
+{
+    std::size_t const covered = k - k % B::width;
+    std::size_t       j       = 0;
+    while ( j < n )
+    {
+        std::size_t const width = n - j >= 2 ? 2 : 1;
+        std::int32_t      lifted [ 2 ] = { 0, 0 };
+        for ( std::size_t s = 0; s < width && B::offset != 0; s++ )
+        {
+            std::int32_t t = 0;
+            for ( std::size_t p = 0; p < covered; p++ ) { t += b [ ( j + s ) * ldb + p ]; }
+            lifted [ s ] = B::offset * t;
+        }
+        std::size_t i = 0;
+        for ( ; i + 4 <= m; i += 4 )
+        {
+            if ( width == 2 )
+            {
+                byteTile< B, 4, 2 > ( k, a + i * lda, lda, b + j * ldb, ldb,
+                                      lifted, c + i * ldc + j, ldc );
+            }
+            else
+            {
+                byteTile< B, 4, 1 > ( k, a + i * lda, lda, b + j * ldb, ldb,
+                                      lifted, c + i * ldc + j, ldc );
+            }
+        }
+        for ( ; i < m; i++ )
+        {
+            for ( std::size_t s = 0; s < width; s++ )
+            {
+                byteTile< B, 1, 1 > ( k, a + i * lda, lda, b + ( j + s ) * ldb,
+                                      ldb, lifted + s, c + i * ldc + j + s, ldc );
+            }
+        }
+        j += width;
+    }
+}
+
+template < class B > Bytes byteTable ( ) { return Bytes { &byteGemm< B > }; }
@@ -0,0 +1,575 @@
+/**
+ * @file simd_kernels.tcc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief This C++ file is meant to be included only in the simd_*.cc files,
+ * once per instruction set, inside of a namespace for that instruction set.
+ * @details Each kernel here is written once against a small policy class P
+ * which wraps the intrinsics of one instruction set for one element type:
+ *
+ * - P::Scalar, the element type and P::Reg, the vector register type.
+ * - P::width, the number of elements in a register.
+ * - zero, set1, load, store (unaligned), add, sub, mul, div and sum
+ *   (horizontal add).
+ * - fma ( a, b, c ) which computes a * b + c.
+ * - larger ( t, c, x, y ) which picks y where |c| > |t| and x elsewhere.
+ *
+ * The including file sets the code generation target before including this
+ * file so that every function here gets compiled for that instruction set.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+
+#ifndef ML_UNROLL
+#    if defined( __clang__ )
+#        define ML_UNROLL _Pragma ( "unroll" )
+#    elif defined( __GNUC__ )
+#        define ML_UNROLL _Pragma ( "GCC unroll 16" )
+#    else
+#        define ML_UNROLL
+#    endif
+#endif
+
+template < class P, std::size_t MR, std::size_t NV >
+void gemmTile ( std::size_t                 kc,
+                typename P::Scalar const   *a,
+                typename P::Scalar const   *b,
+                typename P::Scalar         *c,
+                std::size_t                 rsc,
+                typename P::Scalar          alpha,
+                typename P::Scalar          beta )
+{
+    typedef typename P::Reg Reg;
+    std::size_t const       W = P::width;
+
+    Reg acc [ MR ][ NV ];
+    ML_UNROLL
+    for ( std::size_t i = 0; i < MR; i++ )
+    {
+        ML_UNROLL
+        for ( std::size_t v = 0; v < NV; v++ ) { acc [ i ][ v ] = P::zero ( ); }
+    }
+
+    for ( std::size_t p = 0; p < kc; p++ )
+    {
+        Reg row [ NV ];
+        ML_UNROLL
+        for ( std::size_t v = 0; v < NV; v++ ) { row [ v ] = P::load ( b + v * W ); }
+        ML_UNROLL
+        for ( std::size_t i = 0; i < MR; i++ )
+        {
+            Reg const ai = P::set1 ( a [ i ] );
+            ML_UNROLL
+            for ( std::size_t v = 0; v < NV; v++ )
+            {
+                acc [ i ][ v ] = P::fma ( ai, row [ v ], acc [ i ][ v ] );
+            }
+        }
+        a += MR;
+        b += NV * W;
+    }
+
+    Reg const scale = P::set1 ( alpha );
+    if ( beta == typename P::Scalar ( 0 ) )
+    {
+        ML_UNROLL
+        for ( std::size_t i = 0; i < MR; i++ )
+        {
+            ML_UNROLL
+            for ( std::size_t v = 0; v < NV; v++ )
+            {
+                P::store ( c + i * rsc + v * W, P::mul ( scale, acc [ i ][ v ] ) );
+            }
+        }
+    } else
+    {
+        Reg const keep = P::set1 ( beta );
+        ML_UNROLL
+        for ( std::size_t i = 0; i < MR; i++ )
+        {
+            ML_UNROLL
+            for ( std::size_t v = 0; v < NV; v++ )
+            {
+                typename P::Scalar *out = c + i * rsc + v * W;
+                P::store ( out,
+                           P::fma ( keep,
+                                    P::load ( out ),
+                                    P::mul ( scale, acc [ i ][ v ] ) ) );
+            }
+        }
+    }
+}
+
+template < class P >
+typename P::Scalar dot ( std::size_t               n,
+                         typename P::Scalar const *x,
+                         typename P::Scalar const *y )
+{
+    typedef typename P::Reg Reg;
+    std::size_t const       W = P::width;
+
+    Reg         s0 = P::zero ( ), s1 = P::zero ( );
+    Reg         s2 = P::zero ( ), s3 = P::zero ( );
+    std::size_t i  = 0;
+    for ( ; i + 4 * W <= n; i += 4 * W )
+    {
+        s0 = P::fma ( P::load ( x + i ), P::load ( y + i ), s0 );
+        s1 = P::fma ( P::load ( x + i + W ), P::load ( y + i + W ), s1 );
+        s2 = P::fma ( P::load ( x + i + 2 * W ), P::load ( y + i + 2 * W ), s2 );
+        s3 = P::fma ( P::load ( x + i + 3 * W ), P::load ( y + i + 3 * W ), s3 );
+    }
+    for ( ; i + W <= n; i += W )
+    {
+        s0 = P::fma ( P::load ( x + i ), P::load ( y + i ), s0 );
+    }
+    typename P::Scalar total = P::sum ( P::add ( P::add ( s0, s1 ), P::add ( s2, s3 ) ) );
+    for ( ; i < n; i++ ) { total += x [ i ] * y [ i ]; }
+    return total;
+}
+
+template < class P >
+void gemv ( std::size_t               m,
+            std::size_t               n,
+            typename P::Scalar        alpha,
+            typename P::Scalar const *a,
+            std::size_t               lda,
+            typename P::Scalar const *x,
+            typename P::Scalar        beta,
+            typename P::Scalar       *y )
+{
+    typedef typename P::Scalar X;
+    typedef typename P::Reg    Reg;
+    std::size_t const          W = P::width;
+
+    std::size_t i = 0;
+    // four rows at a time share every load of x.
+    for ( ; i + 4 <= m; i += 4 )
+    {
+        X const *a0 = a + i * lda;
+        X const *a1 = a0 + lda;
+        X const *a2 = a1 + lda;
+        X const *a3 = a2 + lda;
+        Reg      s0 = P::zero ( ), s1 = P::zero ( );
+        Reg      s2 = P::zero ( ), s3 = P::zero ( );
+
+        std::size_t j = 0;
+        for ( ; j + W <= n; j += W )
+        {
+            Reg const xj = P::load ( x + j );
+            s0           = P::fma ( P::load ( a0 + j ), xj, s0 );
+            s1           = P::fma ( P::load ( a1 + j ), xj, s1 );
+            s2           = P::fma ( P::load ( a2 + j ), xj, s2 );
+            s3           = P::fma ( P::load ( a3 + j ), xj, s3 );
+        }
+        X t [ 4 ] = { P::sum ( s0 ), P::sum ( s1 ), P::sum ( s2 ), P::sum ( s3 ) };
+        for ( ; j < n; j++ )
+        {
+            t [ 0 ] += a0 [ j ] * x [ j ];
+            t [ 1 ] += a1 [ j ] * x [ j ];
+            t [ 2 ] += a2 [ j ] * x [ j ];
+            t [ 3 ] += a3 [ j ] * x [ j ];
+        }
+        for ( std::size_t r = 0; r < 4; r++ )
+        {
+            y [ i + r ] = beta == X ( 0 ) ? alpha * t [ r ]
+                                          : alpha * t [ r ] + beta * y [ i + r ];
+        }
+    }
+    for ( ; i < m; i++ )
+    {
+        X const t = dot< P > ( n, a + i * lda, x );
+        y [ i ]   = beta == X ( 0 ) ? alpha * t : alpha * t + beta * y [ i ];
+    }
+}
+
+template < class P >
+void axpy ( std::size_t               n,
+            typename P::Scalar        alpha,
+            typename P::Scalar const *x,
+            typename P::Scalar       *y )
+{
+    std::size_t const W     = P::width;
+    typename P::Reg   scale = P::set1 ( alpha );
+    std::size_t       i     = 0;
+    for ( ; i + W <= n; i += W )
+    {
+        P::store ( y + i, P::fma ( scale, P::load ( x + i ), P::load ( y + i ) ) );
+    }
+    for ( ; i < n; i++ ) { y [ i ] += alpha * x [ i ]; }
+}
+
+template < class P >
+void add ( std::size_t               n,
+           typename P::Scalar const *x,
+           typename P::Scalar const *y,
+           typename P::Scalar       *z )
+{
+    std::size_t const W = P::width;
+    std::size_t       i = 0;
+    for ( ; i + W <= n; i += W )
+    {
+        P::store ( z + i, P::add ( P::load ( x + i ), P::load ( y + i ) ) );
+    }
+    for ( ; i < n; i++ ) { z [ i ] = x [ i ] + y [ i ]; }
+}
+
+template < class P >
+void sub ( std::size_t               n,
+           typename P::Scalar const *x,
+           typename P::Scalar const *y,
+           typename P::Scalar       *z )
+{
+    std::size_t const W = P::width;
+    std::size_t       i = 0;
+    for ( ; i + W <= n; i += W )
+    {
+        P::store ( z + i, P::sub ( P::load ( x + i ), P::load ( y + i ) ) );
+    }
+    for ( ; i < n; i++ ) { z [ i ] = x [ i ] - y [ i ]; }
+}
+
+template < class P >
+void scale ( std::size_t               n,
+             typename P::Scalar        alpha,
+             typename P::Scalar const *x,
+             typename P::Scalar       *z )
+{
+    std::size_t const W      = P::width;
+    typename P::Reg   factor = P::set1 ( alpha );
+    std::size_t       i      = 0;
+    for ( ; i + W <= n; i += W )
+    {
+        P::store ( z + i, P::mul ( factor, P::load ( x + i ) ) );
+    }
+    for ( ; i < n; i++ ) { z [ i ] = alpha * x [ i ]; }
+}
+
+template < class P >
+void divide ( std::size_t               n,
+              typename P::Scalar        alpha,
+              typename P::Scalar const *x,
+              typename P::Scalar       *z )
+{
+    std::size_t const W       = P::width;
+    typename P::Reg   divisor = P::set1 ( alpha );
+    std::size_t       i       = 0;
+    for ( ; i + W <= n; i += W )
+    {
+        P::store ( z + i, P::div ( P::load ( x + i ), divisor ) );
+    }
+    for ( ; i < n; i++ ) { z [ i ] = x [ i ] / alpha; }
+}
+
+template < class P >
+void multiplyAdd ( std::size_t               n,
+                   typename P::Scalar        alpha,
+                   typename P::Scalar const *x,
+                   typename P::Scalar const *y,
+                   typename P::Scalar       *z )
+{
+    std::size_t const W     = P::width;
+    typename P::Reg   scale = P::set1 ( alpha );
+    std::size_t       i     = 0;
+    for ( ; i + W <= n; i += W )
+    {
+        P::store ( z + i,
+                   P::fma ( P::mul ( scale, P::load ( x + i ) ),
+                            P::load ( y + i ),
+                            P::load ( z + i ) ) );
+    }
+    for ( ; i < n; i++ ) { z [ i ] += alpha * x [ i ] * y [ i ]; }
+}
+
+template < class P >
+void quotient ( std::size_t               n,
+                typename P::Scalar const *x,
+                typename P::Scalar const *y,
+                typename P::Scalar       *z )
+{
+    std::size_t const W = P::width;
+    std::size_t       i = 0;
+    for ( ; i + W <= n; i += W )
+    {
+        P::store ( z + i, P::div ( P::load ( x + i ), P::load ( y + i ) ) );
+    }
+    for ( ; i < n; i++ ) { z [ i ] = x [ i ] / y [ i ]; }
+}
+
+template < class P >
+void pivot ( std::size_t               n,
+             typename P::Scalar const *t,
+             typename P::Scalar const *c,
+             typename P::Scalar       *x,
+             typename P::Scalar       *y )
+{
+    typedef typename P::Scalar X;
+    typedef typename P::Reg    Reg;
+    std::size_t const          W = P::width;
+    std::size_t                i = 0;
+    for ( ; i + W <= n; i += W )
+    {
+        Reg const ti = P::load ( t + i );
+        Reg const ci = P::load ( c + i );
+        Reg const xi = P::load ( x + i );
+        Reg const yi = P::load ( y + i );
+        P::store ( x + i, P::larger ( ti, ci, xi, yi ) );
+        P::store ( y + i, P::larger ( ti, ci, yi, xi ) );
+    }
+    for ( ; i < n; i++ )
+    {
+        bool const swap = ( c [ i ] < 0 ? -c [ i ] : c [ i ] )
+                        > ( t [ i ] < 0 ? -t [ i ] : t [ i ] );
+        X const    lo   = swap ? y [ i ] : x [ i ];
+        X const    hi   = swap ? x [ i ] : y [ i ];
+        x [ i ]         = lo;
+        y [ i ]         = hi;
+    }
+}
+
+/**
+ * @brief Fills a table with the kernels above. The micro-kernel computes
+ * MR x ( NV * P::width ) tiles.
+ */
+template < class P, std::size_t MR, std::size_t NV >
+Kernels< typename P::Scalar > table ( ) NOEXCEPT
+{
+    Kernels< typename P::Scalar > kernels;
+    kernels.gemm.mr     = MR;
+    kernels.gemm.nr     = NV * P::width;
+    kernels.gemm.run    = &gemmTile< P, MR, NV >;
+    kernels.gemv        = &gemv< P >;
+    kernels.dot         = &dot< P >;
+    kernels.axpy        = &axpy< P >;
+    kernels.add         = &add< P >;
+    kernels.sub         = &sub< P >;
+    kernels.scale       = &scale< P >;
+    kernels.divide      = &divide< P >;
+    kernels.multiplyAdd = &multiplyAdd< P >;
+    kernels.quotient    = &quotient< P >;
+    kernels.pivot       = &pivot< P >;
+    return kernels;
+}
+
+/*
+ * DoubleDouble kernels, written against the Double policy P. The high and
+ * low parts are split into separate registers, so each lane runs the
+ * error-free transformations of Double arithmetic side by side. These need
+ * P::fma to be fused: a * b - round ( a * b ) is only exact that way.
+ */
+
+// the high and low parts of W DoubleDoubles from x, in two registers.
+template < class P >
+void ddSplit ( DoubleDouble const  *x,
+               typename P::Reg     &hi,
+               typename P::Reg     &lo )
+{
+    Double high [ P::width ], low [ P::width ];
+    ML_UNROLL
+    for ( std::size_t i = 0; i < P::width; i++ )
+    {
+        high [ i ] = x [ i ].high ( );
+        low [ i ]  = x [ i ].low ( );
+    }
+    hi = P::load ( high );
+    lo = P::load ( low );
+}
+
+// W DoubleDoubles from a high and low part that need not be normalized.
+template < class P >
+void ddJoin ( typename P::Reg hi, typename P::Reg lo, DoubleDouble *x )
+{
+    Double high [ P::width ], low [ P::width ];
+    P::store ( high, hi );
+    P::store ( low, lo );
+    ML_UNROLL
+    for ( std::size_t i = 0; i < P::width; i++ )
+    {
+        Double       e = 0;
+        Double const s = dd::twoSum ( high [ i ], low [ i ], e );
+        x [ i ]        = DoubleDouble { s, e };
+    }
+}
+
+// s + e += ( ah + al ) * ( bh + bl ), with e left unnormalized: the product
+// of the high parts is exact with its fused error, the cross terms go into
+// e, and the sum of s and the product is exact by TwoSum.
+template < class P >
+void ddMultiplyAdd ( typename P::Reg  ah,
+                     typename P::Reg  al,
+                     typename P::Reg  bh,
+                     typename P::Reg  bl,
+                     typename P::Reg &s,
+                     typename P::Reg &e )
+{
+    typedef typename P::Reg Reg;
+    Reg const               p     = P::mul ( ah, bh );
+    Reg                     error = P::fma ( ah, bh, P::sub ( P::zero ( ), p ) );
+    error                         = P::fma ( ah, bl, error );
+    error                         = P::fma ( al, bh, error );
+    Reg const sum                 = P::add ( s, p );
+    Reg const z                   = P::sub ( sum, s );
+    Reg const lost = P::add ( P::sub ( s, P::sub ( sum, z ) ), P::sub ( p, z ) );
+    e              = P::add ( e, P::add ( lost, error ) );
+    s              = sum;
+}
+
+template < class P, std::size_t MR, std::size_t NV >
+void ddGemmTile ( std::size_t         kc,
+                  DoubleDouble const *a,
+                  DoubleDouble const *b,
+                  DoubleDouble       *c,
+                  std::size_t         rsc,
+                  DoubleDouble        alpha,
+                  DoubleDouble        beta )
+{
+    typedef typename P::Reg Reg;
+    std::size_t const       W = P::width;
+
+    Reg hi [ MR ][ NV ], lo [ MR ][ NV ];
+    ML_UNROLL
+    for ( std::size_t i = 0; i < MR; i++ )
+    {
+        ML_UNROLL
+        for ( std::size_t v = 0; v < NV; v++ )
+        {
+            hi [ i ][ v ] = P::zero ( );
+            lo [ i ][ v ] = P::zero ( );
+        }
+    }
+
+    for ( std::size_t p = 0; p < kc; p++ )
+    {
+        Reg bh [ NV ], bl [ NV ];
+        ML_UNROLL
+        for ( std::size_t v = 0; v < NV; v++ )
+        {
+            ddSplit< P > ( b + v * W, bh [ v ], bl [ v ] );
+        }
+        ML_UNROLL
+        for ( std::size_t i = 0; i < MR; i++ )
+        {
+            Reg const ah = P::set1 ( a [ i ].high ( ) );
+            Reg const al = P::set1 ( a [ i ].low ( ) );
+            ML_UNROLL
+            for ( std::size_t v = 0; v < NV; v++ )
+            {
+                ddMultiplyAdd< P > ( ah,
+                                     al,
+                                     bh [ v ],
+                                     bl [ v ],
+                                     hi [ i ][ v ],
+                                     lo [ i ][ v ] );
+            }
+        }
+        a += MR;
+        b += NV * W;
+    }
+
+    // the scaling is a handful of scalar operations per element of the tile.
+    DoubleDouble tile [ NV * W ];
+    for ( std::size_t i = 0; i < MR; i++ )
+    {
+        for ( std::size_t v = 0; v < NV; v++ )
+        {
+            ddJoin< P > ( hi [ i ][ v ], lo [ i ][ v ], tile + v * W );
+        }
+        DoubleDouble *row = c + i * rsc;
+        for ( std::size_t j = 0; j < NV * W; j++ )
+        {
+            row [ j ] = beta == DoubleDouble { }
+                                ? alpha * tile [ j ]
+                                : alpha * tile [ j ] + beta * row [ j ];
+        }
+    }
+}
+
+template < class P >
+DoubleDouble
+ddDot ( std::size_t n, DoubleDouble const *x, DoubleDouble const *y )
+{
+    typedef typename P::Reg Reg;
+    std::size_t const       W = P::width;
+
+    // two chains of accumulators, so that one's additions wait on the
+    // other's less.
+    Reg         s0 = P::zero ( ), e0 = P::zero ( );
+    Reg         s1 = P::zero ( ), e1 = P::zero ( );
+    std::size_t i  = 0;
+    for ( ; i + 2 * W <= n; i += 2 * W )
+    {
+        Reg xh, xl, yh, yl;
+        ddSplit< P > ( x + i, xh, xl );
+        ddSplit< P > ( y + i, yh, yl );
+        ddMultiplyAdd< P > ( xh, xl, yh, yl, s0, e0 );
+        ddSplit< P > ( x + i + W, xh, xl );
+        ddSplit< P > ( y + i + W, yh, yl );
+        ddMultiplyAdd< P > ( xh, xl, yh, yl, s1, e1 );
+    }
+    DoubleDouble lanes [ 2 * W ];
+    ddJoin< P > ( s0, e0, lanes );
+    ddJoin< P > ( s1, e1, lanes + W );
+    DoubleDouble total { };
+    for ( std::size_t k = 0; k < 2 * W; k++ ) { total += lanes [ k ]; }
+    for ( ; i < n; i++ ) { total += x [ i ] * y [ i ]; }
+    return total;
+}
+
+template < class P >
+void ddGemv ( std::size_t         m,
+              std::size_t         n,
+              DoubleDouble        alpha,
+              DoubleDouble const *a,
+              std::size_t         lda,
+              DoubleDouble const *x,
+              DoubleDouble        beta,
+              DoubleDouble       *y )
+{
+    for ( std::size_t i = 0; i < m; i++ )
+    {
+        DoubleDouble const t = ddDot< P > ( n, a + i * lda, x );
+        y [ i ] = beta == DoubleDouble { } ? alpha * t
+                                           : alpha * t + beta * y [ i ];
+    }
+}
+
+template < class P >
+void ddAxpy ( std::size_t         n,
+              DoubleDouble        alpha,
+              DoubleDouble const *x,
+              DoubleDouble       *y )
+{
+    typedef typename P::Reg Reg;
+    std::size_t const       W  = P::width;
+    Reg const               ah = P::set1 ( alpha.high ( ) );
+    Reg const               al = P::set1 ( alpha.low ( ) );
+    std::size_t             i  = 0;
+    for ( ; i + W <= n; i += W )
+    {
+        Reg xh, xl, yh, yl;
+        ddSplit< P > ( x + i, xh, xl );
+        ddSplit< P > ( y + i, yh, yl );
+        ddMultiplyAdd< P > ( ah, al, xh, xl, yh, yl );
+        ddJoin< P > ( yh, yl, y + i );
+    }
+    for ( ; i < n; i++ ) { y [ i ] += alpha * x [ i ]; }
+}
+
+/**
+ * @brief Replaces the kernels of a DoubleDouble table that have vectorized
+ * versions above. P is the Double policy, and the micro-kernel computes
+ * MR x ( NV * P::width ) tiles.
+ */
+template < class P, std::size_t MR, std::size_t NV >
+Kernels< DoubleDouble > ddTable ( Kernels< DoubleDouble > kernels ) NOEXCEPT
+{
+    kernels.gemm.mr  = MR;
+    kernels.gemm.nr  = NV * P::width;
+    kernels.gemm.run = &ddGemmTile< P, MR, NV >;
+    kernels.gemv     = &ddGemv< P >;
+    kernels.dot      = &ddDot< P >;
+    kernels.axpy     = &ddAxpy< P >;
+    return kernels;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file simd_neon.cc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Kernels for Advanced SIMD (NEON), the baseline of every AArch64
+ * processor.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#include "simd.hh"
+
+#if ML_SIMD_NEON
+
+#    include <arm_neon.h>
+#    include <cstddef>
+#    include <cstdint>
+
+namespace ml
+{
+    namespace simd
+    {
+        namespace neon
+        {
+            struct Singles
+            {
+                typedef Single      Scalar;
+                typedef float32x4_t Reg;
+                enum
+                {
+                    width = 4
+                };
+
+                static Reg zero ( ) { return vdupq_n_f32 ( 0.0f ); }
+                static Reg set1 ( Scalar x ) { return vdupq_n_f32 ( x ); }
+                static Reg load ( Scalar const *p ) { return vld1q_f32 ( p ); }
+                static void store ( Scalar *p, Reg x ) { vst1q_f32 ( p, x ); }
+                static Reg add ( Reg a, Reg b ) { return vaddq_f32 ( a, b ); }
+                static Reg sub ( Reg a, Reg b ) { return vsubq_f32 ( a, b ); }
+                static Reg mul ( Reg a, Reg b ) { return vmulq_f32 ( a, b ); }
+                static Reg div ( Reg a, Reg b ) { return vdivq_f32 ( a, b ); }
+                static Reg fma ( Reg a, Reg b, Reg c )
+                {
+                    return vfmaq_f32 ( c, a, b );
+                }
+                // y where |c| > |t| and x elsewhere
+                static Reg larger ( Reg t, Reg c, Reg x, Reg y )
+                {
+                    return vbslq_f32 ( vcagtq_f32 ( c, t ), y, x );
+                }
+                static Scalar sum ( Reg x ) { return vaddvq_f32 ( x ); }
+            };
+
+            struct Doubles
+            {
+                typedef Double      Scalar;
+                typedef float64x2_t Reg;
+                enum
+                {
+                    width = 2
+                };
+
+                static Reg zero ( ) { return vdupq_n_f64 ( 0.0 ); }
+                static Reg set1 ( Scalar x ) { return vdupq_n_f64 ( x ); }
+                static Reg load ( Scalar const *p ) { return vld1q_f64 ( p ); }
+                static void store ( Scalar *p, Reg x ) { vst1q_f64 ( p, x ); }
+                static Reg add ( Reg a, Reg b ) { return vaddq_f64 ( a, b ); }
+                static Reg sub ( Reg a, Reg b ) { return vsubq_f64 ( a, b ); }
+                static Reg mul ( Reg a, Reg b ) { return vmulq_f64 ( a, b ); }
+                static Reg div ( Reg a, Reg b ) { return vdivq_f64 ( a, b ); }
+                static Reg fma ( Reg a, Reg b, Reg c )
+                {
+                    return vfmaq_f64 ( c, a, b );
+                }
+                static Reg larger ( Reg t, Reg c, Reg x, Reg y )
+                {
+                    return vbslq_f64 ( vcagtq_f64 ( c, t ), y, x );
+                }
+                static Scalar sum ( Reg x ) { return vaddvq_f64 ( x ); }
+            };
+
+#    include "simd_kernels.tcc"
+
+            void widenHalves ( std::size_t n, Half const *x, Single *y )
+            {
+                auto const *p = reinterpret_cast< std::uint16_t const * > ( x );
+                std::size_t i = 0;
+                for ( ; i + 4 <= n; i += 4 )
+                {
+                    float16x4_t const h = vreinterpret_f16_u16 ( vld1_u16 ( p + i ) );
+                    vst1q_f32 ( y + i, vcvt_f32_f16 ( h ) );
+                }
+                for ( ; i < n; i++ ) { y [ i ] = x [ i ]; }
+            }
+
+            // a BFloat16 is the top half of its Single.
+            void widenBFloat16s ( std::size_t n, BFloat16 const *x, Single *y )
+            {
+                auto const *p = reinterpret_cast< std::uint16_t const * > ( x );
+                std::size_t i = 0;
+                for ( ; i + 4 <= n; i += 4 )
+                {
+                    uint32x4_t const w = vshll_n_u16 ( vld1_u16 ( p + i ), 16 );
+                    vst1q_f32 ( y + i, vreinterpretq_f32_u32 ( w ) );
+                }
+                for ( ; i < n; i++ ) { y [ i ] = x [ i ]; }
+            }
+
+            struct Int8s
+            {
+                typedef int32x4_t Reg;
+                typedef int8x16_t Vector;
+                enum
+                {
+                    width  = 16,
+                    offset = 0
+                };
+
+                static Vector lift ( Vector a ) { return a; }
+                static Reg    zero ( ) { return vdupq_n_s32 ( 0 ); }
+                static Vector load ( std::int8_t const *p ) { return vld1q_s8 ( p ); }
+                static Reg    dot ( Reg s, Vector a, Vector b )
+                {
+#    if defined( __ARM_FEATURE_DOTPROD )
+                    return vdotq_s32 ( s, a, b );
+#    else
+                    // 16 bit products, whose pairs widen into the sums.
+                    int16x8_t const lo = vmull_s8 ( vget_low_s8 ( a ), vget_low_s8 ( b ) );
+                    int16x8_t const hi = vmull_high_s8 ( a, b );
+                    return vpadalq_s16 ( vpadalq_s16 ( s, lo ), hi );
+#    endif
+                }
+                static std::int32_t sum ( Reg x ) { return vaddvq_s32 ( x ); }
+            };
+
+#    include "simd_bytes.tcc"
+        } // namespace neon
+    }     // namespace simd
+} // namespace ml
+
+// 32 vector registers: 16 accumulators, two for the row of B and one for the
+// broadcast of A.
+ml::simd::Kernels< Single > ml::simd::neonSingles ( ) NOEXCEPT
+{
+    return neon::table< neon::Singles, 8, 2 > ( );
+}
+
+ml::simd::Kernels< Double > ml::simd::neonDoubles ( ) NOEXCEPT
+{
+    return neon::table< neon::Doubles, 8, 2 > ( );
+}
+
+// 16 accumulators for the high and low parts of a 4 x 4 tile, out of 32
+// registers.
+ml::simd::Kernels< ml::DoubleDouble >
+ml::simd::neonDoubleDoubles ( ) NOEXCEPT
+{
+    return neon::ddTable< neon::Doubles, 4, 2 > ( genericDoubleDoubles ( ) );
+}
+
+ml::simd::Widening ml::simd::neonWidening ( ) NOEXCEPT
+{
+    return Widening { &neon::widenHalves, &neon::widenBFloat16s };
+}
+
+ml::simd::Bytes ml::simd::neonBytes ( ) NOEXCEPT
+{
+    return neon::byteTable< neon::Int8s > ( );
+}
+
+#endif // if ML_SIMD_NEON
@@ -0,0 +1,197 @@
+/**
+ * @file simd_sse2.cc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Kernels for SSE2, the baseline of every x86-64 processor.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#include "simd.hh"
+
+#if ML_SIMD_X86
+
+#    include <cstddef>
+#    include <cstdint>
+#    include <emmintrin.h>
+
+#    if defined( __clang__ )
+#        pragma clang attribute push( __attribute__( ( target( "sse2" ) ) ),  \
+                                      apply_to = function )
+#    elif defined( __GNUC__ )
+#        pragma GCC push_options
+#        pragma GCC target( "sse2" )
+#    endif
+
+namespace ml
+{
+    namespace simd
+    {
+        namespace sse2
+        {
+            struct Singles
+            {
+                typedef Single Scalar;
+                typedef __m128 Reg;
+                enum
+                {
+                    width = 4
+                };
+
+                static Reg zero ( ) { return _mm_setzero_ps ( ); }
+                static Reg set1 ( Scalar x ) { return _mm_set1_ps ( x ); }
+                static Reg load ( Scalar const *p ) { return _mm_loadu_ps ( p ); }
+                static void store ( Scalar *p, Reg x ) { _mm_storeu_ps ( p, x ); }
+                static Reg add ( Reg a, Reg b ) { return _mm_add_ps ( a, b ); }
+                static Reg sub ( Reg a, Reg b ) { return _mm_sub_ps ( a, b ); }
+                static Reg mul ( Reg a, Reg b ) { return _mm_mul_ps ( a, b ); }
+                static Reg div ( Reg a, Reg b ) { return _mm_div_ps ( a, b ); }
+                // SSE2 has no fused multiply-add.
+                static Reg fma ( Reg a, Reg b, Reg c )
+                {
+                    return _mm_add_ps ( _mm_mul_ps ( a, b ), c );
+                }
+                // y where |c| > |t| and x elsewhere
+                static Reg larger ( Reg t, Reg c, Reg x, Reg y )
+                {
+                    Reg const sign = _mm_set1_ps ( -0.0f );
+                    Reg const mask = _mm_cmpgt_ps ( _mm_andnot_ps ( sign, c ),
+                                                    _mm_andnot_ps ( sign, t ) );
+                    return _mm_or_ps ( _mm_and_ps ( mask, y ),
+                                       _mm_andnot_ps ( mask, x ) );
+                }
+                static Scalar sum ( Reg x )
+                {
+                    Reg const high = _mm_movehl_ps ( x, x );
+                    Reg const pair = _mm_add_ps ( x, high );
+                    Reg const last = _mm_shuffle_ps ( pair, pair, 1 );
+                    return _mm_cvtss_f32 ( _mm_add_ss ( pair, last ) );
+                }
+            };
+
+            struct Doubles
+            {
+                typedef Double  Scalar;
+                typedef __m128d Reg;
+                enum
+                {
+                    width = 2
+                };
+
+                static Reg zero ( ) { return _mm_setzero_pd ( ); }
+                static Reg set1 ( Scalar x ) { return _mm_set1_pd ( x ); }
+                static Reg load ( Scalar const *p ) { return _mm_loadu_pd ( p ); }
+                static void store ( Scalar *p, Reg x ) { _mm_storeu_pd ( p, x ); }
+                static Reg add ( Reg a, Reg b ) { return _mm_add_pd ( a, b ); }
+                static Reg sub ( Reg a, Reg b ) { return _mm_sub_pd ( a, b ); }
+                static Reg mul ( Reg a, Reg b ) { return _mm_mul_pd ( a, b ); }
+                static Reg div ( Reg a, Reg b ) { return _mm_div_pd ( a, b ); }
+                static Reg fma ( Reg a, Reg b, Reg c )
+                {
+                    return _mm_add_pd ( _mm_mul_pd ( a, b ), c );
+                }
+                static Reg larger ( Reg t, Reg c, Reg x, Reg y )
+                {
+                    Reg const sign = _mm_set1_pd ( -0.0 );
+                    Reg const mask = _mm_cmpgt_pd ( _mm_andnot_pd ( sign, c ),
+                                                    _mm_andnot_pd ( sign, t ) );
+                    return _mm_or_pd ( _mm_and_pd ( mask, y ),
+                                       _mm_andnot_pd ( mask, x ) );
+                }
+                static Scalar sum ( Reg x )
+                {
+                    return _mm_cvtsd_f64 ( _mm_add_sd ( x, _mm_unpackhi_pd ( x, x ) ) );
+                }
+            };
+
+#    include "simd_kernels.tcc"
+
+            // a BFloat16 is the top half of its Single, so interleaving zeros
+            // below each one widens it.
+            void widenBFloat16s ( std::size_t n, BFloat16 const *x, Single *y )
+            {
+                __m128i const zero = _mm_setzero_si128 ( );
+                std::size_t   i    = 0;
+                for ( ; i + 8 <= n; i += 8 )
+                {
+                    __m128i const b = _mm_loadu_si128 (
+                            reinterpret_cast< __m128i const * > ( x + i ) );
+                    __m128i const lo = _mm_unpacklo_epi16 ( zero, b );
+                    __m128i const hi = _mm_unpackhi_epi16 ( zero, b );
+                    _mm_storeu_ps ( y + i, _mm_castsi128_ps ( lo ) );
+                    _mm_storeu_ps ( y + i + 4, _mm_castsi128_ps ( hi ) );
+                }
+                for ( ; i < n; i++ ) { y [ i ] = x [ i ]; }
+            }
+
+            struct Int8s
+            {
+                typedef __m128i Reg;
+                typedef __m128i Vector;
+                enum
+                {
+                    width  = 16,
+                    offset = 0
+                };
+
+                static Vector lift ( Vector a ) { return a; }
+                static Reg    zero ( ) { return _mm_setzero_si128 ( ); }
+                static Vector load ( std::int8_t const *p )
+                {
+                    return _mm_loadu_si128 ( reinterpret_cast< __m128i const * > ( p ) );
+                }
+                // SSE2 has no products of bytes: unpacking a byte next to
+                // itself and shifting back right widens it with its sign.
+                static Reg dot ( Reg s, Vector a, Vector b )
+                {
+                    Reg const lo = _mm_madd_epi16 (
+                            _mm_srai_epi16 ( _mm_unpacklo_epi8 ( a, a ), 8 ),
+                            _mm_srai_epi16 ( _mm_unpacklo_epi8 ( b, b ), 8 ) );
+                    Reg const hi = _mm_madd_epi16 (
+                            _mm_srai_epi16 ( _mm_unpackhi_epi8 ( a, a ), 8 ),
+                            _mm_srai_epi16 ( _mm_unpackhi_epi8 ( b, b ), 8 ) );
+                    return _mm_add_epi32 ( s, _mm_add_epi32 ( lo, hi ) );
+                }
+                static std::int32_t sum ( Reg x )
+                {
+                    Reg const pair = _mm_add_epi32 ( x, _mm_shuffle_epi32 ( x, 0x4e ) );
+                    return _mm_cvtsi128_si32 (
+                            _mm_add_epi32 ( pair, _mm_shuffle_epi32 ( pair, 0xb1 ) ) );
+                }
+            };
+
+#    include "simd_bytes.tcc"
+        } // namespace sse2
+    }     // namespace simd
+} // namespace ml
+
+// 16 xmm registers: 8 accumulators, the row of B and the broadcast of A.
+ml::simd::Kernels< Single > ml::simd::sse2Singles ( ) NOEXCEPT
+{
+    return sse2::table< sse2::Singles, 4, 2 > ( );
+}
+
+ml::simd::Kernels< Double > ml::simd::sse2Doubles ( ) NOEXCEPT
+{
+    return sse2::table< sse2::Doubles, 4, 2 > ( );
+}
+
+ml::simd::Widening ml::simd::sse2Widening ( ) NOEXCEPT
+{
+    return Widening { genericWidening ( ).halves, &sse2::widenBFloat16s };
+}
+
+ml::simd::Bytes ml::simd::sse2Bytes ( ) NOEXCEPT
+{
+    return sse2::byteTable< sse2::Int8s > ( );
+}
+
+#    if defined( __clang__ )
+#        pragma clang attribute pop
+#    elif defined( __GNUC__ )
+#        pragma GCC pop_options
+#    endif
+
+#endif // if ML_SIMD_X86
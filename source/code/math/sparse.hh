@@ -0,0 +1,164 @@
+/**
+ * @file sparse.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Matrices that only store their nonzero elements.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "matrix.hh"
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace ml
+{
+    /**
+     * @brief Which way a SparseMatrix is compressed. Rows is CSR: the
+     * nonzeros of each row are together, so a product runs row by row and
+     * splits across threads by rows. Columns is CSC: the nonzeros of each
+     * column are together, the transpose of a CSR matrix for free.
+     */
+    enum class Compressed
+    {
+        Rows,
+        Columns,
+    };
+
+    /**
+     * @brief A matrix that stores only its nonzero elements, in compressed
+     * sparse row (CSR) or compressed sparse column (CSC) form.
+     * @details For Compressed::Rows, the nonzeros of row i are
+     * values ( ) [ k ] for k from offsets ( ) [ i ] to offsets ( ) [ i + 1 ],
+     * and indices ( ) [ k ] is the column of each. Columns is the same with
+     * rows and columns swapped. Within a row (or column) the indices are
+     * strictly increasing. Storage is O(rows + nonzeros), so a 1M x 100k
+     * matrix that is 99.9% zeros takes about 1.6 GB as Doubles instead of
+     * 800 GB, and products cost O(nonzeros) instead of O(rows * cols).
+     */
+    template < CONCEPT_NAMESPACE Floating V > class SparseMatrix
+    {
+        std::vector< std::size_t > starts;
+        std::vector< std::size_t > positions;
+        std::vector< V >           entries;
+        std::size_t                nRows  = 0;
+        std::size_t                nCols  = 0;
+        Compressed                 layout = Compressed::Rows;
+    public:
+        // one element given as its row, its column, and its value.
+        struct Entry
+        {
+            std::size_t row;
+            std::size_t col;
+            V           value;
+        };
+
+        SparseMatrix ( ) = default;
+
+        // a rows x cols matrix of zeros.
+        SparseMatrix ( std::size_t rows,
+                       std::size_t cols,
+                       Compressed  layout = Compressed::Rows );
+
+        /**
+         * @brief Builds a matrix from its elements in any order (coordinate
+         * form). Elements given more than once are summed, and zeros are
+         * kept out.
+         * @throws std::out_of_range if an element is outside the matrix.
+         */
+        SparseMatrix ( std::size_t                rows,
+                       std::size_t                cols,
+                       std::vector< Entry > const &elements,
+                       Compressed                 layout = Compressed::Rows );
+
+        /**
+         * @brief Takes the arrays of a matrix already in compressed form.
+         * @throws std::invalid_argument if they do not describe a rows x
+         * cols matrix as documented above.
+         */
+        SparseMatrix ( std::size_t                rows,
+                       std::size_t                cols,
+                       std::vector< std::size_t > offsets,
+                       std::vector< std::size_t > indices,
+                       std::vector< V >           values,
+                       Compressed                 layout = Compressed::Rows );
+
+        // the nonzero elements of a dense matrix.
+        template < CONCEPT_NAMESPACE Floating W >
+        explicit SparseMatrix ( Matrix< W > const &that,
+                                Compressed         layout = Compressed::Rows );
+
+        // the same matrix with all of its zeros.
+        Matrix< V > toMatrix ( ) const;
+
+        // the same matrix compressed the other way, in O(nonzeros).
+        SparseMatrix compress ( Compressed layout ) const;
+
+        // the transpose, which only relabels the arrays.
+        SparseMatrix transpose ( ) const &;
+        SparseMatrix transpose ( ) &&;
+
+        std::size_t rowCount ( ) const NOEXCEPT;
+        std::size_t colCount ( ) const NOEXCEPT;
+        std::size_t nonZeroCount ( ) const NOEXCEPT;
+        Compressed  compression ( ) const NOEXCEPT;
+
+        std::vector< std::size_t > const &offsets ( ) const NOEXCEPT;
+        std::vector< std::size_t > const &indices ( ) const NOEXCEPT;
+        std::vector< V > const           &values ( ) const NOEXCEPT;
+
+        // element row, col, which is a search within its row or column.
+        V operator( ) ( std::size_t row, std::size_t col ) const;
+
+        template < CONCEPT_NAMESPACE Floating W = V,
+                   CONCEPT_NAMESPACE Floating X = decltype ( V { 0 }
+                                                             + W { 0 } ) >
+        std::vector< X > operator* ( std::vector< W > const &input ) const;
+
+        template < CONCEPT_NAMESPACE Floating W = V,
+                   CONCEPT_NAMESPACE Floating X = decltype ( V { 0 }
+                                                             + W { 0 } ) >
+        Matrix< X > operator* ( Matrix< W > const &that ) const;
+    };
+
+    /**
+     * @brief y = alpha * A * x + beta * y for a sparse A on raw spans, where
+     * x has A.colCount ( ) elements and y has A.rowCount ( ). The rows of y
+     * are split across the thread pool and nothing is allocated.
+     * @note y is not read when beta is zero, and must not overlap x. CSR is
+     * the faster layout here: for CSC each thread searches every column for
+     * its rows.
+     */
+    template < CONCEPT_NAMESPACE Floating X,
+               CONCEPT_NAMESPACE Floating V,
+               CONCEPT_NAMESPACE Floating W >
+    void spmv ( typename std::common_type< X >::type alpha,
+                SparseMatrix< V > const              &a,
+                W const                              *x,
+                typename std::common_type< X >::type beta,
+                X                                    *y );
+
+    /**
+     * @brief C = alpha * A * B + beta * C for a sparse A and dense B and C,
+     * written into the storage C already has. Each nonzero of A adds a
+     * multiple of one row of B to one row of C.
+     * @throws std::out_of_range if the shapes do not line up.
+     * @note C is not read when beta is zero, and must not be B.
+     */
+    template < CONCEPT_NAMESPACE Floating X,
+               CONCEPT_NAMESPACE Floating V,
+               CONCEPT_NAMESPACE Floating W >
+    void spmm ( typename std::common_type< X >::type alpha,
+                SparseMatrix< V > const              &a,
+                Matrix< W > const                    &b,
+                typename std::common_type< X >::type beta,
+                Matrix< X >                          &c );
+} // namespace ml
+
+#include "sparse.tcc"
@@ -0,0 +1,472 @@
+/**
+ * @file sparse.tcc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief This C++ file is meant to be included only in sparse.hh
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace ml
+{
+    namespace sparse
+    {
+        /**
+         * @brief Regroups compressed arrays by their other dimension: the
+         * nonzeros of a matrix grouped by rows become the same nonzeros
+         * grouped by columns, or the other way around. The indices in each
+         * group stay sorted because the groups are walked in order.
+         */
+        template < class V >
+        void regroup ( std::size_t                       minor,
+                       std::vector< std::size_t > const &starts,
+                       std::vector< std::size_t > const &positions,
+                       std::vector< V > const           &entries,
+                       std::vector< std::size_t >       &outStarts,
+                       std::vector< std::size_t >       &outPositions,
+                       std::vector< V >                 &outEntries )
+        {
+            outStarts.assign ( minor + 1, 0 );
+            for ( std::size_t p : positions ) { outStarts [ p + 1 ]++; }
+            for ( std::size_t j = 0; j < minor; j++ )
+            {
+                outStarts [ j + 1 ] += outStarts [ j ];
+            }
+            outPositions.resize ( positions.size ( ) );
+            outEntries.resize ( entries.size ( ) );
+            std::vector< std::size_t > next ( outStarts.begin ( ),
+                                              outStarts.end ( ) - 1 );
+            for ( std::size_t i = 0; i + 1 < starts.size ( ); i++ )
+            {
+                for ( std::size_t k = starts [ i ]; k < starts [ i + 1 ]; k++ )
+                {
+                    std::size_t const to = next [ positions [ k ] ]++;
+                    outPositions [ to ]  = i;
+                    outEntries [ to ]    = entries [ k ];
+                }
+            }
+        }
+
+        // the first nonzero of group j whose index is at least first.
+        inline std::size_t seek ( std::vector< std::size_t > const &starts,
+                                  std::vector< std::size_t > const &positions,
+                                  std::size_t                       j,
+                                  std::size_t                       first )
+        {
+            auto const begin = positions.begin ( );
+            return std::size_t ( std::lower_bound ( begin + starts [ j ],
+                                                    begin + starts [ j + 1 ],
+                                                    first )
+                                 - begin );
+        }
+
+        // the rows of y that one thread of a CSC product is responsible
+        // for. Each thread searches every column, so use one piece per
+        // thread rather than many small ones.
+        inline std::size_t piecesOf ( std::size_t rows ) NOEXCEPT
+        {
+            std::size_t const threads = thread::threadCount ( );
+            return rows / threads + ( rows % threads ? 1 : 0 );
+        }
+    } // namespace sparse
+} // namespace ml
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::SparseMatrix< V >::SparseMatrix ( std::size_t rows,
+                                      std::size_t cols,
+                                      Compressed  layout ) :
+    starts ( ( layout == Compressed::Rows ? rows : cols ) + 1, 0 ),
+    nRows ( rows ),
+    nCols ( cols ),
+    layout ( layout )
+{
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::SparseMatrix< V >::SparseMatrix ( std::size_t                rows,
+                                      std::size_t                cols,
+                                      std::vector< Entry > const &elements,
+                                      Compressed                 layout ) :
+    SparseMatrix ( rows, cols, layout )
+{
+    bool const           byRows = layout == Compressed::Rows;
+    std::vector< Entry > sorted;
+    sorted.reserve ( elements.size ( ) );
+    for ( Entry const &e : elements )
+    {
+        if ( e.row >= rows || e.col >= cols )
+        {
+            throw std::out_of_range ( "Element out of range!" );
+        }
+        sorted.push_back ( byRows ? e : Entry { e.col, e.row, e.value } );
+    }
+    // now every entry is ( major, minor, value ).
+    std::sort ( sorted.begin ( ),
+                sorted.end ( ),
+                [ ] ( Entry const &a, Entry const &b ) {
+                    return a.row != b.row ? a.row < b.row : a.col < b.col;
+                } );
+    for ( std::size_t k = 0; k < sorted.size ( ); )
+    {
+        Entry sum = sorted [ k ];
+        for ( k++; k < sorted.size ( ) && sorted [ k ].row == sum.row
+                   && sorted [ k ].col == sum.col;
+              k++ )
+        {
+            sum.value += sorted [ k ].value;
+        }
+        if ( sum.value != V { 0 } )
+        {
+            positions.push_back ( sum.col );
+            entries.push_back ( sum.value );
+            starts [ sum.row + 1 ]++;
+        }
+    }
+    for ( std::size_t i = 0; i + 1 < starts.size ( ); i++ )
+    {
+        starts [ i + 1 ] += starts [ i ];
+    }
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::SparseMatrix< V >::SparseMatrix ( std::size_t                rows,
+                                      std::size_t                cols,
+                                      std::vector< std::size_t > offsets,
+                                      std::vector< std::size_t > indices,
+                                      std::vector< V >           values,
+                                      Compressed                 layout ) :
+    starts ( std::move ( offsets ) ),
+    positions ( std::move ( indices ) ),
+    entries ( std::move ( values ) ),
+    nRows ( rows ),
+    nCols ( cols ),
+    layout ( layout )
+{
+    std::size_t const major = layout == Compressed::Rows ? rows : cols;
+    std::size_t const minor = layout == Compressed::Rows ? cols : rows;
+    bool valid = starts.size ( ) == major + 1 && starts.front ( ) == 0
+              && starts.back ( ) == positions.size ( )
+              && positions.size ( ) == entries.size ( );
+    for ( std::size_t i = 0; valid && i < major; i++ )
+    {
+        valid = starts [ i ] <= starts [ i + 1 ]
+             && starts [ i + 1 ] <= positions.size ( );
+        for ( std::size_t k = starts [ i ]; valid && k < starts [ i + 1 ]; k++ )
+        {
+            valid = positions [ k ] < minor
+                 && ( k == starts [ i ] || positions [ k - 1 ] < positions [ k ] );
+        }
+    }
+    if ( !valid )
+    {
+        throw std::invalid_argument ( "Malformed sparse matrix!" );
+    }
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+template < CONCEPT_NAMESPACE Floating W >
+ml::SparseMatrix< V >::SparseMatrix ( Matrix< W > const &that, Compressed layout ) :
+    SparseMatrix ( that.rowCount ( ), that.colCount ( ), Compressed::Rows )
+{
+    for ( std::size_t i = 0; i < nRows; i++ )
+    {
+        W const *row = that.data ( ) + i * that.leadingDimension ( );
+        for ( std::size_t j = 0; j < nCols; j++ )
+        {
+            if ( row [ j ] != W { 0 } )
+            {
+                positions.push_back ( j );
+                entries.push_back ( V ( row [ j ] ) );
+            }
+        }
+        starts [ i + 1 ] = positions.size ( );
+    }
+    if ( layout == Compressed::Columns )
+    {
+        *this = compress ( Compressed::Columns );
+    }
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Matrix< V > ml::SparseMatrix< V >::toMatrix ( ) const
+{
+    Matrix< V >       output { nRows, nCols };
+    std::size_t const ld = output.leadingDimension ( );
+    for ( std::size_t i = 0; i + 1 < starts.size ( ); i++ )
+    {
+        for ( std::size_t k = starts [ i ]; k < starts [ i + 1 ]; k++ )
+        {
+            std::size_t const row = layout == Compressed::Rows ? i : positions [ k ];
+            std::size_t const col = layout == Compressed::Rows ? positions [ k ] : i;
+            output.data ( ) [ row * ld + col ] = entries [ k ];
+        }
+    }
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::SparseMatrix< V > ml::SparseMatrix< V >::compress ( Compressed layout ) const
+{
+    if ( layout == this->layout )
+    {
+        return *this;
+    }
+    SparseMatrix output;
+    output.nRows  = nRows;
+    output.nCols  = nCols;
+    output.layout = layout;
+    sparse::regroup ( layout == Compressed::Rows ? nRows : nCols,
+                      starts,
+                      positions,
+                      entries,
+                      output.starts,
+                      output.positions,
+                      output.entries );
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::SparseMatrix< V > ml::SparseMatrix< V >::transpose ( ) const &
+{
+    return SparseMatrix ( *this ).transpose ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::SparseMatrix< V > ml::SparseMatrix< V >::transpose ( ) &&
+{
+    // the rows of A, compressed, are the columns of A^T compressed.
+    SparseMatrix output = std::move ( *this );
+    std::swap ( output.nRows, output.nCols );
+    output.layout = output.layout == Compressed::Rows ? Compressed::Columns
+                                                      : Compressed::Rows;
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::SparseMatrix< V >::rowCount ( ) const noexcept
+{
+    return nRows;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::SparseMatrix< V >::colCount ( ) const noexcept
+{
+    return nCols;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::size_t ml::SparseMatrix< V >::nonZeroCount ( ) const noexcept
+{
+    return entries.size ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Compressed ml::SparseMatrix< V >::compression ( ) const noexcept
+{
+    return layout;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::vector< std::size_t > const &ml::SparseMatrix< V >::offsets ( ) const noexcept
+{
+    return starts;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::vector< std::size_t > const &ml::SparseMatrix< V >::indices ( ) const noexcept
+{
+    return positions;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+std::vector< V > const &ml::SparseMatrix< V >::values ( ) const noexcept
+{
+    return entries;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+V ml::SparseMatrix< V >::operator( ) ( std::size_t row, std::size_t col ) const
+{
+    if ( row >= nRows || col >= nCols )
+    {
+        throw std::out_of_range ( "Element out of range!" );
+    }
+    std::size_t const major = layout == Compressed::Rows ? row : col;
+    std::size_t const minor = layout == Compressed::Rows ? col : row;
+    auto const        first = positions.begin ( ) + starts [ major ];
+    auto const        last  = positions.begin ( ) + starts [ major + 1 ];
+    auto const        found = std::lower_bound ( first, last, minor );
+    if ( found == last || *found != minor )
+    {
+        return V { 0 };
+    }
+    return entries [ std::size_t ( found - positions.begin ( ) ) ];
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+template < CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X >
+std::vector< X > ml::SparseMatrix< V >::operator* ( std::vector< W > const &input ) const
+{
+    if ( input.size ( ) != nCols )
+    {
+        throw std::out_of_range ( "Vector length mismatch!" );
+    }
+    std::vector< X > output ( nRows );
+    spmv< X > ( 1, *this, input.data ( ), 0, output.data ( ) );
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+template < CONCEPT_NAMESPACE Floating W, CONCEPT_NAMESPACE Floating X >
+ml::Matrix< X > ml::SparseMatrix< V >::operator* ( Matrix< W > const &that ) const
+{
+    Matrix< X > output { nRows, that.colCount ( ) };
+    spmm< X > ( 1, *this, that, 0, output );
+    return output;
+}
+
+template < CONCEPT_NAMESPACE Floating X,
+           CONCEPT_NAMESPACE Floating V,
+           CONCEPT_NAMESPACE Floating W >
+void ml::spmv ( typename std::common_type< X >::type alpha,
+                SparseMatrix< V > const              &a,
+                W const                              *x,
+                typename std::common_type< X >::type beta,
+                X                                    *y )
+{
+    std::size_t const                 rows      = a.rowCount ( );
+    std::vector< std::size_t > const &starts    = a.offsets ( );
+    std::vector< std::size_t > const &positions = a.indices ( );
+    std::vector< V > const           &entries   = a.values ( );
+    if ( a.compression ( ) == Compressed::Rows )
+    {
+        std::size_t const perRow = rows ? a.nonZeroCount ( ) / rows + 1 : 1;
+        thread::parallelFor (
+                0,
+                rows,
+                thread::grainFor ( rows, 2 * perRow ),
+                [ & ] ( std::size_t first, std::size_t last ) {
+                    for ( std::size_t i = first; i < last; i++ )
+                    {
+                        X t = X { 0 };
+                        for ( std::size_t k = starts [ i ]; k < starts [ i + 1 ]; k++ )
+                        {
+                            t += entries [ k ] * x [ positions [ k ] ];
+                        }
+                        y [ i ] = beta == X { 0 } ? alpha * t : alpha * t + beta * y [ i ];
+                    }
+                } );
+        return;
+    }
+    // each column scatters into y, so give every thread its own rows of y
+    // and have it pick those rows out of each column.
+    thread::parallelFor (
+            0,
+            rows,
+            std::max ( thread::grainFor ( rows, 2 * a.colCount ( ) ),
+                       sparse::piecesOf ( rows ) ),
+            [ & ] ( std::size_t first, std::size_t last ) {
+                for ( std::size_t i = first; i < last; i++ )
+                {
+                    y [ i ] = beta == X { 0 } ? X { 0 } : beta * y [ i ];
+                }
+                for ( std::size_t j = 0; j + 1 < starts.size ( ); j++ )
+                {
+                    X const     scale = alpha * x [ j ];
+                    std::size_t k     = sparse::seek ( starts, positions, j, first );
+                    for ( ; k < starts [ j + 1 ] && positions [ k ] < last; k++ )
+                    {
+                        y [ positions [ k ] ] += scale * entries [ k ];
+                    }
+                }
+            } );
+}
+
+template < CONCEPT_NAMESPACE Floating X,
+           CONCEPT_NAMESPACE Floating V,
+           CONCEPT_NAMESPACE Floating W >
+void ml::spmm ( typename std::common_type< X >::type alpha,
+                SparseMatrix< V > const              &a,
+                Matrix< W > const                    &b,
+                typename std::common_type< X >::type beta,
+                Matrix< X >                          &c )
+{
+    if ( a.colCount ( ) != b.rowCount ( ) || c.rowCount ( ) != a.rowCount ( )
+         || c.colCount ( ) != b.colCount ( ) )
+    {
+        throw std::out_of_range ( "Shape mismatch!" );
+    }
+    std::size_t const                 rows      = a.rowCount ( );
+    std::size_t const                 cols      = b.colCount ( );
+    std::vector< std::size_t > const &starts    = a.offsets ( );
+    std::vector< std::size_t > const &positions = a.indices ( );
+    std::vector< V > const           &entries   = a.values ( );
+    auto rowOf = [ & ] ( Matrix< X > &m, std::size_t i ) {
+        return m.data ( ) + i * m.leadingDimension ( );
+    };
+    auto sourceOf = [ & ] ( std::size_t k ) {
+        return b.data ( ) + k * b.leadingDimension ( );
+    };
+    auto prepare = [ & ] ( X *row ) {
+        if ( beta == X { 0 } )
+        {
+            std::fill ( row, row + cols, X { 0 } );
+        }
+        else if ( beta != X { 1 } )
+        {
+            kernel::scale ( cols, beta, row, row );
+        }
+    };
+    if ( a.compression ( ) == Compressed::Rows )
+    {
+        std::size_t const perRow = rows ? a.nonZeroCount ( ) / rows + 1 : 1;
+        thread::parallelFor (
+                0,
+                rows,
+                thread::grainFor ( rows, 2 * perRow * cols ),
+                [ & ] ( std::size_t first, std::size_t last ) {
+                    for ( std::size_t i = first; i < last; i++ )
+                    {
+                        X *row = rowOf ( c, i );
+                        prepare ( row );
+                        for ( std::size_t k = starts [ i ]; k < starts [ i + 1 ]; k++ )
+                        {
+                            kernel::axpy ( cols,
+                                           X ( alpha * entries [ k ] ),
+                                           sourceOf ( positions [ k ] ),
+                                           row );
+                        }
+                    }
+                } );
+        return;
+    }
+    thread::parallelFor (
+            0,
+            rows,
+            std::max ( thread::grainFor ( rows, 2 * a.colCount ( ) * cols ),
+                       sparse::piecesOf ( rows ) ),
+            [ & ] ( std::size_t first, std::size_t last ) {
+                for ( std::size_t i = first; i < last; i++ )
+                {
+                    prepare ( rowOf ( c, i ) );
+                }
+                for ( std::size_t j = 0; j + 1 < starts.size ( ); j++ )
+                {
+                    std::size_t k = sparse::seek ( starts, positions, j, first );
+                    for ( ; k < starts [ j + 1 ] && positions [ k ] < last; k++ )
+                    {
+                        kernel::axpy ( cols,
+                                       X ( alpha * entries [ k ] ),
+                                       sourceOf ( j ),
+                                       rowOf ( c, positions [ k ] ) );
+                    }
+                }
+            } );
+}
@@ -0,0 +1,74 @@
+/**
+ * @file trsm.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief Triangular solves on raw, strided memory.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "meta.hh"
+
+#include <cstddef>
+
+namespace ml
+{
+    namespace kernel
+    {
+        // which half of a square matrix holds the triangular one.
+        enum class Triangle
+        {
+            Lower,
+            Upper,
+        };
+
+        // whether the diagonal is all ones, and so is never read.
+        enum class Diagonal
+        {
+            Unit,
+            General,
+        };
+
+        /**
+         * @brief Solves A * X = B by substitution, overwriting B with X, where
+         * A is n x n and triangular and B is n x m.
+         * @details The rows of B are taken in blocks. Each diagonal block of A
+         * is solved against the columns of B, which are split across the
+         * thread pool, and the rest of B is updated with one GEMM per block,
+         * so for many right hand sides nearly all of the work is a matrix
+         * product.
+         * @note Elements of A live at a [ i * rsa + j * csa ], so passing
+         * swapped strides solves with a transpose for free, and elements of B
+         * at b [ i * rsb + j ]. Only the given triangle of A is read.
+         */
+        template < class X, class V >
+        void trsm ( Triangle    shape,
+                    Diagonal    diagonal,
+                    std::size_t n,
+                    std::size_t m,
+                    V const    *a,
+                    std::size_t rsa,
+                    std::size_t csa,
+                    X          *b,
+                    std::size_t rsb );
+
+        /**
+         * @brief Solves A * x = b for a single right hand side, overwriting
+         * b with x. The same as trsm, but updates with GEMV.
+         */
+        template < class X, class V >
+        void trsv ( Triangle    shape,
+                    Diagonal    diagonal,
+                    std::size_t n,
+                    V const    *a,
+                    std::size_t rsa,
+                    std::size_t csa,
+                    X          *b );
+    } // namespace kernel
+} // namespace ml
+
+#include "trsm.tcc"
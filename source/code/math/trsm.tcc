@@ -0,0 +1,200 @@
+/**
+ * @file trsm.tcc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief This C++ file is meant to be included only in trsm.hh
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+
+#include "../thread/pool.hh"
+#include "gemm.hh"
+#include "kernels.hh"
+
+#include <algorithm>
+
+namespace ml
+{
+    namespace kernel
+    {
+        // rows per diagonal block, which is also the inner dimension of
+        // every GEMM update.
+        constexpr std::size_t triangularBlock = 64;
+
+        // substitution within rows first to last of A and B, for columns
+        // from to to of B.
+        template < class X, class V >
+        void substitute ( Triangle    shape,
+                          Diagonal    diagonal,
+                          std::size_t first,
+                          std::size_t last,
+                          V const    *a,
+                          std::size_t rsa,
+                          std::size_t csa,
+                          X          *b,
+                          std::size_t rsb,
+                          std::size_t from,
+                          std::size_t to )
+        {
+            std::size_t const cols = to - from;
+            for ( std::size_t k = first; k < last; k++ )
+            {
+                bool const        down = shape == Triangle::Lower;
+                std::size_t const i    = down ? k : first + last - 1 - k;
+                std::size_t const lo   = down ? first : i + 1;
+                std::size_t const hi   = down ? i : last;
+                X *const          row  = b + i * rsb + from;
+                for ( std::size_t p = lo; p < hi; p++ )
+                {
+                    axpy ( cols,
+                           X ( -a [ i * rsa + p * csa ] ),
+                           b + p * rsb + from,
+                           row );
+                }
+                if ( diagonal == Diagonal::General )
+                {
+                    divide ( cols, X ( a [ i * rsa + i * csa ] ), row, row );
+                }
+            }
+        }
+    } // namespace kernel
+} // namespace ml
+
+template < class X, class V >
+void ml::kernel::trsm ( Triangle    shape,
+                        Diagonal    diagonal,
+                        std::size_t n,
+                        std::size_t m,
+                        V const    *a,
+                        std::size_t rsa,
+                        std::size_t csa,
+                        X          *b,
+                        std::size_t rsb )
+{
+    if ( m == 0 )
+    {
+        return;
+    }
+    std::size_t const blocks = ( n + triangularBlock - 1 ) / triangularBlock;
+    for ( std::size_t k = 0; k < blocks; k++ )
+    {
+        // lower triangles go top down, upper ones bottom up.
+        std::size_t const which = shape == Triangle::Lower ? k : blocks - 1 - k;
+        std::size_t const first = which * triangularBlock;
+        std::size_t const last  = std::min ( n, first + triangularBlock );
+        std::size_t const width = last - first;
+        thread::parallelFor (
+                0,
+                m,
+                thread::grainFor ( m, width * width ),
+                [ & ] ( std::size_t from, std::size_t to ) {
+                    substitute ( shape,
+                                 diagonal,
+                                 first,
+                                 last,
+                                 a,
+                                 rsa,
+                                 csa,
+                                 b,
+                                 rsb,
+                                 from,
+                                 to );
+                } );
+        // and take the solved rows out of the rows still to come.
+        std::size_t const begin = shape == Triangle::Lower ? last : 0;
+        std::size_t const end   = shape == Triangle::Lower ? n : first;
+        if ( begin < end )
+        {
+            gemm ( end - begin,
+                   m,
+                   width,
+                   X { -1 },
+                   a + begin * rsa + first * csa,
+                   rsa,
+                   csa,
+                   b + first * rsb,
+                   rsb,
+                   std::size_t { 1 },
+                   X { 1 },
+                   b + begin * rsb,
+                   rsb );
+        }
+    }
+}
+
+template < class X, class V >
+void ml::kernel::trsv ( Triangle    shape,
+                        Diagonal    diagonal,
+                        std::size_t n,
+                        V const    *a,
+                        std::size_t rsa,
+                        std::size_t csa,
+                        X          *b )
+{
+    std::size_t const blocks = ( n + triangularBlock - 1 ) / triangularBlock;
+    for ( std::size_t k = 0; k < blocks; k++ )
+    {
+        std::size_t const which = shape == Triangle::Lower ? k : blocks - 1 - k;
+        std::size_t const first = which * triangularBlock;
+        std::size_t const last  = std::min ( n, first + triangularBlock );
+        for ( std::size_t q = first; q < last; q++ )
+        {
+            bool const        down = shape == Triangle::Lower;
+            std::size_t const i    = down ? q : first + last - 1 - q;
+            std::size_t const lo   = down ? first : i + 1;
+            std::size_t const hi   = down ? i : last;
+            X                 t    = b [ i ];
+            for ( std::size_t p = lo; p < hi; p++ )
+            {
+                t -= a [ i * rsa + p * csa ] * b [ p ];
+            }
+            if ( diagonal == Diagonal::General )
+            {
+                t /= a [ i * rsa + i * csa ];
+            }
+            b [ i ] = t;
+        }
+        std::size_t const begin = shape == Triangle::Lower ? last : 0;
+        std::size_t const end   = shape == Triangle::Lower ? n : first;
+        if ( begin == end )
+        {
+            continue;
+        }
+        if ( csa == 1 )
+        {
+            // rows of A are contiguous: one dot product per row.
+            gemv ( end - begin,
+                   last - first,
+                   X { -1 },
+                   a + begin * rsa + first,
+                   rsa,
+                   b + first,
+                   X { 1 },
+                   b + begin );
+        }
+        else if ( rsa == 1 )
+        {
+            // columns are (a transpose): one axpy per column.
+            for ( std::size_t p = first; p < last; p++ )
+            {
+                axpy ( end - begin,
+                       X ( -b [ p ] ),
+                       a + begin + p * csa,
+                       b + begin );
+            }
+        }
+        else
+        {
+            for ( std::size_t p = first; p < last; p++ )
+            {
+                for ( std::size_t i = begin; i < end; i++ )
+                {
+                    b [ i ] -= a [ i * rsa + p * csa ] * b [ p ];
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,103 @@
+/**
+ * @file view.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief A window onto elements that something else owns.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "gemm.hh"
+#include "meta.hh"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace ml
+{
+    /**
+     * @brief A rows x cols window onto memory that something else owns,
+     * such as a Matrix or a buffer from outside of ML. Element i, j lives at
+     * data ( ) [ i * rowStride ( ) + j * colStride ( ) ].
+     * @details Views cost nothing to make: taking a block, transposing, or
+     * viewing a raw buffer only does arithmetic on the pointer and strides.
+     * The kernels all take a pointer and strides, so a view passes straight
+     * through to them.
+     * @note Like Row, a view refers to elements; copying a view copies the
+     * reference, and assign copies elements into the viewed memory. The
+     * memory must outlive the view.
+     * @tparam V the element type, const-qualified for a read-only view.
+     */
+    template < class V > class MatrixView
+    {
+        V          *origin;
+        std::size_t nRows;
+        std::size_t nCols;
+        std::size_t rs;
+        std::size_t cs;
+    public:
+        using Value = typename std::remove_const< V >::type;
+
+        MatrixView ( V          *origin,
+                     std::size_t rows,
+                     std::size_t cols,
+                     std::size_t rowStride,
+                     std::size_t colStride = 1 ) NOEXCEPT;
+
+        // allow a view of mutable elements to become a view of const ones.
+        template < class W >
+        MatrixView ( MatrixView< W > const &that ) NOEXCEPT;
+
+        std::size_t rowCount ( ) const NOEXCEPT;
+        std::size_t colCount ( ) const NOEXCEPT;
+        std::size_t rowStride ( ) const NOEXCEPT;
+        std::size_t colStride ( ) const NOEXCEPT;
+
+        V *data ( ) const NOEXCEPT;
+
+        V &operator( ) ( std::size_t row, std::size_t col ) const;
+        // throws std::out_of_range if the element is outside of the view.
+        V &at ( std::size_t row, std::size_t col ) const;
+
+        /**
+         * @brief The rows x cols block whose top-left element is element
+         * row, col of this.
+         * @throws std::out_of_range if the block does not fit in this.
+         */
+        MatrixView block ( std::size_t row,
+                           std::size_t col,
+                           std::size_t rows,
+                           std::size_t cols ) const;
+
+        MatrixView transpose ( ) const NOEXCEPT;
+
+        /**
+         * @brief Copies the elements of that into the elements this views.
+         * @throws std::out_of_range if the shapes differ.
+         */
+        template < class W >
+        MatrixView const &assign ( MatrixView< W > const &that ) const;
+
+        void fill ( Value const &value ) const;
+    };
+
+    /**
+     * @brief C = alpha * A * B + beta * C on views, through the blocked
+     * GEMM. Any of the views may be transposed or a block of something
+     * larger.
+     * @throws std::out_of_range if the shapes do not line up.
+     * @note C is not read when beta is zero.
+     */
+    template < class X, class V, class W >
+    void gemm ( typename std::common_type< X >::type alpha,
+                MatrixView< V > const                &a,
+                MatrixView< W > const                &b,
+                typename std::common_type< X >::type beta,
+                MatrixView< X > const                &c );
+} // namespace ml
+
+#include "view.tcc"
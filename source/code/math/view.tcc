@@ -0,0 +1,228 @@
+/**
+ * @file view.tcc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief This C++ file is meant to be included only in view.hh
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+template < class V >
+ml::MatrixView< V >::MatrixView ( V          *origin,
+                                  std::size_t rows,
+                                  std::size_t cols,
+                                  std::size_t rowStride,
+                                  std::size_t colStride ) noexcept :
+    origin ( origin ),
+    nRows ( rows ),
+    nCols ( cols ),
+    rs ( rowStride ),
+    cs ( colStride )
+{
+}
+
+template < class V >
+template < class W >
+ml::MatrixView< V >::MatrixView ( MatrixView< W > const &that ) noexcept :
+    origin ( that.data ( ) ),
+    nRows ( that.rowCount ( ) ),
+    nCols ( that.colCount ( ) ),
+    rs ( that.rowStride ( ) ),
+    cs ( that.colStride ( ) )
+{
+}
+
+template < class V > std::size_t ml::MatrixView< V >::rowCount ( ) const noexcept
+{
+    return nRows;
+}
+
+template < class V > std::size_t ml::MatrixView< V >::colCount ( ) const noexcept
+{
+    return nCols;
+}
+
+template < class V > std::size_t ml::MatrixView< V >::rowStride ( ) const noexcept
+{
+    return rs;
+}
+
+template < class V > std::size_t ml::MatrixView< V >::colStride ( ) const noexcept
+{
+    return cs;
+}
+
+template < class V > V *ml::MatrixView< V >::data ( ) const noexcept
+{
+    return origin;
+}
+
+template < class V >
+V &ml::MatrixView< V >::operator( ) ( std::size_t row, std::size_t col ) const
+{
+    return origin [ row * rs + col * cs ];
+}
+
+template < class V >
+V &ml::MatrixView< V >::at ( std::size_t row, std::size_t col ) const
+{
+    if ( row >= nRows || col >= nCols )
+    {
+        throw std::out_of_range ( "Element out of range!" );
+    }
+    return origin [ row * rs + col * cs ];
+}
+
+template < class V >
+ml::MatrixView< V > ml::MatrixView< V >::block ( std::size_t row,
+                                                 std::size_t col,
+                                                 std::size_t rows,
+                                                 std::size_t cols ) const
+{
+    if ( row > nRows || col > nCols || rows > nRows - row
+         || cols > nCols - col )
+    {
+        throw std::out_of_range ( "Block out of range!" );
+    }
+    return MatrixView { origin + row * rs + col * cs, rows, cols, rs, cs };
+}
+
+template < class V >
+ml::MatrixView< V > ml::MatrixView< V >::transpose ( ) const noexcept
+{
+    return MatrixView { origin, nCols, nRows, cs, rs };
+}
+
+template < class V >
+template < class W >
+ml::MatrixView< V > const &
+        ml::MatrixView< V >::assign ( MatrixView< W > const &that ) const
+{
+    if ( that.rowCount ( ) != nRows || that.colCount ( ) != nCols )
+    {
+        throw std::out_of_range ( "Shape mismatch!" );
+    }
+    if ( cs == 1 && that.colStride ( ) == 1 )
+    {
+        for ( std::size_t i = 0; i < nRows; i++ )
+        {
+            W const *from = that.data ( ) + i * that.rowStride ( );
+            // explicitly, for element types like DoubleDouble that only
+            // narrow on request.
+            std::transform ( from, from + nCols, origin + i * rs,
+                             [] ( W const &x ) { return V ( x ); } );
+        }
+        return *this;
+    }
+    // one side walks across rows while the other walks down columns, so go
+    // tile by tile to touch each cache line once instead of once per element.
+    std::size_t const tile = 32;
+    for ( std::size_t i0 = 0; i0 < nRows; i0 += tile )
+    {
+        std::size_t const i1 = std::min ( nRows, i0 + tile );
+        for ( std::size_t j0 = 0; j0 < nCols; j0 += tile )
+        {
+            std::size_t const j1 = std::min ( nCols, j0 + tile );
+            for ( std::size_t i = i0; i < i1; i++ )
+            {
+                W const *from = that.data ( ) + i * that.rowStride ( );
+                V       *to   = origin + i * rs;
+                for ( std::size_t j = j0; j < j1; j++ )
+                {
+                    to [ j * cs ] = V ( from [ j * that.colStride ( ) ] );
+                }
+            }
+        }
+    }
+    return *this;
+}
+
+template < class V > void ml::MatrixView< V >::fill ( Value const &value ) const
+{
+    for ( std::size_t i = 0; i < nRows; i++ )
+    {
+        for ( std::size_t j = 0; j < nCols; j++ ) { origin [ i * rs + j * cs ] = value; }
+    }
+}
+
+template < class X, class V, class W >
+void ml::gemm ( typename std::common_type< X >::type alpha,
+                MatrixView< V > const                &a,
+                MatrixView< W > const                &b,
+                typename std::common_type< X >::type beta,
+                MatrixView< X > const                &c )
+{
+    std::size_t const m = c.rowCount ( );
+    std::size_t const n = c.colCount ( );
+    std::size_t const k = a.colCount ( );
+    if ( a.rowCount ( ) != m || b.rowCount ( ) != k || b.colCount ( ) != n )
+    {
+        throw std::out_of_range ( "Shape mismatch!" );
+    }
+    if ( c.colStride ( ) == 1 )
+    {
+        kernel::gemm ( m,
+                       n,
+                       k,
+                       alpha,
+                       a.data ( ),
+                       a.rowStride ( ),
+                       a.colStride ( ),
+                       b.data ( ),
+                       b.rowStride ( ),
+                       b.colStride ( ),
+                       beta,
+                       c.data ( ),
+                       c.rowStride ( ) );
+        return;
+    }
+    if ( c.rowStride ( ) == 1 )
+    {
+        // C is stored transposed, so compute C^T = B^T * A^T instead.
+        kernel::gemm ( n,
+                       m,
+                       k,
+                       alpha,
+                       b.data ( ),
+                       b.colStride ( ),
+                       b.rowStride ( ),
+                       a.data ( ),
+                       a.colStride ( ),
+                       a.rowStride ( ),
+                       beta,
+                       c.data ( ),
+                       c.colStride ( ) );
+        return;
+    }
+    // neither layout suits the micro-kernel, so go through a scratch copy.
+    std::vector< X > product ( m * n );
+    kernel::gemm ( m,
+                   n,
+                   k,
+                   alpha,
+                   a.data ( ),
+                   a.rowStride ( ),
+                   a.colStride ( ),
+                   b.data ( ),
+                   b.rowStride ( ),
+                   b.colStride ( ),
+                   X { 0 },
+                   product.data ( ),
+                   n );
+    for ( std::size_t i = 0; i < m; i++ )
+    {
+        for ( std::size_t j = 0; j < n; j++ )
+        {
+            X &out = c ( i, j );
+            out    = beta == X { 0 } ? product [ i * n + j ]
+                                     : beta * out + product [ i * n + j ];
+        }
+    }
+}
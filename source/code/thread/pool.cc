@@ -0,0 +1,319 @@
+/**
+ * @file pool.cc
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief The work-stealing pool behind parallelFor.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#include "pool.hh"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Job
+    {
+        ml::thread::Body body;
+        std::size_t      grain;
+        // pieces that exist but have not finished yet.
+        std::atomic< std::size_t > remaining;
+        std::mutex                 failureLock;
+        std::exception_ptr         failure;
+    };
+
+    struct Task
+    {
+        Job        *job;
+        std::size_t first;
+        std::size_t last;
+    };
+
+    // a deque that keeps its memory, so that running a job allocates nothing
+    // once the queues have grown to fit the biggest one.
+    struct Queue
+    {
+        std::mutex          lock;
+        std::vector< Task > tasks;
+        // tasks before this have been stolen from the front.
+        std::size_t head = 0;
+
+        bool empty ( ) const { return head == tasks.size ( ); }
+
+        void pushBack ( Task const &task ) { tasks.push_back ( task ); }
+
+        Task popBack ( )
+        {
+            Task const task = tasks.back ( );
+            tasks.pop_back ( );
+            settle ( );
+            return task;
+        }
+
+        Task popFront ( )
+        {
+            Task const task = tasks [ head++ ];
+            settle ( );
+            return task;
+        }
+
+        void settle ( )
+        {
+            if ( empty ( ) )
+            {
+                tasks.clear ( );
+                head = 0;
+            }
+        }
+    };
+
+    class Pool
+    {
+        // one queue per worker, plus a shared one (the last) for threads that
+        // are not workers.
+        std::vector< std::unique_ptr< Queue > > queues;
+        std::vector< std::thread >              workers;
+
+        std::mutex                 sleepLock;
+        std::condition_variable    wake;
+        std::atomic< std::size_t > queued;
+        bool                       stopping;
+
+        static thread_local Pool       *owner;
+        static thread_local std::size_t index;
+
+        Queue &own ( )
+        {
+            return owner == this ? *queues [ index ] : *queues.back ( );
+        }
+
+        void push ( Queue &queue, Task const &task )
+        {
+            {
+                std::lock_guard< std::mutex > guard ( queue.lock );
+                queue.pushBack ( task );
+            }
+            queued++;
+            if ( !workers.empty ( ) )
+            {
+                // take the lock so a worker between checking queued and
+                // going to sleep cannot miss this.
+                std::lock_guard< std::mutex > guard ( sleepLock );
+                wake.notify_one ( );
+            }
+        }
+
+        bool popBack ( Queue &queue, Task &task )
+        {
+            std::lock_guard< std::mutex > guard ( queue.lock );
+            if ( queue.empty ( ) )
+            {
+                return false;
+            }
+            task = queue.popBack ( );
+            queued--;
+            return true;
+        }
+
+        bool popFront ( Queue &queue, Task &task )
+        {
+            std::lock_guard< std::mutex > guard ( queue.lock );
+            if ( queue.empty ( ) )
+            {
+                return false;
+            }
+            task = queue.popFront ( );
+            queued--;
+            return true;
+        }
+
+        // newest work from our own queue first, then the oldest (and so
+        // biggest) work from everyone else.
+        bool find ( Task &task )
+        {
+            Queue &mine = own ( );
+            if ( popBack ( mine, task ) )
+            {
+                return true;
+            }
+            std::size_t const start = owner == this ? index + 1 : 0;
+            for ( std::size_t i = 0; i < queues.size ( ); i++ )
+            {
+                Queue &other = *queues [ ( start + i ) % queues.size ( ) ];
+                if ( &other != &mine && popFront ( other, task ) )
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void execute ( Task task )
+        {
+            Job &job = *task.job;
+            // keep half of the range for later (or for a thief) until the
+            // piece in hand is small enough.
+            while ( task.last - task.first > job.grain )
+            {
+                std::size_t const middle =
+                        task.first + ( task.last - task.first ) / 2;
+                job.remaining++;
+                push ( own ( ), Task { &job, middle, task.last } );
+                task.last = middle;
+            }
+            try
+            {
+                job.body.call ( job.body.context, task.first, task.last );
+            } catch ( ... )
+            {
+                std::lock_guard< std::mutex > guard ( job.failureLock );
+                if ( !job.failure )
+                {
+                    job.failure = std::current_exception ( );
+                }
+            }
+            // the thread that started the job may be asleep waiting on it.
+            // job may be gone as soon as remaining is zero, so only the
+            // pool is touched after.
+            if ( --job.remaining == 0 )
+            {
+                std::lock_guard< std::mutex > guard ( sleepLock );
+                wake.notify_all ( );
+            }
+        }
+
+        void work ( std::size_t which )
+        {
+            owner = this;
+            index = which;
+            while ( true )
+            {
+                Task task;
+                if ( find ( task ) )
+                {
+                    execute ( task );
+                    continue;
+                }
+                std::unique_lock< std::mutex > guard ( sleepLock );
+                wake.wait ( guard, [ this ] ( ) { return stopping || queued > 0; } );
+                if ( stopping )
+                {
+                    return;
+                }
+            }
+        }
+
+        void start ( std::size_t count )
+        {
+            stopping = false;
+            queued   = 0;
+            queues.clear ( );
+            // the calling thread is one of the count threads.
+            for ( std::size_t i = 0; i < count; i++ )
+            {
+                queues.emplace_back ( new Queue ( ) );
+            }
+            for ( std::size_t i = 0; i + 1 < count; i++ )
+            {
+                workers.emplace_back ( &Pool::work, this, i );
+            }
+        }
+
+        void stop ( )
+        {
+            {
+                std::lock_guard< std::mutex > guard ( sleepLock );
+                stopping = true;
+            }
+            wake.notify_all ( );
+            for ( std::thread &worker : workers ) { worker.join ( ); }
+            workers.clear ( );
+        }
+    public:
+        Pool ( ) { start ( defaultCount ( ) ); }
+
+        static std::size_t defaultCount ( )
+        {
+            std::size_t const hardware = std::thread::hardware_concurrency ( );
+            return hardware ? hardware : 1;
+        }
+
+        std::size_t size ( ) const { return workers.size ( ) + 1; }
+
+        void resize ( std::size_t count )
+        {
+            if ( count == size ( ) )
+            {
+                return;
+            }
+            stop ( );
+            start ( count );
+        }
+
+        void run ( std::size_t      first,
+                   std::size_t      last,
+                   std::size_t      grain,
+                   ml::thread::Body body )
+        {
+            Job job;
+            job.body      = body;
+            job.grain     = grain ? grain : 1;
+            job.remaining = 1;
+            execute ( Task { &job, first, last } );
+            // help out (with this job or any other) until every piece is done,
+            // and sleep while the last pieces run elsewhere.
+            while ( job.remaining > 0 )
+            {
+                Task task;
+                if ( find ( task ) )
+                {
+                    execute ( task );
+                    continue;
+                }
+                std::unique_lock< std::mutex > guard ( sleepLock );
+                wake.wait ( guard, [ & ] ( ) { return job.remaining == 0 || queued > 0; } );
+            }
+            if ( job.failure )
+            {
+                std::rethrow_exception ( job.failure );
+            }
+        }
+    };
+
+    thread_local Pool       *Pool::owner = nullptr;
+    thread_local std::size_t Pool::index = 0;
+
+    // never destroyed: joining the workers from a static destructor can
+    // deadlock, e.g. under the loader lock while a DLL unloads. The workers
+    // sleep until the process ends, unless setThreadCount ( 1 ) joins them
+    // first.
+    Pool &pool ( )
+    {
+        static Pool *const instance = new Pool ( );
+        return *instance;
+    }
+} // namespace
+
+void ml::thread::setThreadCount ( std::size_t count )
+{
+    pool ( ).resize ( count ? count : Pool::defaultCount ( ) );
+}
+
+std::size_t ml::thread::threadCount ( ) NOEXCEPT { return pool ( ).size ( ); }
+
+void ml::thread::parallelFor ( std::size_t first,
+                               std::size_t last,
+                               std::size_t grain,
+                               Body        body )
+{
+    pool ( ).run ( first, last, grain, body );
+}
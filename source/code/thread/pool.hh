@@ -0,0 +1,113 @@
+/**
+ * @file pool.hh
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com)
+ * @brief The threads that ML splits its work across.
+ * @details ML owns one pool of worker threads. Each worker has its own deque
+ * of tasks: it pushes and pops work at the back of its own deque and, when
+ * that runs dry, steals from the front of another worker's deque. A range
+ * handed to parallelFor is split in half lazily, so idle workers steal the
+ * biggest pieces first and busy workers never split more than they need to.
+ * A thread waiting on a parallelFor runs tasks while there are any, which
+ * also makes it safe to call parallelFor from inside of a parallelFor, and
+ * sleeps once the last pieces are running elsewhere.
+ * @version 1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (C) 2022. Intellectual property of the author(s) listed
+ * above.
+ *
+ */
+#pragma once
+
+#include "meta.hh"
+
+#include <cstddef>
+
+namespace ml
+{
+    namespace thread
+    {
+        /**
+         * @brief Sets the number of threads that ML uses, including the
+         * thread that calls into ML. Zero means one per hardware thread.
+         * @note Do not call this while another thread is using ML.
+         * @note The workers are never joined at exit, so that a static
+         * destructor cannot deadlock on them. Setting one thread joins them
+         * all, e.g. before unloading ML as a library.
+         */
+        void setThreadCount ( std::size_t count );
+
+        /**
+         * @brief The number of threads that ML uses, including the thread
+         * that calls into ML.
+         */
+        std::size_t threadCount ( ) NOEXCEPT;
+
+        /**
+         * @brief A borrowed reference to something callable as
+         * body ( begin, end ), which unlike std::function never allocates.
+         */
+        struct Body
+        {
+            void const *context;
+            void ( *call ) ( void const *context, std::size_t, std::size_t );
+        };
+
+        // the pool itself; use the template below instead.
+        void parallelFor ( std::size_t first,
+                           std::size_t last,
+                           std::size_t grain,
+                           Body        body );
+
+        /**
+         * @brief Calls body ( begin, end ) over disjoint pieces of
+         * [ first, last ) that together cover the whole range, possibly on
+         * several threads at once, and returns once every piece is done.
+         * @param grain pieces are never split below this many indices.
+         * @note If any piece throws, one of the exceptions is rethrown here
+         * after the remaining pieces finish.
+         * @note Nothing here allocates, so tight loops of small calls pay
+         * nothing for running in parallel but the check below.
+         */
+        template < class F >
+        void parallelFor ( std::size_t first,
+                           std::size_t last,
+                           std::size_t grain,
+                           F const    &body )
+        {
+            if ( first >= last )
+            {
+                return;
+            }
+            if ( last - first <= grain || threadCount ( ) == 1 )
+            {
+                body ( first, last );
+                return;
+            }
+            struct Call
+            {
+                static void of ( void const *context,
+                                 std::size_t begin,
+                                 std::size_t end )
+                {
+                    ( *static_cast< F const * > ( context ) ) ( begin, end );
+                }
+            };
+            parallelFor ( first, last, grain, Body { &body, &Call::of } );
+        }
+
+        /**
+         * @brief A grain for parallelFor over count indices that each cost
+         * about work operations, so that no piece is too small to be worth
+         * handing to another thread.
+         */
+        inline std::size_t grainFor ( std::size_t count,
+                                      std::size_t work ) NOEXCEPT
+        {
+            // roughly the cost of waking up another thread.
+            std::size_t const minimum = 32 * 1024;
+            std::size_t const grain   = minimum / ( work ? work : 1 );
+            return grain ? ( grain < count ? grain : count ) : 1;
+        }
+    } // namespace thread
+} // namespace ml
@@ -11,7 +11,10 @@
  */
 #include "math/matrix.hh"
 
+#include <cmath>
+#include <iomanip>
 #include <iostream>
+#include <type_traits>
 
 void testVectorMultiplication ( );
 
@@ -21,6 +24,36 @@ void echelonTest ( );
 
 void inverseTest ( );
 
+void storageTest ( );
+
+void blockedMultiplicationTest ( );
+
+void simdTest ( );
+
+void threadTest ( );
+
+void luTest ( );
+
+void viewTest ( );
+
+void expressionTest ( );
+
+void inPlaceTest ( );
+void wrapTest ( );
+void fixedTest ( );
+void batchTest ( );
+void sparseTest ( );
+void choleskyTest ( );
+void qrTest ( );
+void triangularTest ( );
+void eigenTest ( );
+void lowRankTest ( );
+void refineTest ( );
+void doubleDoubleTest ( );
+void rationalTest ( );
+void halfTest ( );
+void quantizedTest ( );
+
 int main ( int const, char const *const *const )
 {
     std::cout << "Compiled for " << __cplusplus << "\n";
@@ -29,6 +62,1415 @@ int main ( int const, char const *const *const )
     echelonTest ( );
 
     inverseTest ( );
+    storageTest ( );
+    blockedMultiplicationTest ( );
+    simdTest ( );
+    threadTest ( );
+    luTest ( );
+    viewTest ( );
+    expressionTest ( );
+    inPlaceTest ( );
+    wrapTest ( );
+    fixedTest ( );
+    batchTest ( );
+    sparseTest ( );
+    choleskyTest ( );
+    qrTest ( );
+    triangularTest ( );
+    eigenTest ( );
+    lowRankTest ( );
+    refineTest ( );
+    doubleDoubleTest ( );
+    rationalTest ( );
+    halfTest ( );
+    quantizedTest ( );
+}
+
+void sparseTest ( )
+{
+    using namespace ml;
+    // a 300 x 200 matrix with about one element in a hundred set, given in
+    // coordinate form with some elements repeated.
+    std::vector< SparseMatrix< Double >::Entry > elements;
+    for ( std::size_t k = 0; k < 1200; k++ )
+    {
+        elements.push_back ( { ( k * 37 ) % 300, ( k * 53 ) % 200, Double ( k % 7 ) - 3 } );
+    }
+    elements.push_back ( elements.front ( ) );
+    SparseMatrix< Double > const rows { 300, 200, elements };
+    SparseMatrix< Double > const cols = rows.compress ( Compressed::Columns );
+    Matrix< Double > const       dense = rows.toMatrix ( );
+
+    Matrix< Double >      b { 200, 9 };
+    std::vector< Double > x ( 200 );
+    for ( std::size_t i = 0; i < 200; i++ )
+    {
+        x [ i ] = Double ( i % 5 ) - 2;
+        for ( std::size_t j = 0; j < 9; j++ ) { b [ i ][ j ] = Double ( ( i + j ) % 4 ); }
+    }
+    Matrix< Double > copy = dense;
+    std::vector< Double > const image   = copy * x;
+    Matrix< Double > const      product = copy * b;
+
+    Double sum = 0;
+    for ( auto const &e : elements )
+    {
+        sum += e.row == 0 && e.col == 0 ? e.value : 0;
+    }
+    std::cout << "Expected: " << sum << " at 0, 0 ("
+              << rows.nonZeroCount ( ) << " nonzeros either way)\n";
+    std::cout << "Actual:   " << rows ( 0, 0 ) << " at 0, 0 (" << cols.nonZeroCount ( )
+              << " nonzeros either way)\n";
+    for ( std::size_t threads : { 1, 4 } )
+    {
+        thread::setThreadCount ( threads );
+        bool const same = rows * x == image && cols * x == image && rows * b == product
+                       && cols * b == product
+                       && SparseMatrix< Double > ( dense, Compressed::Columns ).toMatrix ( )
+                                  == dense
+                       && rows.transpose ( ).toMatrix ( )
+                                  == Matrix< Double > ( dense.view ( ).transpose ( ) );
+        std::cout << "Do CSR and CSC match dense on " << threads << " thread(s)? "
+                  << ( same ? "Yes" : "No" ) << "\n";
+    }
+    thread::setThreadCount ( 0 );
+}
+
+void batchTest ( )
+{
+    using namespace ml;
+    // 1000 diagonally dominant 3 x 3s, but the last is singular.
+    std::size_t const count = 1000;
+    Batch< Double >   a { count, 3, 3 };
+    for ( std::size_t b = 0; b < count; b++ )
+    {
+        for ( std::size_t i = 0; i < 3; i++ )
+        {
+            for ( std::size_t j = 0; j < 3; j++ )
+            {
+                a ( b, i, j ) = Double ( ( b + 1 ) * ( i + 2 ) % ( j + 5 ) )
+                              + ( i == j ? 20 : 0 );
+            }
+        }
+    }
+    a.set ( count - 1, FixedMatrix< Double, 3, 3 > { 1, 2, 3, 2, 4, 6, 0, 1, 1 }.toMatrix ( ) );
+
+    Batch< Double >   inverse { count, 3, 3 };
+    Batch< Double >   product { count, 3, 3 };
+    std::size_t const singular = invert ( a, inverse );
+    gemm< Double > ( 1, a, inverse, 0, product );
+    Double error = 0;
+    for ( std::size_t b = 0; b + 1 < count; b++ )
+    {
+        for ( std::size_t i = 0; i < 3; i++ )
+        {
+            for ( std::size_t j = 0; j < 3; j++ )
+            {
+                error = std::max ( error,
+                                   std::abs ( product ( b, i, j ) - ( i == j ? 1 : 0 ) ) );
+            }
+        }
+    }
+    std::cout << "Expected: 1 singular, A * inverse ( A ) = I for the rest\n";
+    std::cout << "Actual:   " << singular << " singular, A * inverse ( A ) "
+              << ( error < 1e-9 ? "= I" : "!= I" ) << " for the rest\n";
+
+    // a batch product agrees with multiplying the matrices one at a time.
+    FixedMatrix< Double, 3, 3 > const lhs ( a.get ( 7 ) );
+    FixedMatrix< Double, 3, 3 > const rhs ( a.get ( 8 ) );
+    Batch< Double >                   left { 1, 3, 3 }, right { 1, 3, 3 }, out { 1, 3, 3 };
+    left.set ( 0, lhs.toMatrix ( ) );
+    right.set ( 0, rhs.toMatrix ( ) );
+    gemm< Double > ( 1, left, right, 0, out );
+    std::cout << "Does the batch product match? "
+              << ( FixedMatrix< Double, 3, 3 > ( out.get ( 0 ) ) == lhs * rhs ? "Yes" : "No" )
+              << "\n";
+}
+
+void fixedTest ( )
+{
+    using namespace ml;
+#if __cplusplus >= 201402L
+    // everything happens while compiling.
+    constexpr FixedMatrix< Double, 2, 2 > rotation { 0, -1, 1, 0 };
+    static_assert ( ( rotation * rotation * rotation * rotation )
+                            == FixedMatrix< Double, 2, 2 >::identity ( ),
+                    "four quarter turns should be no turn at all" );
+    static_assert ( rotation.inverse ( ) == rotation.transpose ( ),
+                    "a rotation should invert to its transpose" );
+#endif // if __cplusplus >= 201402L
+
+    FixedMatrix< Double, 4, 4 > const a { 2, 0, 0, 1, 0, 3, 0, 0,
+                                          0, 0, 4, 0, 1, 0, 0, 2 };
+    FixedMatrix< Double, 4, 4 > const product = a * a.inverse ( );
+    Double                            error   = 0;
+    for ( std::size_t i = 0; i < 4; i++ )
+    {
+        for ( std::size_t j = 0; j < 4; j++ )
+        {
+            error = std::max ( error,
+                               std::abs ( product ( i, j ) - ( i == j ? 1 : 0 ) ) );
+        }
+    }
+    std::cout << "Expected: det = 36, A * inverse ( A ) = I\n";
+    std::cout << "Actual:   det = " << a.determinant ( ) << ", A * inverse ( A ) "
+              << ( error < 1e-12 ? "= I" : "!= I" ) << "\n";
+
+    // a 2 x 3 times a 3 x 1 is a 2 x 1, and round trips through Matrix.
+    FixedMatrix< Single, 2, 3 > const m { 1, 2, 3, 4, 5, 6 };
+    FixedMatrix< Double, 3, 1 > const x { 1, 0, -1 };
+    auto const                        y = m * x;
+    Matrix< Double > const            dynamic = y.toMatrix ( );
+    std::cout << "Expected: [-2;-2] as Double\n";
+    std::cout << "Actual:   [" << FixedMatrix< Double, 2, 1 > ( dynamic ) ( 0, 0 )
+              << ";" << dynamic [ 1 ][ 0 ] << "]"
+              << ( std::is_same< decltype ( y ), FixedMatrix< Double, 2, 1 > const >::value
+                           ? " as Double"
+                           : " as something else" )
+              << "\n";
+}
+
+void wrapTest ( )
+{
+    using namespace ml;
+    // a 2 x 2 matrix in the left half of a 2 x 3 buffer.
+    Double           buffer [] = { 1, 2, -1, 3, 4, -1 };
+    Matrix< Double > wrapped   = Matrix< Double >::wrap ( buffer, 2, 2, 3 );
+    Matrix< Double > copy      = wrapped;
+
+    wrapped *= 2;
+    copy = copy + copy;
+    wrapped = wrapped - copy * 0.5;
+    std::cout << "Expected: [1,2,-1;3,4,-1] in the buffer\n";
+    std::cout << "Actual:   [" << buffer [ 0 ] << "," << buffer [ 1 ] << ","
+              << buffer [ 2 ] << ";" << buffer [ 3 ] << "," << buffer [ 4 ] << ","
+              << buffer [ 5 ] << "] in the "
+              << ( wrapped.data ( ) == buffer ? "buffer" : "matrix" ) << "\n";
+    std::cout << "Does the copy have its own elements? "
+              << ( copy.data ( ) != buffer && copy [ 1 ][ 1 ] == 8 ? "Yes" : "No" )
+              << "\n";
+
+    // swapping moves both ways, so the buffer changes hands untouched.
+    Double           ones [] = { 1, 1, 1, 1 };
+    Matrix< Double > w       = Matrix< Double >::wrap ( ones, 2, 2, 2 );
+    Matrix< Double > o { 2, 2 };
+    o [ 0 ] = std::vector< Double > { 5, 5 };
+    o [ 1 ] = std::vector< Double > { 5, 5 };
+    std::swap ( w, o );
+    std::cout << "Does swapping with an owned matrix trade the buffer? "
+              << ( o.data ( ) == ones && w.data ( ) != ones && o [ 0 ][ 0 ] == 1
+                                   && w [ 1 ][ 1 ] == 5 && ones [ 3 ] == 1
+                           ? "Yes"
+                           : "No" )
+              << "\n";
+}
+
+void inPlaceTest ( )
+{
+    using namespace ml;
+    Matrix< Double > weights { 2, 2 };
+    Matrix< Double > gradient { 2, 2 };
+    weights [ 0 ]  = std::vector< Double > { 1, 2 };
+    weights [ 1 ]  = std::vector< Double > { 3, 4 };
+    gradient [ 0 ] = std::vector< Double > { 2, 2 };
+    gradient [ 1 ] = std::vector< Double > { 4, 4 };
+    Double const *before = weights.data ( );
+
+    weights.axpy ( -0.5, gradient );
+    weights *= 2;
+    weights += gradient;
+    weights -= gradient * 0.5;
+    weights /= 2;
+    std::cout << "Expected: [0.5,1.5;2,3] without reallocating\n";
+    std::cout << "Actual:   [" << weights [ 0 ][ 0 ] << "," << weights [ 0 ][ 1 ]
+              << ";" << weights [ 1 ][ 0 ] << "," << weights [ 1 ][ 1 ] << "]"
+              << ( weights.data ( ) == before ? " without" : " after" )
+              << " reallocating\n";
+
+    // C = 2 * A * B - C with A = B = [1,2;3,4] and C = I
+    Matrix< Double > product = Matrix< Double >::identity ( 2 );
+    Matrix< Double > a { 2, 2 };
+    a [ 0 ] = std::vector< Double > { 1, 2 };
+    a [ 1 ] = std::vector< Double > { 3, 4 };
+    gemm< Double > ( 2, a, a, -1, product );
+    std::cout << "Expected: [13,20;30,43]\n";
+    std::cout << "Actual:   [" << product [ 0 ][ 0 ] << "," << product [ 0 ][ 1 ]
+              << ";" << product [ 1 ][ 0 ] << "," << product [ 1 ][ 1 ] << "]\n";
+}
+
+void expressionTest ( )
+{
+    using namespace ml;
+    Matrix< Single > a { 2, 2 };
+    Matrix< Double > b { 2, 2 };
+    a [ 0 ] = std::vector< Single > { 1, 2 };
+    a [ 1 ] = std::vector< Single > { 3, 4 };
+    b [ 0 ] = std::vector< Double > { 8, 4 };
+    b [ 1 ] = std::vector< Double > { 0, -4 };
+
+    // Single and Double still promote to Double.
+    auto fused = evaluate ( a * 2 + b / Double { 4 } - 0.5 * a );
+    bool const promoted =
+            std::is_same< decltype ( fused ), Matrix< Double > >::value;
+    std::cout << "Expected: [3.5,4;4.5,5] as Double\n";
+    std::cout << "Actual:   [" << fused [ 0 ][ 0 ] << "," << fused [ 0 ][ 1 ] << ";"
+              << fused [ 1 ][ 0 ] << "," << fused [ 1 ][ 1 ] << "]"
+              << ( promoted ? " as Double" : " as something else" ) << "\n";
+
+    // the destination may appear in its own expression.
+    a = a + a * Single { 2 };
+    std::cout << "Expected: [3,6;9,12]\n";
+    std::cout << "Actual:   [" << a [ 0 ][ 0 ] << "," << a [ 0 ][ 1 ] << ";"
+              << a [ 1 ][ 0 ] << "," << a [ 1 ][ 1 ] << "]\n";
+
+    // sums, differences and scalings of one type run on the kernels a row
+    // at a time, which must keep to the leading dimension of each side.
+    Single buffer [] = { 1, 2, 3, -1, 4, 5, 6, -1 };
+    Matrix< Single > wide = Matrix< Single >::wrap ( buffer, 2, 3, 4 );
+    Matrix< Single > next { 2, 3 };
+    next [ 0 ] = std::vector< Single > { 1, 1, 1 };
+    next [ 1 ] = std::vector< Single > { 2, 2, 2 };
+    Matrix< Single > sum = wide + next, difference = wide - next;
+    wide *= 2;
+    wide /= 4;
+    wide += next;
+    bool const strided = sum [ 1 ][ 2 ] == 8 && difference [ 0 ][ 2 ] == 2
+                      && wide [ 1 ][ 0 ] == 4 && buffer [ 3 ] == -1 && buffer [ 7 ] == -1;
+    std::cout << "Do the kernel sums keep to the leading dimension?"
+              << ( strided ? " Yes" : " No" ) << "\n";
+}
+
+void viewTest ( )
+{
+    using namespace ml;
+    Matrix< Double > whole { 70, 90 };
+    for ( std::size_t i = 0; i < whole.rowCount ( ); i++ )
+    {
+        for ( std::size_t j = 0; j < whole.colCount ( ); j++ )
+        {
+            whole [ i ][ j ] = Double ( ( i * 3 + j * 7 ) % 10 ) - 4;
+        }
+    }
+    // the same block, once as a view and once as a copy.
+    MatrixView< Double const > block = whole.view ( ).block ( 5, 10, 60, 50 );
+    Matrix< Double >           copy { block };
+    Matrix< Double >           copyT { block.transpose ( ) };
+
+    bool passes = copy [ 3 ][ 4 ] == whole [ 8 ][ 14 ]
+               && copyT [ 4 ][ 3 ] == whole [ 8 ][ 14 ]
+               && block.transpose ( ) * block == copyT * copy;
+    std::cout << "Do blocks and transposes match their copies?"
+              << ( passes ? " Yes" : " No" ) << "\n";
+
+    // C^T = B^T * A^T lands in C through a transposed view of it.
+    Matrix< Double > result { 50, 50 };
+    gemm ( 1, copyT.view ( ), copy.view ( ), 0, result.view ( ).transpose ( ) );
+    std::cout << "Does a product into a transposed view match?"
+              << ( result == copyT * copy ? " Yes" : " No" ) << "\n";
+
+    Single                     buffer [] = { 1, 2, 3, 4, 5, 6 };
+    MatrixView< Single const > external { buffer, 2, 3, 3 };
+    Matrix< Single >           gram = external * external.transpose ( );
+    std::cout << "Expected: [14,32;32,77]\n";
+    std::cout << "Actual:   [" << gram [ 0 ][ 0 ] << "," << gram [ 0 ][ 1 ] << ";"
+              << gram [ 1 ][ 0 ] << "," << gram [ 1 ][ 1 ] << "]\n";
+}
+
+void luTest ( )
+{
+    using namespace ml;
+    Matrix< Double > small { 3, 3 };
+    small [ 0 ] = std::vector< Double > { 1, 2, 3 };
+    small [ 1 ] = std::vector< Double > { 4, 5, 6 };
+    small [ 2 ] = std::vector< Double > { 7, 8, 8 };
+    LU< Double > const factors { small };
+    std::vector< Double > const x =
+            factors.solve ( std::vector< Double > { 14, 32, 47 } );
+    std::cout << "Expected: det = 3, x = [1, 2, 3]\n";
+    std::cout << "Actual  : det = " << factors.determinant ( ) << ", x = ["
+              << x [ 0 ] << ", " << x [ 1 ] << ", " << x [ 2 ] << "]\n";
+
+    // several panels wide, with a diagonal big enough that every pivot is
+    // well away from zero.
+    std::size_t const n = 150;
+    Matrix< Double >  big { n, n };
+    Matrix< Double >  rhs { n, 3 };
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        for ( std::size_t j = 0; j < n; j++ )
+        {
+            big [ i ][ j ] = Double ( ( i * 13 + j * 7 ) % 17 ) - 8;
+        }
+        big [ i ][ i ] += Double ( n );
+        for ( std::size_t j = 0; j < 3; j++ )
+        {
+            rhs [ i ][ j ] = Double ( ( i + j ) % 5 );
+        }
+    }
+    LU< Double > const bigFactors { big };
+    Matrix< Double >   residual = big * bigFactors.solve ( rhs ) - rhs;
+    Matrix< Double >   permuted { n, n };
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        permuted [ i ] = big [ bigFactors.permutation ( ) [ i ] ];
+    }
+    Matrix< Double > difference =
+            bigFactors.lower ( ) * bigFactors.upper ( ) - permuted;
+    Double largest = 0;
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        for ( std::size_t j = 0; j < n; j++ )
+        {
+            largest = std::max ( largest, std::abs ( difference [ i ][ j ] ) );
+        }
+        for ( std::size_t j = 0; j < 3; j++ )
+        {
+            largest = std::max ( largest, std::abs ( residual [ i ][ j ] ) );
+        }
+    }
+    std::cout << "Do L * U and A * x match P * A and b?"
+              << ( largest < 1e-9 ? " Yes" : " No" ) << "\n";
+
+    Matrix< Double > singular { 2, 2 };
+    singular [ 0 ] = std::vector< Double > { 1, 2 };
+    singular [ 1 ] = std::vector< Double > { 2, 4 };
+    bool caught    = false;
+    try
+    {
+        singular.inverse ( );
+    } catch ( std::runtime_error const & )
+    {
+        caught = true;
+    }
+    std::cout << "Does inverting a singular matrix throw?"
+              << ( caught ? " Yes" : " No" ) << "\n";
+
+    // rows of very different scales are not singular, and LU must not
+    // mistake their small pivots for zero.
+    Matrix< Double > mixed { 2, 2 }, diagonal { 2, 2 };
+    mixed [ 0 ]    = std::vector< Double > { 1e20, 1e20 };
+    mixed [ 1 ]    = std::vector< Double > { 1, 2 };
+    diagonal [ 0 ] = std::vector< Double > { 1e8, 0 };
+    diagonal [ 1 ] = std::vector< Double > { 0, 1e-8 };
+    Matrix< Double > const undone = mixed.inverse ( );
+    LU< Double > const     scaled { diagonal };
+    diagonal [ 1 ][ 1 ] = std::numeric_limits< Double >::infinity ( );
+    LU< Double > const infinite { diagonal };
+    std::cout << "Expected: [2e-20,-1;-1e-20,1], singular = 0, det = 1, "
+                 "singular with infinity = 1\n";
+    std::cout << "Actual  : [" << undone [ 0 ][ 0 ] << "," << undone [ 0 ][ 1 ] << ";"
+              << undone [ 1 ][ 0 ] << "," << undone [ 1 ][ 1 ]
+              << "], singular = " << scaled.isSingular ( )
+              << ", det = " << scaled.determinant ( )
+              << ", singular with infinity = " << infinite.isSingular ( ) << "\n";
+}
+
+void triangularTest ( )
+{
+    using namespace ml;
+    using kernel::Diagonal;
+    using kernel::Triangle;
+    // a well conditioned triangle a few blocks tall, solved against many
+    // right hand sides in each of the ways that LU, Cholesky, and QR use.
+    std::size_t const n = 150;
+    std::size_t const m = 90;
+    Matrix< Double >  lower { n, n };
+    Matrix< Double >  rhs { n, m };
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        for ( std::size_t j = 0; j < i; j++ )
+        {
+            lower [ i ][ j ] = Double ( ( i * 5 + j * 3 ) % 7 ) / 64 - 0.05;
+        }
+        lower [ i ][ i ] = 2 + Double ( i % 3 );
+        for ( std::size_t j = 0; j < m; j++ )
+        {
+            rhs [ i ][ j ] = Double ( ( i * j + 1 ) % 11 ) - 5;
+        }
+    }
+    Matrix< Double > const upper { lower.view ( ).transpose ( ) };
+    Double                 largest = 0;
+    auto check = [ & ] ( Matrix< Double > const &a,
+                         Triangle                shape,
+                         Diagonal                diagonal,
+                         bool                    transposed ) {
+        Matrix< Double > full = a;
+        if ( diagonal == Diagonal::Unit )
+        {
+            for ( std::size_t i = 0; i < n; i++ ) { full [ i ][ i ] = 1; }
+        }
+        std::size_t const ld  = a.leadingDimension ( );
+        std::size_t const rsa = transposed ? 1 : ld;
+        std::size_t const csa = transposed ? ld : 1;
+        Matrix< Double >  x   = rhs;
+        std::size_t const ldx = x.leadingDimension ( );
+        kernel::trsm (
+                shape, diagonal, n, m, a.data ( ), rsa, csa, x.data ( ), ldx );
+        std::vector< Double > y ( n );
+        for ( std::size_t i = 0; i < n; i++ ) { y [ i ] = rhs [ i ][ 0 ]; }
+        kernel::trsv ( shape, diagonal, n, a.data ( ), rsa, csa, y.data ( ) );
+        Matrix< Double > op { n, n };
+        op.view ( ).assign ( transposed ? full.view ( ).transpose ( )
+                                        : full.view ( ) );
+        Matrix< Double > residual = op * x - rhs;
+        for ( std::size_t i = 0; i < n; i++ )
+        {
+            for ( std::size_t j = 0; j < m; j++ )
+            {
+                largest = std::max ( largest, std::abs ( residual [ i ][ j ] ) );
+            }
+            largest = std::max ( largest, std::abs ( y [ i ] - x [ i ][ 0 ] ) );
+        }
+    };
+    for ( std::size_t threads : { 1, 4 } )
+    {
+        thread::setThreadCount ( threads );
+        check ( lower, Triangle::Lower, Diagonal::General, false );
+        check ( lower, Triangle::Lower, Diagonal::Unit, false );
+        check ( upper, Triangle::Upper, Diagonal::General, false );
+        check ( lower, Triangle::Upper, Diagonal::General, true );
+        check ( upper, Triangle::Lower, Diagonal::Unit, true );
+    }
+    thread::setThreadCount ( 0 );
+    std::cout << "Do triangular solves match their right hand sides?"
+              << ( largest < 1e-9 ? " Yes" : " No" ) << "\n";
+}
+
+void eigenTest ( )
+{
+    using namespace ml;
+    // [2,1,0;1,2,1;0,1,2] has eigenvalues 2 - sqrt(2), 2, and 2 + sqrt(2).
+    Matrix< Double > small { 3, 3 };
+    small [ 0 ] = std::vector< Double > { 2, 1, 0 };
+    small [ 1 ] = std::vector< Double > { 1, 2, 1 };
+    small [ 2 ] = std::vector< Double > { 0, 1, 2 };
+    std::vector< Double > const values =
+            SymmetricEigen< Double > ( small ).eigenvalues ( );
+    std::cout << "Expected: 0.585786 2 3.41421\n";
+    std::cout << "Actual  : " << values [ 0 ] << " " << values [ 1 ] << " "
+              << values [ 2 ] << "\n";
+
+    // big enough to be split and merged several times, and with a repeated
+    // eigenvalue (a multiple of the identity is added to a matrix of rank
+    // 30) so that merging has to deflate.
+    std::size_t const n = 150;
+    Matrix< Double >  low { n, 30 };
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        for ( std::size_t j = 0; j < 30; j++ )
+        {
+            low [ i ][ j ] = std::sin ( Double ( i * i * 31 + j * j * 17 + i * j ) );
+        }
+    }
+    Matrix< Double > symmetric = low.view ( ) * low.view ( ).transpose ( );
+    for ( std::size_t i = 0; i < n; i++ ) { symmetric [ i ][ i ] += 3; }
+    Double largest = 0;
+    for ( std::size_t threads : { 1, 4 } )
+    {
+        thread::setThreadCount ( threads );
+        SymmetricEigen< Double > const eigen { symmetric };
+        Matrix< Double > const        &v  = eigen.eigenvectors ( );
+        Matrix< Double > const         av = symmetric.view ( ) * v.view ( );
+        Matrix< Double > const gram = v.view ( ).transpose ( ) * v.view ( );
+        for ( std::size_t i = 0; i < n; i++ )
+        {
+            for ( std::size_t j = 0; j < n; j++ )
+            {
+                Double const lambda = eigen.eigenvalues ( ) [ j ];
+                largest = std::max ( largest,
+                                     std::abs ( av [ i ][ j ] - v [ i ][ j ] * lambda ) );
+                largest = std::max ( largest,
+                                     std::abs ( gram [ i ][ j ] - Double ( i == j ) ) );
+            }
+        }
+        largest = std::max ( largest, std::abs ( eigen.eigenvalues ( ) [ 0 ] - 3 ) );
+    }
+    std::cout << "Do A * V, V' * V, and the repeated eigenvalue match V * L, I, "
+                 "and 3?"
+              << ( largest < 1e-9 ? " Yes" : " No" ) << "\n";
+
+    // tall, wide, and rank deficient.
+    Matrix< Double > deficient = symmetric;
+    for ( std::size_t i = 0; i < n; i++ ) { deficient [ i ][ i ] -= 3; }
+    std::vector< Matrix< Double > > const shapes {
+            low, Matrix< Double > ( low.view ( ).transpose ( ) ), deficient };
+    largest = 0;
+    for ( std::size_t threads : { 1, 4 } )
+    {
+        thread::setThreadCount ( threads );
+        for ( Matrix< Double > const &a : shapes )
+        {
+            SVD< Double > const svd { a };
+            std::size_t const   k = svd.singularValues ( ).size ( );
+            Matrix< Double >    us = svd.u ( );
+            for ( std::size_t i = 0; i < us.rowCount ( ); i++ )
+            {
+                for ( std::size_t j = 0; j < k; j++ )
+                {
+                    us [ i ][ j ] *= svd.singularValues ( ) [ j ];
+                }
+            }
+            Matrix< Double > const product =
+                    us.view ( ) * svd.v ( ).view ( ).transpose ( );
+            Matrix< Double > const gu =
+                    svd.u ( ).view ( ).transpose ( ) * svd.u ( ).view ( );
+            Matrix< Double > const gv =
+                    svd.v ( ).view ( ).transpose ( ) * svd.v ( ).view ( );
+            for ( std::size_t i = 0; i < a.rowCount ( ); i++ )
+            {
+                for ( std::size_t j = 0; j < a.colCount ( ); j++ )
+                {
+                    Double const error = product [ i ][ j ] - a [ i ][ j ];
+                    largest            = std::max ( largest, std::abs ( error ) );
+                }
+            }
+            for ( std::size_t i = 0; i < k; i++ )
+            {
+                for ( std::size_t j = 0; j < k; j++ )
+                {
+                    largest = std::max ( largest,
+                                         std::abs ( gu [ i ][ j ] - Double ( i == j ) ) );
+                    largest = std::max ( largest,
+                                         std::abs ( gv [ i ][ j ] - Double ( i == j ) ) );
+                }
+            }
+        }
+    }
+    thread::setThreadCount ( 0 );
+    std::cout << "Do U * S * V' match A, and U' * U and V' * V match I, for tall, "
+                 "wide, and rank deficient A?"
+              << ( largest < 1e-9 ? " Yes" : " No" ) << "\n";
+}
+
+void lowRankTest ( )
+{
+    using namespace ml;
+    // 300 x 200 with singular values 2^-k: the leading ones are found to
+    // about the size of the first one dropped.
+    std::size_t const m = 300, n = 200, k = 12;
+    Matrix< Double >  x { m, 40 }, y { n, 40 };
+    for ( std::size_t i = 0; i < m; i++ )
+    {
+        for ( std::size_t j = 0; j < 40; j++ )
+        {
+            x [ i ][ j ] = std::sin ( Double ( 7 * i + 13 * j * j + 1 ) );
+        }
+    }
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        for ( std::size_t j = 0; j < 40; j++ )
+        {
+            y [ i ][ j ] = std::cos ( Double ( 11 * i * j + 5 * i + 3 ) );
+        }
+    }
+    Matrix< Double > const qx = QR< Double > { x }.q ( );
+    Matrix< Double >       qy = QR< Double > { y }.q ( );
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        for ( std::size_t j = 0; j < 40; j++ )
+        {
+            qy [ i ][ j ] *= std::ldexp ( 1.0, -int ( j ) );
+        }
+    }
+    Matrix< Double > const a = qx.view ( ) * qy.view ( ).transpose ( );
+
+    RandomizedSVD< Double > const approximate { a, k };
+    std::cout << "Expected: 1 0.5 0.25 0.000488281\n";
+    std::cout << "Actual  : " << approximate.singularValues ( ) [ 0 ] << " "
+              << approximate.singularValues ( ) [ 1 ] << " "
+              << approximate.singularValues ( ) [ 2 ] << " "
+              << approximate.singularValues ( ) [ k - 1 ] << "\n";
+
+    // the factored product against the dense one, and the dense matrix.
+    FactoredMatrix< Double > const factored = approximate.factored ( );
+    Matrix< Double > const         dense    = factored.toMatrix ( );
+    std::vector< Double >          input ( n );
+    for ( std::size_t j = 0; j < n; j++ ) { input [ j ] = std::sin ( Double ( j ) ); }
+    std::vector< Double > const fast = factored * input;
+    Double                      gap = 0, error = 0;
+    for ( std::size_t i = 0; i < m; i++ )
+    {
+        Double slow = 0;
+        for ( std::size_t j = 0; j < n; j++ )
+        {
+            slow += dense [ i ][ j ] * input [ j ];
+            error = std::max ( error, std::abs ( dense [ i ][ j ] - a [ i ][ j ] ) );
+        }
+        gap = std::max ( gap, std::abs ( slow - fast [ i ] ) );
+    }
+    std::cout << "Is L * ( R * x ) equal to ( L * R ) * x, and L * R within the "
+                 "first dropped singular value of A?"
+              << ( gap < 1e-12 && error < std::ldexp ( 1.0, -int ( k ) ) ? " Yes"
+                                                                         : " No" )
+              << " ( " << factored.rowCount ( ) << " x " << factored.rank ( )
+              << " times " << factored.rank ( ) << " x " << factored.colCount ( )
+              << " )\n";
+}
+
+void refineTest ( )
+{
+    using namespace ml;
+    // well conditioned, with a known solution.
+    std::size_t const n = 300;
+    Matrix< Double >  a { n, n };
+    std::vector< Double > truth ( n );
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        for ( std::size_t j = 0; j < n; j++ )
+        {
+            a [ i ][ j ] = std::sin ( Double ( 3 * i * j + i + 2 * j ) );
+        }
+        a [ i ][ i ] += Double ( n ) / 4;
+        truth [ i ] = std::cos ( Double ( i ) );
+    }
+    std::vector< Double > const b = a * truth;
+    RefinedLU< Single, Double > const refined { a };
+    Refinement< Double > const        result = refined.solve ( b );
+    std::vector< Double > const rough = LU< Single > { Matrix< Single > ( a.view ( ) ) }
+                                                .solve< Double, Double > ( b );
+    Double fine = 0, coarse = 0;
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        fine   = std::max ( fine, std::abs ( result.solution [ i ] - truth [ i ] ) );
+        coarse = std::max ( coarse, std::abs ( rough [ i ] - truth [ i ] ) );
+    }
+    std::cout << "Does refining Single factors reach Double accuracy, where "
+                 "they alone do not?"
+              << ( result.converged && fine < 1e-12 && coarse > 1e-9 ? " Yes"
+                                                                     : " No" )
+              << " ( " << result.iterations << " iterations, error " << fine
+              << " instead of " << coarse << " )\n";
+
+    // the 12 x 12 Hilbert matrix is far too ill-conditioned for Single.
+    Matrix< Double > hilbert { 12, 12 };
+    for ( std::size_t i = 0; i < 12; i++ )
+    {
+        for ( std::size_t j = 0; j < 12; j++ )
+        {
+            hilbert [ i ][ j ] = 1 / Double ( i + j + 1 );
+        }
+    }
+    Refinement< Double > const stuck = RefinedLU< Single, Double > { hilbert }.solve (
+            std::vector< Double > ( 12, 1 ) );
+    std::cout << "Expected: converged = 0\n";
+    std::cout << "Actual  : converged = " << stuck.converged << "\n";
+}
+
+void doubleDoubleTest ( )
+{
+    using namespace ml;
+    std::streamsize const precision = std::cout.precision ( 32 );
+    std::cout << "Expected: 1 / 3 = 3.3333333333333333333333333333333e-01\n";
+    std::cout << "Actual  : 1 / 3 = " << DoubleDouble { 1 } / 3 << "\n";
+    std::cout << "Expected: sqrt ( 2 ) = 1.4142135623730950488016887242097e+00\n";
+    std::cout << "Actual  : sqrt ( 2 ) = " << sqrt ( DoubleDouble { 2 } ) << "\n";
+    std::cout.precision ( precision );
+
+    // the same system as refineTest, but with a solution that Double
+    // cannot hold.
+    std::size_t const          n = 200;
+    Matrix< DoubleDouble >     a { n, n };
+    std::vector< DoubleDouble > truth ( n );
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        for ( std::size_t j = 0; j < n; j++ )
+        {
+            a [ i ][ j ] = std::sin ( Double ( 3 * i * j + i + 2 * j ) );
+        }
+        a [ i ][ i ] += Double ( n ) / 4;
+        truth [ i ] = DoubleDouble { 1 } / Double ( i + 1 );
+    }
+    std::vector< DoubleDouble > const b = a * truth;
+    std::vector< DoubleDouble > const x = LU< DoubleDouble > { a }.solve ( b );
+    DoubleDouble error = 0;
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        error = std::max ( error, abs ( x [ i ] - truth [ i ] ) );
+    }
+    std::cout << "Does LU< DoubleDouble > solve to about 32 digits?"
+              << ( error < 1e-28 ? " Yes" : " No" ) << " ( error "
+              << Double ( error ) << " )\n";
+
+    // the vectorized kernels accumulate in a different order, so they agree
+    // with the generic ones to about the precision, not exactly: elements of
+    // A * A are near 2500, and 1e-25 is about 1e-29 of that.
+    simd::Isa const best = simd::isa ( );
+    simd::select ( simd::Isa::Generic );
+    Matrix< DoubleDouble > const      product = a * a;
+    std::vector< DoubleDouble > const image   = a * truth;
+    simd::Isa const all [] = { simd::Isa::Sse2,
+                               simd::Isa::Avx2,
+                               simd::Isa::Avx512,
+                               simd::Isa::Neon };
+    for ( simd::Isa isa : all )
+    {
+        if ( !simd::select ( isa ) )
+        {
+            continue;
+        }
+        Matrix< DoubleDouble > const      fast   = a * a;
+        std::vector< DoubleDouble > const mapped = a * truth;
+        DoubleDouble                      gap    = 0;
+        for ( std::size_t i = 0; i < n; i++ )
+        {
+            for ( std::size_t j = 0; j < n; j++ )
+            {
+                gap = std::max ( gap, abs ( fast [ i ][ j ] - product [ i ][ j ] ) );
+            }
+            gap = std::max ( gap, abs ( mapped [ i ] - image [ i ] ) );
+        }
+        std::cout << "Do " << simd::name ( isa )
+                  << " DoubleDouble kernels match Generic?"
+                  << ( gap < 1e-25 ? " Yes" : " No" ) << "\n";
+    }
+    simd::select ( best );
+}
+
+void rationalTest ( )
+{
+    using namespace ml;
+    BigInt factorial = 1;
+    for ( int i = 2; i <= 30; i++ ) { factorial *= i; }
+    std::cout << "Expected: 30! = 265252859812191058636308480000000\n";
+    std::cout << "Actual  : 30! = " << factorial << "\n";
+
+    // the inverse from the readme, which Double only gets close to.
+    Matrix< Rational > a { 3, 3 };
+    a [ 0 ] = std::vector< Rational > { 1, 2, 3 };
+    a [ 1 ] = std::vector< Rational > { 4, 5, 6 };
+    a [ 2 ] = std::vector< Rational > { 7, 8, 8 };
+    Matrix< Rational > const inverse = a.inverse ( );
+    std::cout << "Expected: -8/3 8/3 -1 10/3 -13/3 2 -1 2 -1\n";
+    std::cout << "Actual  :";
+    for ( std::size_t i = 0; i < 3; i++ )
+    {
+        for ( std::size_t j = 0; j < 3; j++ ) { std::cout << " " << inverse [ i ][ j ]; }
+    }
+    std::cout << "\n";
+
+    // the 12 x 12 Hilbert matrix, whose inverse has integers of 15 digits
+    // and whose determinant is near 1e-78.
+    std::size_t const  n = 12;
+    Matrix< Rational > hilbert { n, n };
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        for ( std::size_t j = 0; j < n; j++ )
+        {
+            hilbert [ i ][ j ] = Rational ( 1, BigInt ( i + j + 1 ) );
+        }
+    }
+    auto isIdentity = [] ( Matrix< Rational > const &x ) {
+        for ( std::size_t i = 0; i < x.rowCount ( ); i++ )
+        {
+            for ( std::size_t j = 0; j < x.colCount ( ); j++ )
+            {
+                if ( x [ i ][ j ] != Rational ( i == j ) )
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+    Rational const det = determinant ( hilbert );
+    std::cout << "Is A * A.inverse ( ) exactly the identity, for A the readme's "
+                 "matrix and the 12 x 12 Hilbert matrix?"
+              << ( isIdentity ( a * inverse ) && isIdentity ( hilbert * hilbert.inverse ( ) )
+                           ? " Yes"
+                           : " No" )
+              << " ( determinant " << Double ( det ) << " )\n";
+
+    // rank 2 with a column that has no pivot.
+    Matrix< Rational > deficient { 3, 4 };
+    deficient [ 0 ] = std::vector< Rational > { 1, 2, 3, 4 };
+    deficient [ 1 ] = std::vector< Rational > { 2, 4, 6, 9 };
+    deficient [ 2 ] = std::vector< Rational > { Rational ( 1, 2 ), 1, Rational ( 3, 2 ), 7 };
+    Matrix< Rational > const reduced = deficient.echelon ( );
+    std::cout << "Expected: 1 2 3 0 0 0 0 1 0 0 0 0\n";
+    std::cout << "Actual  :";
+    for ( std::size_t i = 0; i < 3; i++ )
+    {
+        for ( std::size_t j = 0; j < 4; j++ ) { std::cout << " " << reduced [ i ][ j ]; }
+    }
+    std::cout << "\n";
+
+    // integers from -100 to 100, whose determinant is far past 64 bits.
+    std::size_t const m = 40;
+    Matrix< BigInt >  integers { m, m };
+    Matrix< Double >  doubles { m, m };
+    for ( std::size_t i = 0; i < m; i++ )
+    {
+        for ( std::size_t j = 0; j < m; j++ )
+        {
+            integers [ i ][ j ] = int ( ( i * 7919 + j * 104729 + i * j * 31 ) % 201 ) - 100;
+            doubles [ i ][ j ]  = Double ( integers [ i ][ j ] );
+        }
+    }
+    BigInt const exact   = determinant ( integers );
+    Double const rounded = LU< Double > { doubles }.determinant ( );
+    std::cout << "Does the exact determinant agree with LU< Double >?"
+              << ( std::abs ( Double ( exact ) - rounded ) < 1e-9 * std::abs ( rounded ) ? " Yes" : " No" )
+              << " ( " << exact.bitLength ( ) << " bits )\n";
+}
+
+void qrTest ( )
+{
+    using namespace ml;
+    // the line through ( 0, 1 ), ( 1, 2 ), ( 2, 2 ), and ( 3, 5 ).
+    Matrix< Double > line { 4, 2 };
+    for ( std::size_t i = 0; i < 4; i++ )
+    {
+        line [ i ] = std::vector< Double > { 1, Double ( i ) };
+    }
+    std::vector< Double > const fit =
+            leastSquares ( line, std::vector< Double > { 1, 2, 2, 5 } );
+    std::cout << "Expected: intercept = 0.7, slope = 1.2\n";
+    std::cout << "Actual  : intercept = " << fit [ 0 ]
+              << ", slope = " << fit [ 1 ] << "\n";
+
+    // tall and several panels wide, with a right hand side that A reaches
+    // exactly, so the fit recovers the coefficients.
+    std::size_t const m = 300;
+    std::size_t const n = 100;
+    Matrix< Double >  tall { m, n };
+    Matrix< Double >  coefficients { n, 2 };
+    for ( std::size_t i = 0; i < m; i++ )
+    {
+        for ( std::size_t j = 0; j < n; j++ )
+        {
+            tall [ i ][ j ] =
+                    std::sin ( Double ( i * i * 31 + j * j * 17 + i * j ) );
+        }
+    }
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        coefficients [ i ] = std::vector< Double > { Double ( i % 7 ), 1 };
+    }
+    Double largest = 0;
+    for ( std::size_t threads : { 1, 4 } )
+    {
+        thread::setThreadCount ( threads );
+        QR< Double > const factors { tall };
+        Matrix< Double > const q          = factors.q ( );
+        Matrix< Double > const difference =
+                q.view ( ) * factors.r ( ).view ( ) - tall;
+        Matrix< Double > const gram = q.view ( ).transpose ( ) * q.view ( );
+        Matrix< Double > const x    = factors.solve ( tall * coefficients );
+        for ( std::size_t i = 0; i < m; i++ )
+        {
+            for ( std::size_t j = 0; j < n; j++ )
+            {
+                largest = std::max ( largest,
+                                     std::abs ( difference [ i ][ j ] ) );
+            }
+        }
+        for ( std::size_t i = 0; i < n; i++ )
+        {
+            for ( std::size_t j = 0; j < n; j++ )
+            {
+                largest = std::max ( largest,
+                                     std::abs ( gram [ i ][ j ]
+                                                - Double ( i == j ) ) );
+            }
+            for ( std::size_t j = 0; j < 2; j++ )
+            {
+                largest = std::max ( largest,
+                                     std::abs ( x [ i ][ j ]
+                                                - coefficients [ i ][ j ] ) );
+            }
+        }
+    }
+    thread::setThreadCount ( 0 );
+    std::cout << "Do Q * R, Q' * Q, and the fit match A, I, and x?"
+              << ( largest < 1e-9 ? " Yes" : " No" ) << "\n";
+
+    bool caught = false;
+    try
+    {
+        Matrix< Double > wide { tall.view ( ).transpose ( ) };
+        QR< Double > ( std::move ( wide ) ).solve ( coefficients );
+    } catch ( std::out_of_range const & )
+    {
+        caught = true;
+    }
+    std::cout << "Does solving with a wide matrix throw?"
+              << ( caught ? " Yes" : " No" ) << "\n";
+}
+
+void choleskyTest ( )
+{
+    using namespace ml;
+    Matrix< Double > small { 3, 3 };
+    small [ 0 ] = std::vector< Double > { 4, 12, -16 };
+    small [ 1 ] = std::vector< Double > { 12, 37, -43 };
+    small [ 2 ] = std::vector< Double > { -16, -43, 98 };
+    Cholesky< Double > const factors { small };
+    Matrix< Double > const   l = factors.lower ( );
+    std::cout << "Expected: diag ( L ) = [2, 1, 3], det = 36\n";
+    std::cout << "Actual  : diag ( L ) = [" << l [ 0 ][ 0 ] << ", "
+              << l [ 1 ][ 1 ] << ", " << l [ 2 ][ 2 ]
+              << "], det = " << factors.determinant ( ) << "\n";
+
+    // A = B * transpose ( B ) + n * I is positive definite, and at several
+    // panels wide exercises the blocked update.
+    std::size_t const n = 150;
+    Matrix< Double >  b { n, n };
+    Matrix< Double >  rhs { n, 3 };
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        for ( std::size_t j = 0; j < n; j++ )
+        {
+            b [ i ][ j ] = Double ( ( i * 13 + j * 7 ) % 17 ) / 8 - 1;
+        }
+        for ( std::size_t j = 0; j < 3; j++ )
+        {
+            rhs [ i ][ j ] = Double ( ( i + j ) % 5 );
+        }
+    }
+    Matrix< Double > big = b.view ( ) * b.view ( ).transpose ( );
+    for ( std::size_t i = 0; i < n; i++ ) { big [ i ][ i ] += Double ( n ); }
+    Double largest = 0;
+    for ( std::size_t threads : { 1, 4 } )
+    {
+        thread::setThreadCount ( threads );
+        Cholesky< Double > const bigFactors { big };
+        Matrix< Double > const   lower = bigFactors.lower ( );
+        Matrix< Double > difference =
+                lower.view ( ) * lower.view ( ).transpose ( ) - big;
+        Matrix< Double > solved   = bigFactors.solve ( rhs );
+        Matrix< Double > residual = big * solved - rhs;
+        Matrix< Double > inverse  = big * bigFactors.inverse ( );
+        std::vector< Double > column ( n );
+        for ( std::size_t i = 0; i < n; i++ ) { column [ i ] = rhs [ i ][ 0 ]; }
+        std::vector< Double > x = bigFactors.solve ( column );
+        for ( std::size_t i = 0; i < n; i++ )
+        {
+            for ( std::size_t j = 0; j < n; j++ )
+            {
+                largest = std::max ( largest,
+                                     std::abs ( difference [ i ][ j ] ) );
+                largest = std::max ( largest,
+                                     std::abs ( inverse [ i ][ j ]
+                                                - Double ( i == j ) ) );
+            }
+            for ( std::size_t j = 0; j < 3; j++ )
+            {
+                largest = std::max ( largest, std::abs ( residual [ i ][ j ] ) );
+            }
+            largest = std::max ( largest, std::abs ( x [ i ] - solved [ i ][ 0 ] ) );
+        }
+    }
+    thread::setThreadCount ( 0 );
+    std::cout << "Do L * L' and A * x match A and b?"
+              << ( largest < 1e-9 ? " Yes" : " No" ) << "\n";
+
+    // symmetric, but its leading 2 x 2 minor is -3.
+    Matrix< Double > indefinite { 3, 3 };
+    indefinite [ 0 ] = std::vector< Double > { 1, 2, 0 };
+    indefinite [ 1 ] = std::vector< Double > { 2, 1, 0 };
+    indefinite [ 2 ] = std::vector< Double > { 0, 0, 1 };
+    Cholesky< Double > const notSpd { indefinite };
+    bool                     caught = false;
+    try
+    {
+        notSpd.inverse ( );
+    } catch ( std::runtime_error const & )
+    {
+        caught = true;
+    }
+    std::cout << "Expected: failed minor = 2, inverse throws\n";
+    std::cout << "Actual  : failed minor = " << notSpd.failedMinor ( )
+              << ", inverse " << ( caught ? "throws" : "does not throw" )
+              << "\n";
+}
+
+void threadTest ( )
+{
+    using namespace ml;
+    // big enough that every operation below actually splits its work.
+    Matrix< Double > lhs { 301, 257 };
+    Matrix< Double > rhs { 257, 199 };
+    std::vector< Double > x ( 257 );
+    for ( std::size_t i = 0; i < 257; i++ )
+    {
+        x [ i ] = Double ( i % 5 ) - 2;
+        for ( std::size_t j = 0; j < 301; j++ )
+        {
+            lhs [ j ][ i ] = Double ( ( i + 2 * j ) % 9 ) - 4;
+        }
+        for ( std::size_t j = 0; j < 199; j++ )
+        {
+            rhs [ i ][ j ] = Double ( ( 3 * i + j ) % 7 ) - 3;
+        }
+    }
+
+    thread::setThreadCount ( 1 );
+    Matrix< Double > const      product = lhs * rhs;
+    Matrix< Double > const      sum     = lhs + lhs * Double { 3 };
+    std::vector< Double > const image   = lhs * x;
+
+    thread::setThreadCount ( 4 );
+    std::cout << "Running on " << thread::threadCount ( ) << " threads\n";
+    bool passes = ( lhs * rhs ) == product
+               && ( lhs + lhs * Double { 3 } ) == sum && ( lhs * x ) == image;
+    std::cout << "Do the threaded operations match the serial ones?"
+              << ( passes ? " Yes" : " No" ) << "\n";
+
+    bool caught = false;
+    try
+    {
+        thread::parallelFor ( 0, 1000, 1, [] ( std::size_t first, std::size_t ) {
+            if ( first == 500 )
+            {
+                throw std::runtime_error ( "Piece failed!" );
+            }
+        } );
+    } catch ( std::runtime_error const & )
+    {
+        caught = true;
+    }
+    std::cout << "Does an exception in a piece reach the caller?"
+              << ( caught ? " Yes" : " No" ) << "\n";
+    thread::setThreadCount ( 0 );
+}
+
+void halfTest ( )
+{
+    using namespace ml;
+    std::cout << "Expected: 65504 inf 5.96046e-08 0.0999756 0.100098\n";
+    std::cout << "Actual  : " << Single ( Half ( 65519.0f ) ) << " "
+              << Single ( Half ( 65520.0f ) ) << " " << Single ( Half ( 3e-8f ) )
+              << " " << Single ( Half ( 0.1f ) ) << " "
+              << Single ( BFloat16 ( 0.1f ) ) << "\n";
+
+    // every finite Half survives the trip through Single.
+    bool exact = true;
+    for ( std::uint32_t bits = 0; bits < 0x10000; bits++ )
+    {
+        Half const h = Half::fromBits ( std::uint16_t ( bits ) );
+        if ( Single ( h ) == Single ( h ) && Half ( h ).bits ( ) != h.bits ( ) )
+        {
+            exact = false;
+        }
+    }
+    std::cout << "Does every Half convert to Single and back exactly?"
+              << ( exact ? " Yes" : " No" ) << "\n";
+
+    // the same values stored in 16 and 32 bits must give the same products,
+    // up to the order of the Single sums.
+    std::size_t const   m = 301, n = 1029;
+    Matrix< Half >      halves { m, n };
+    Matrix< BFloat16 >  bfloat16s { m, n };
+    Matrix< Single >    singles { m, n }, truncated { m, n };
+    std::vector< Single > x ( n );
+    for ( std::size_t j = 0; j < n; j++ )
+    {
+        x [ j ] = std::cos ( Single ( j ) );
+        for ( std::size_t i = 0; i < m; i++ )
+        {
+            Single const value = std::sin ( Single ( 3 * i + 7 * j ) );
+            halves [ i ][ j ]    = Half ( value );
+            bfloat16s [ i ][ j ] = BFloat16 ( value );
+            singles [ i ][ j ]   = halves [ i ][ j ];
+            truncated [ i ][ j ] = bfloat16s [ i ][ j ];
+        }
+    }
+    auto gap = [] ( std::vector< Single > const &a, std::vector< Single > const &b ) {
+        Single largest = 0;
+        for ( std::size_t i = 0; i < a.size ( ); i++ )
+        {
+            largest = std::max ( largest, std::abs ( a [ i ] - b [ i ] ) );
+        }
+        return largest;
+    };
+    std::vector< Single > const image = singles * x, rounded = truncated * x;
+
+    // GEMM widens as it packs, so the product is exactly the same.
+    Matrix< Single > rhs { n, 5 };
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        for ( std::size_t j = 0; j < 5; j++ )
+        {
+            rhs [ i ][ j ] = Single ( ( i + j ) % 3 );
+        }
+    }
+    simd::Isa const best = simd::isa ( );
+    simd::Isa const all [] = { simd::Isa::Generic,
+                               simd::Isa::Sse2,
+                               simd::Isa::Avx2,
+                               simd::Isa::Avx512,
+                               simd::Isa::Neon };
+    for ( simd::Isa isa : all )
+    {
+        if ( !simd::select ( isa ) )
+        {
+            continue;
+        }
+        bool const passes = gap ( halves * x, image ) < 1e-4f
+                         && gap ( bfloat16s * x, rounded ) < 1e-4f
+                         && halves * rhs == singles * rhs;
+        std::cout << "Do " << simd::name ( isa )
+                  << " Half and BFloat16 products match Single?"
+                  << ( passes ? " Yes" : " No" ) << "\n";
+    }
+    simd::select ( best );
+}
+
+void quantizedTest ( )
+{
+    using namespace ml;
+    std::size_t const m = 67, k = 259, n = 45;
+    Matrix< Single >  lhs { m, k }, rhs { k, n };
+    std::vector< Single > x ( k );
+    for ( std::size_t p = 0; p < k; p++ )
+    {
+        x [ p ] = std::cos ( Single ( p ) );
+        for ( std::size_t i = 0; i < m; i++ )
+        {
+            lhs [ i ][ p ] = std::sin ( Single ( 3 * i + 7 * p ) ) * Single ( i + 1 );
+        }
+        for ( std::size_t j = 0; j < n; j++ )
+        {
+            // mostly positive, as after a ReLU.
+            rhs [ p ][ j ] = std::abs ( std::sin ( Single ( 5 * p + j ) ) ) - 0.1f;
+        }
+    }
+
+    // each element is within half a step of what it stands for.
+    QuantizedMatrix const a { lhs };
+    QuantizedMatrix const b { rhs, Quantization::Asymmetric, Scales::Columns };
+    bool                  close = true;
+    for ( std::size_t i = 0; i < m; i++ )
+    {
+        for ( std::size_t p = 0; p < k; p++ )
+        {
+            close = close && std::abs ( a ( i, p ) - lhs [ i ][ p ] )
+                                     <= 0.5001f * a.scales ( ) [ i ];
+        }
+    }
+    for ( std::size_t p = 0; p < k; p++ )
+    {
+        for ( std::size_t j = 0; j < n; j++ )
+        {
+            close = close && std::abs ( b ( p, j ) - rhs [ p ][ j ] )
+                                     <= 0.5001f * b.scales ( ) [ j ];
+        }
+    }
+    std::cout << "Is every quantized element within half a step?"
+              << ( close ? " Yes" : " No" ) << "\n";
+
+    bool thrown = false;
+    try
+    {
+        QuantizedMatrix const byColumns { lhs, Quantization::Symmetric, Scales::Columns };
+        byColumns * b;
+    }
+    catch ( std::invalid_argument const & )
+    {
+        thrown = true;
+    }
+    std::cout << "Does a scale per column of the left side throw?"
+              << ( thrown ? " Yes" : " No" ) << "\n";
+
+    // the integer products are exact, so every kernel must agree with the
+    // generic one, and the dequantized results must be as close to those
+    // of the dequantized matrices as the rounding of x and the sums allow.
+    std::vector< std::int8_t > qa ( m * k ), qb ( n * k );
+    for ( std::size_t p = 0; p < m * k; p++ )
+    {
+        qa [ p ] = std::int8_t ( int ( p * 37 % 255 ) - 127 );
+    }
+    for ( std::size_t p = 0; p < n * k; p++ )
+    {
+        qb [ p ] = std::int8_t ( int ( p * 91 % 255 ) - 127 );
+    }
+    std::vector< std::int32_t > exact ( m * n ), sums ( m * n );
+    simd::genericBytes ( ).gemm ( m, n, k, qa.data ( ), k, qb.data ( ), k,
+                                  exact.data ( ), n );
+
+    // x is rounded to steps of its largest magnitude / 127, which moves
+    // each row's product by at most half a step times the row's 1-norm.
+    Matrix< Single > const      product = a.toMatrix ( ) * b.toMatrix ( );
+    std::vector< Single > const image   = a.toMatrix ( ) * x;
+    Single                      top = 0, step = 0;
+    std::vector< Single >       reach ( m, 0 );
+    for ( std::size_t p = 0; p < k; p++ )
+    {
+        step = std::max ( step, std::abs ( x [ p ] ) / 127 );
+    }
+    for ( std::size_t i = 0; i < m; i++ )
+    {
+        for ( std::size_t p = 0; p < k; p++ )
+        {
+            reach [ i ] += 0.5f * step * std::abs ( a ( i, p ) );
+        }
+        for ( std::size_t j = 0; j < n; j++ )
+        {
+            top = std::max ( top, std::abs ( product [ i ][ j ] ) );
+        }
+    }
+    simd::Isa const best = simd::isa ( );
+    simd::Isa const all [] = { simd::Isa::Generic,
+                               simd::Isa::Sse2,
+                               simd::Isa::Avx2,
+                               simd::Isa::Avx512,
+                               simd::Isa::Neon };
+    for ( simd::Isa isa : all )
+    {
+        if ( !simd::select ( isa ) )
+        {
+            continue;
+        }
+        simd::bytes ( ).gemm ( m, n, k, qa.data ( ), k, qb.data ( ), k,
+                               sums.data ( ), n );
+        Matrix< Single > const      c = a * b;
+        std::vector< Single > const y = a * x;
+        Single                      gap = 0;
+        bool                        within = true;
+        for ( std::size_t i = 0; i < m; i++ )
+        {
+            within = within && std::abs ( y [ i ] - image [ i ] ) <= 1.01f * reach [ i ];
+            for ( std::size_t j = 0; j < n; j++ )
+            {
+                gap = std::max ( gap, std::abs ( c [ i ][ j ] - product [ i ][ j ] ) );
+            }
+        }
+        bool const passes = sums == exact && gap <= 1e-5f * top && within;
+        std::cout << "Do " << simd::name ( isa )
+                  << " quantized products match the dequantized ones?"
+                  << ( passes ? " Yes" : " No" ) << "\n";
+    }
+    simd::select ( best );
+}
+
+void simdTest ( )
+{
+    using namespace ml;
+    simd::Isa const best = simd::isa ( );
+    std::cout << "Kernels picked for this processor: " << simd::name ( best )
+              << "\n";
+
+    // small integers keep every kernel exact, so all of them must agree.
+    Matrix< Single > lhs { 53, 71 };
+    Matrix< Single > rhs { 71, 45 };
+    std::vector< Single > x ( 71 );
+    for ( std::size_t i = 0; i < 71; i++ )
+    {
+        x [ i ] = Single ( i % 5 ) - 2;
+        for ( std::size_t j = 0; j < 53; j++ )
+        {
+            lhs [ j ][ i ] = Single ( ( i + 2 * j ) % 9 ) - 4;
+        }
+        for ( std::size_t j = 0; j < 45; j++ )
+        {
+            rhs [ i ][ j ] = Single ( ( 3 * i + j ) % 7 ) - 3;
+        }
+    }
+
+    // 37 3 x 3s that need a row swap and invert exactly, powers of two on
+    // an anti-diagonal.
+    Batch< Single > small { 37, 3, 3 };
+    for ( std::size_t b = 0; b < 37; b++ )
+    {
+        for ( std::size_t i = 0; i < 3; i++ )
+        {
+            small ( b, i, 2 - i ) = Single ( 1 << ( ( b + i ) % 4 ) );
+        }
+    }
+    auto batched = [ & ] ( ) {
+        Batch< Single > inverse { 37, 3, 3 }, product { 37, 3, 3 };
+        invert ( small, inverse );
+        gemm< Single > ( 1, small, small, 0, product );
+        std::vector< Matrix< Single > > out;
+        for ( std::size_t b = 0; b < 37; b++ )
+        {
+            out.push_back ( inverse.get ( b ) );
+            out.push_back ( product.get ( b ) );
+        }
+        return out;
+    };
+
+    simd::select ( simd::Isa::Generic );
+    Matrix< Single > const    product = lhs * rhs;
+    Matrix< Single > const    sum     = lhs + lhs * Single { 3 };
+    std::vector< Single > const image = lhs * x;
+    std::vector< Matrix< Single > > const batch = batched ( );
+
+    simd::Isa const all [] = { simd::Isa::Sse2,
+                               simd::Isa::Avx2,
+                               simd::Isa::Avx512,
+                               simd::Isa::Neon };
+    for ( simd::Isa isa : all )
+    {
+        if ( !simd::select ( isa ) )
+        {
+            continue;
+        }
+        bool passes = ( lhs * rhs ) == product
+                   && ( lhs + lhs * Single { 3 } ) == sum && ( lhs * x ) == image
+                   && batched ( ) == batch;
+        std::cout << "Does " << simd::name ( isa ) << " match Generic?"
+                  << ( passes ? " Yes" : " No" ) << "\n";
+    }
+    simd::select ( best );
+}
+
+void blockedMultiplicationTest ( )
+{
+    using namespace ml;
+    // large enough to go through the packed kernel, odd enough to leave
+    // partial tiles on every edge.
+    Matrix< Double > lhs { 131, 97 };
+    Matrix< Single > rhs { 97, 67 };
+    Matrix< Double > expect { 131, 67 };
+    for ( std::size_t i = 0; i < lhs.rowCount ( ); i++ )
+    {
+        for ( std::size_t j = 0; j < lhs.colCount ( ); j++ )
+        {
+            lhs [ i ][ j ] = Double ( ( i * 7 + j * 3 ) % 11 ) - 5;
+        }
+    }
+    for ( std::size_t i = 0; i < rhs.rowCount ( ); i++ )
+    {
+        for ( std::size_t j = 0; j < rhs.colCount ( ); j++ )
+        {
+            rhs [ i ][ j ] = Single ( ( i * 5 + j * 2 ) % 7 ) - 3;
+        }
+    }
+    for ( std::size_t i = 0; i < expect.rowCount ( ); i++ )
+    {
+        for ( std::size_t j = 0; j < expect.colCount ( ); j++ )
+        {
+            for ( std::size_t k = 0; k < lhs.colCount ( ); k++ )
+            {
+                expect [ i ][ j ] += lhs [ i ][ k ] * rhs [ k ][ j ];
+            }
+        }
+    }
+    std::cout << "Does the blocked product match the naive one?";
+    std::cout << ( ( lhs * rhs ) == expect ? " Yes" : " No" ) << "\n";
+}
+
+void storageTest ( )
+{
+    using namespace ml;
+    Matrix< Double > test { 3, 4 };
+    test [ 0 ] = std::vector< Double > { 1, 2, 3, 4 };
+    test [ 1 ] = std::vector< Double > { 5, 6, 7, 8 };
+    test [ 2 ] = test [ 0 ];
+    test.swapRows ( 0, 1 );
+
+    std::cout << "Expected: [5,6,7,8;1,2,3,4;1,2,3,4]\n";
+    std::cout << "Actual:   [";
+    for ( std::size_t r = 0; r < test.rowCount ( ); r++ )
+    {
+        Double const *row = test.data ( ) + r * test.leadingDimension ( );
+        for ( std::size_t c = 0; c < test.colCount ( ); c++ )
+        {
+            std::cout << row [ c ] << ( c + 1 < test.colCount ( ) ? "," : "" );
+        }
+        std::cout << ( r + 1 < test.rowCount ( ) ? ";" : "]\n" );
+    }
 }
 
 void inverseTest ( )
@@ -125,6 +1567,55 @@ void echelonTest ( )
               << result [ 1 ][ 2 ] << "," << result [ 1 ][ 3 ] << ";";
     std::cout << result [ 2 ][ 0 ] << "," << result [ 2 ][ 1 ] << ","
               << result [ 2 ][ 2 ] << "," << result [ 2 ][ 3 ] << "]\n";
+
+    // big enough to split elimination across threads, with a zero column
+    // and a repeated row so that the rank is short of both dimensions.
+    std::size_t const n = 120;
+    test                = Matrix< Double > { n, n + 1 };
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        for ( std::size_t j = 1; j <= n; j++ )
+        {
+            test [ i ][ j ] = Double ( ( i * 5 + j * 11 ) % 13 ) - 6;
+        }
+        test [ i ][ i < n - 1 ? i + 1 : 1 ] += Double ( n );
+    }
+    test [ n - 1 ] = test [ 0 ];
+    result         = test.echelon ( );
+    bool reduced   = true;
+    for ( std::size_t i = 0; i < n; i++ )
+    {
+        for ( std::size_t j = 0; j <= n; j++ )
+        {
+            Double const expect = i < n - 1 && j == i + 1 ? 1 : 0;
+            bool const   free   = j == n && i < n - 1;
+            if ( !free && result [ i ][ j ] != expect )
+            {
+                reduced = false;
+            }
+        }
+    }
+    std::cout << "Is the " << n << "x" << n + 1
+              << " system in reduced row echelon form?"
+              << ( reduced ? " Yes" : " No" ) << "\n";
+
+    // the tolerance follows each row's own scale, so huge and mixed
+    // magnitudes still reduce to the identity.
+    Matrix< Double > huge { 2, 2 }, mixed { 2, 2 };
+    huge [ 0 ]  = std::vector< Double > { 1e16, 0 };
+    huge [ 1 ]  = std::vector< Double > { 0, 1e16 };
+    mixed [ 0 ] = std::vector< Double > { 1e20, 1e20 };
+    mixed [ 1 ] = std::vector< Double > { 1, 2 };
+    Matrix< Single > large { 2, 2 };
+    large [ 0 ] = std::vector< Single > { 1e7f, 0 };
+    large [ 1 ] = std::vector< Single > { 0, 1e7f };
+    Matrix< Double > const identity = Matrix< Double >::identity ( 2 );
+    std::cout << "Do 1e16 * I, 1e7 * I in Single, and [1e20,1e20;1,2] reduce to I?"
+              << ( huge.echelon ( ) == identity && mixed.echelon ( ) == identity
+                                   && large.echelon ( ) == Matrix< Single >::identity ( 2 )
+                           ? " Yes"
+                           : " No" )
+              << "\n";
 }
 
 void testMatrixMultiplication ( )
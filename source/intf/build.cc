@@ -13,6 +13,7 @@
 
 #undef __IMPORT__
 #include "code/math/matrix.hh"
+#include "code/thread/pool.hh"
 #include "meta.hh"
 #include "ml.hh"
 
@@ -21,6 +22,35 @@
 template class ml::Matrix< Single >;
 template class ml::Matrix< Double >;
 template class ml::Matrix< Triple >;
+template class ml::LU< Single >;
+template class ml::LU< Double >;
+template class ml::LU< Triple >;
+template class ml::QR< Single >;
+template class ml::QR< Double >;
+template class ml::QR< Triple >;
+template class ml::Cholesky< Single >;
+template class ml::Cholesky< Double >;
+template class ml::Cholesky< Triple >;
+template class ml::SymmetricEigen< Single >;
+template class ml::SymmetricEigen< Double >;
+template class ml::SymmetricEigen< Triple >;
+template class ml::SVD< Single >;
+template class ml::SVD< Double >;
+template class ml::SVD< Triple >;
+template class ml::RandomizedSVD< Single >;
+template class ml::RandomizedSVD< Double >;
+template class ml::RandomizedSVD< Triple >;
+template class ml::FactoredMatrix< Single >;
+template class ml::FactoredMatrix< Double >;
+template class ml::FactoredMatrix< Triple >;
+template class ml::RefinedLU< Single, Double >;
+template class ml::RefinedLU< Single, Triple >;
+template class ml::Batch< Single >;
+template class ml::Batch< Double >;
+template class ml::Batch< Triple >;
+template class ml::SparseMatrix< Single >;
+template class ml::SparseMatrix< Double >;
+template class ml::SparseMatrix< Triple >;
 
 template < CONCEPT_NAMESPACE Floating V >
 ml::Matrix< V > *asMatrix ( void *matrix )
@@ -81,7 +111,7 @@ int getIndexAlgorithm ( void                  *pMatrix,
 {
     try
     {
-        *x = ( *asMatrix< V > ( pMatrix ) ) [ row ][ col ];
+        *x = ( *asMatrix< V > ( pMatrix ) ) [ row ].at ( col );
         return 0;
     } catch ( ... )
     {
@@ -98,7 +128,7 @@ int setIndexAlgorithm ( void                  *pMatrix,
 {
     try
     {
-        ( *asMatrix< V > ( pMatrix ) ) [ row ][ col ] = x;
+        ( *asMatrix< V > ( pMatrix ) ) [ row ].at ( col ) = x;
         return 0;
     } catch ( ... )
     {
@@ -118,6 +148,70 @@ void moveMatrixAlgorithm ( void *lhs, void *rhs )
     *asMatrix< V > ( lhs ) = std::move ( *asMatrix< V > ( rhs ) );
 }
 
+template < CONCEPT_NAMESPACE Floating V >
+bool hasShape ( ml::Matrix< V > const *matrix,
+                std::size_t            rows,
+                std::size_t            cols )
+{
+    return matrix->rowCount ( ) == rows && matrix->colCount ( ) == cols;
+}
+
+// The ...Into algorithms write into a destination the caller has already
+// constructed with the right shape, so they allocate nothing. The others
+// construct the destination at the right shape and then do the same.
+
+template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
+int addIntoMatrixAndMatrixAlgorithm ( void *dst, void *lhs, void *rhs )
+{
+    ml::Matrix< V > *plhs = asMatrix< V > ( lhs );
+    ml::Matrix< W > *prhs = asMatrix< W > ( rhs );
+    ml::Matrix< decltype ( V { 0 } + W { 0 } ) > *pdst =
+            asMatrix< decltype ( V { 0 } + W { 0 } ) > ( dst );
+    if ( !hasShape ( prhs, plhs->rowCount ( ), plhs->colCount ( ) )
+         || !hasShape ( pdst, plhs->rowCount ( ), plhs->colCount ( ) ) )
+    {
+        return -1;
+    }
+    // the shapes match, so this evaluates straight into the elements of dst.
+    *pdst = *plhs + *prhs;
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
+int subIntoMatrixAndMatrixAlgorithm ( void *dst, void *lhs, void *rhs )
+{
+    ml::Matrix< V > *plhs = asMatrix< V > ( lhs );
+    ml::Matrix< W > *prhs = asMatrix< W > ( rhs );
+    ml::Matrix< decltype ( V { 0 } + W { 0 } ) > *pdst =
+            asMatrix< decltype ( V { 0 } + W { 0 } ) > ( dst );
+    if ( !hasShape ( prhs, plhs->rowCount ( ), plhs->colCount ( ) )
+         || !hasShape ( pdst, plhs->rowCount ( ), plhs->colCount ( ) ) )
+    {
+        return -1;
+    }
+    *pdst = *plhs - *prhs;
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
+int mulIntoMatrixAndMatrixAlgorithm ( void *dst, void *lhs, void *rhs )
+{
+    ml::Matrix< V > *plhs = asMatrix< V > ( lhs );
+    ml::Matrix< W > *prhs = asMatrix< W > ( rhs );
+    ml::Matrix< decltype ( V { 0 } + W { 0 } ) > *pdst =
+            asMatrix< decltype ( V { 0 } + W { 0 } ) > ( dst );
+    // the product reads lhs and rhs while it writes dst, so dst cannot be
+    // either of them.
+    if ( plhs->colCount ( ) != prhs->rowCount ( )
+         || !hasShape ( pdst, plhs->rowCount ( ), prhs->colCount ( ) )
+         || dst == lhs || dst == rhs )
+    {
+        return -1;
+    }
+    ml::gemm< decltype ( V { 0 } + W { 0 } ) > ( 1, *plhs, *prhs, 0, *pdst );
+    return 0;
+}
+
 template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
 int addMatrixAndMatrixAlgorithm ( void *dst, void *lhs, void *rhs )
 {
@@ -127,17 +221,12 @@ int addMatrixAndMatrixAlgorithm ( void *dst, void *lhs, void *rhs )
          || plhs->colCount ( ) != prhs->colCount ( ) )
     {
         return -1;
-    } else
-    {
-        constructMatrixAlgorithm< decltype ( V { 0 } + W { 0 } ) > (
-                dst,
-                plhs->rowCount ( ),
-                prhs->rowCount ( ) );
-        ml::Matrix< decltype ( V { 0 } + W { 0 } ) > *pdst =
-                asMatrix< decltype ( V { 0 } + W { 0 } ) > ( dst );
-        *pdst = *plhs + *prhs;
-        return 0;
     }
+    constructMatrixAlgorithm< decltype ( V { 0 } + W { 0 } ) > (
+            dst,
+            plhs->rowCount ( ),
+            plhs->colCount ( ) );
+    return addIntoMatrixAndMatrixAlgorithm< V, W > ( dst, lhs, rhs );
 }
 
 template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
@@ -149,17 +238,12 @@ int subMatrixAndMatrixAlgorithm ( void *dst, void *lhs, void *rhs )
          || plhs->colCount ( ) != prhs->colCount ( ) )
     {
         return -1;
-    } else
-    {
-        constructMatrixAlgorithm< decltype ( V { 0 } + W { 0 } ) > (
-                dst,
-                plhs->rowCount ( ),
-                prhs->rowCount ( ) );
-        ml::Matrix< decltype ( V { 0 } + W { 0 } ) > *pdst =
-                asMatrix< decltype ( V { 0 } + W { 0 } ) > ( dst );
-        *pdst = *plhs - *prhs;
-        return 0;
     }
+    constructMatrixAlgorithm< decltype ( V { 0 } + W { 0 } ) > (
+            dst,
+            plhs->rowCount ( ),
+            plhs->colCount ( ) );
+    return subIntoMatrixAndMatrixAlgorithm< V, W > ( dst, lhs, rhs );
 }
 
 template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
@@ -167,21 +251,15 @@ int mulMatrixAndMatrixAlgorithm ( void *dst, void *lhs, void *rhs )
 {
     ml::Matrix< V > *plhs = asMatrix< V > ( lhs );
     ml::Matrix< W > *prhs = asMatrix< W > ( rhs );
-    if ( plhs->rowCount ( ) != prhs->colCount ( )
-         || plhs->colCount ( ) != prhs->rowCount ( ) )
+    if ( plhs->colCount ( ) != prhs->rowCount ( ) )
     {
         return -1;
-    } else
-    {
-        constructMatrixAlgorithm< decltype ( V { 0 } + W { 0 } ) > (
-                dst,
-                plhs->rowCount ( ),
-                prhs->colCount ( ) );
-        ml::Matrix< decltype ( V { 0 } + W { 0 } ) > *pdst =
-                asMatrix< decltype ( V { 0 } + W { 0 } ) > ( dst );
-        *pdst = *plhs * *prhs;
-        return 0;
     }
+    constructMatrixAlgorithm< decltype ( V { 0 } + W { 0 } ) > (
+            dst,
+            plhs->rowCount ( ),
+            prhs->colCount ( ) );
+    return mulIntoMatrixAndMatrixAlgorithm< V, W > ( dst, lhs, rhs );
 }
 
 template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
@@ -194,21 +272,69 @@ int evalMatrixAndVectorAlgorithm ( decltype ( V { 0 } + W { 0 } ) * dst,
     if ( psrc->colCount ( ) != len )
     {
         return -1;
-    } else
-    {
-        std::vector< W > values;
-        for ( unsigned long long int i = 0; i < len; i++ )
-        {
-            values.push_back ( vec [ i ] );
-        }
+    }
+    ml::gemv< decltype ( V { 0 } + W { 0 } ) > ( 1, *psrc, vec, 0, dst );
+    return 0;
+}
 
-        auto temp = *psrc * values;
-        for ( unsigned long long int i = 0; i < psrc->colCount ( ); i++ )
+template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
+int evalBatchMatrixAndVectorAlgorithm ( decltype ( V { 0 } + W { 0 } ) * dst,
+                                        void                  *src,
+                                        unsigned long long int count,
+                                        unsigned long long int len,
+                                        W                     *vecs )
+{
+    using X               = decltype ( V { 0 } + W { 0 } );
+    ml::Matrix< V > *psrc = asMatrix< V > ( src );
+    std::size_t const rows = psrc->rowCount ( );
+    if ( psrc->colCount ( ) != len )
+    {
+        return -1;
+    }
+    if ( !ml::kernel::worthBlocking ( count, rows, len ) )
+    {
+        for ( std::size_t i = 0; i < count; i++ )
         {
-            dst [ i ] = temp [ i ];
+            ml::gemv< X > ( 1, *psrc, vecs + i * len, 0, dst + i * rows );
         }
         return 0;
     }
+    // the vectors are the rows of one matrix, so every result at once is
+    // that matrix times the transpose of src, which is a single GEMM.
+    ml::gemm< X > ( 1,
+                    ml::MatrixView< W const > { vecs, count, len, len },
+                    psrc->view ( ).transpose ( ),
+                    0,
+                    ml::MatrixView< X > { dst, count, rows, rows } );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
+int mulIntoMatrixAndScalarAlgorithm ( void *dst, void *src, W scalar )
+{
+    ml::Matrix< V > *psrc = asMatrix< V > ( src );
+    ml::Matrix< decltype ( V { 0 } + W { 0 } ) > *pdst =
+            asMatrix< decltype ( V { 0 } + W { 0 } ) > ( dst );
+    if ( !hasShape ( pdst, psrc->rowCount ( ), psrc->colCount ( ) ) )
+    {
+        return -1;
+    }
+    *pdst = *psrc * scalar;
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
+int divIntoMatrixAndScalarAlgorithm ( void *dst, void *src, W scalar )
+{
+    ml::Matrix< V > *psrc = asMatrix< V > ( src );
+    ml::Matrix< decltype ( V { 0 } + W { 0 } ) > *pdst =
+            asMatrix< decltype ( V { 0 } + W { 0 } ) > ( dst );
+    if ( !hasShape ( pdst, psrc->rowCount ( ), psrc->colCount ( ) ) )
+    {
+        return -1;
+    }
+    *pdst = *psrc / scalar;
+    return 0;
 }
 
 template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
@@ -219,75 +345,794 @@ void mulMatrixAndScalarAlgorithm ( void *dst, void *src, W scalar )
             dst,
             psrc->rowCount ( ),
             psrc->colCount ( ) );
-    ml::Matrix< decltype ( V { 0 } + W { 0 } ) > *pdst =
-            asMatrix< decltype ( V { 0 } + W { 0 } ) > ( dst );
+    mulIntoMatrixAndScalarAlgorithm< V, W > ( dst, src, scalar );
+}
+
+template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
+void divMatrixAndScalarAlgorithm ( void *dst, void *src, W scalar )
+{
+    ml::Matrix< V > *psrc = asMatrix< V > ( src );
+    constructMatrixAlgorithm< decltype ( V { 0 } + W { 0 } ) > (
+            dst,
+            psrc->rowCount ( ),
+            psrc->colCount ( ) );
+    divIntoMatrixAndScalarAlgorithm< V, W > ( dst, src, scalar );
+}
+
+template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
+int augmentIntoMatrixAndMatrixAlgorithm ( void *aug, void *lhs, void *rhs )
+{
+    ml::Matrix< V > *plhs = asMatrix< V > ( lhs );
+    ml::Matrix< W > *prhs = asMatrix< W > ( rhs );
+    ml::Matrix< decltype ( V { 0 } + W { 0 } ) > *paug =
+            asMatrix< decltype ( V { 0 } + W { 0 } ) > ( aug );
+    std::size_t const rows = plhs->rowCount ( );
+    if ( prhs->rowCount ( ) != rows
+         || !hasShape ( paug, rows, plhs->colCount ( ) + prhs->colCount ( ) )
+         || aug == lhs || aug == rhs )
+    {
+        return -1;
+    }
+    paug->view ( ).block ( 0, 0, rows, plhs->colCount ( ) ).assign ( plhs->view ( ) );
+    paug->view ( )
+            .block ( 0, plhs->colCount ( ), rows, prhs->colCount ( ) )
+            .assign ( prhs->view ( ) );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
+int augmentMatrixAndMatrixAlgorithm ( void *aug, void *lhs, void *rhs )
+{
+    ml::Matrix< V > *plhs = asMatrix< V > ( lhs );
+    ml::Matrix< W > *prhs = asMatrix< W > ( rhs );
+    if ( plhs->rowCount ( ) != prhs->rowCount ( ) )
+    {
+        return -1;
+    }
+    constructMatrixAlgorithm< decltype ( V { 0 } + W { 0 } ) > (
+            aug,
+            plhs->rowCount ( ),
+            plhs->colCount ( ) + prhs->colCount ( ) );
+    return augmentIntoMatrixAndMatrixAlgorithm< V, W > ( aug, lhs, rhs );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int echelonIntoAlgorithm ( void *res, void *mat )
+{
+    ml::Matrix< V > *pmat = asMatrix< V > ( mat );
+    ml::Matrix< V > *pres = asMatrix< V > ( res );
+    if ( !hasShape ( pres, pmat->rowCount ( ), pmat->colCount ( ) ) )
+    {
+        return -1;
+    }
+    if ( pres != pmat )
+    {
+        pres->view ( ).assign ( pmat->view ( ) );
+    }
+    pres->echelonInPlace ( );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void echelonAlgorithm ( void *res, void *mat )
+{
+    ml::Matrix< V > *pmat = asMatrix< V > ( mat );
+    constructMatrixAlgorithm< V > ( res,
+                                    pmat->rowCount ( ),
+                                    pmat->colCount ( ) );
+    echelonIntoAlgorithm< V > ( res, mat );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int inverseAlgorithm ( void *res, void *mat )
+{
+    ml::Matrix< V > *pmat = asMatrix< V > ( mat );
+    try
+    {
+        new ( res ) ml::Matrix< V > ( pmat->inverse ( ) );
+        return 0;
+    } catch ( ... )
+    {
+        return -1;
+    }
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+bool sameShape ( void *lhs, void *rhs )
+{
+    return asMatrix< V > ( lhs )->rowCount ( ) == asMatrix< V > ( rhs )->rowCount ( )
+        && asMatrix< V > ( lhs )->colCount ( ) == asMatrix< V > ( rhs )->colCount ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int addAssignAlgorithm ( void *dst, void *src )
+{
+    if ( !sameShape< V > ( dst, src ) )
+    {
+        return -1;
+    }
+    *asMatrix< V > ( dst ) += *asMatrix< V > ( src );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int subAssignAlgorithm ( void *dst, void *src )
+{
+    if ( !sameShape< V > ( dst, src ) )
+    {
+        return -1;
+    }
+    *asMatrix< V > ( dst ) -= *asMatrix< V > ( src );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void mulAssignAlgorithm ( void *dst, V x )
+{
+    *asMatrix< V > ( dst ) *= x;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void divAssignAlgorithm ( void *dst, V x )
+{
+    *asMatrix< V > ( dst ) /= x;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int axpyAlgorithm ( void *dst, V alpha, void *src )
+{
+    if ( !sameShape< V > ( dst, src ) )
+    {
+        return -1;
+    }
+    asMatrix< V > ( dst )->axpy ( alpha, *asMatrix< V > ( src ) );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int gemmAlgorithm ( V alpha, void *lhs, void *rhs, V beta, void *dst )
+{
+    ml::Matrix< V > *plhs = asMatrix< V > ( lhs );
+    ml::Matrix< V > *prhs = asMatrix< V > ( rhs );
+    ml::Matrix< V > *pdst = asMatrix< V > ( dst );
+    if ( plhs->colCount ( ) != prhs->rowCount ( )
+         || pdst->rowCount ( ) != plhs->rowCount ( )
+         || pdst->colCount ( ) != prhs->colCount ( ) )
+    {
+        return -1;
+    }
+    ml::gemm< V > ( alpha, *plhs, *prhs, beta, *pdst );
+    return 0;
+}
+
+// the caller's buffer, row-major or column-major, as a view the shape of
+// matrix. Returns false if ld is too small for that layout.
+template < CONCEPT_NAMESPACE Floating V, class W >
+bool bufferView ( ml::Matrix< V > const *matrix,
+                  W                     *buffer,
+                  unsigned long long int ld,
+                  bool                   rowMajor,
+                  ml::MatrixView< W >   &out )
+{
+    std::size_t const rows = matrix->rowCount ( );
+    std::size_t const cols = matrix->colCount ( );
+    if ( ld < ( rowMajor ? cols : rows ) )
+    {
+        return false;
+    }
+    out = rowMajor ? ml::MatrixView< W > { buffer, rows, cols, ld }
+                   : ml::MatrixView< W > { buffer, rows, cols, 1, ld };
+    return true;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int copyFromBufferAlgorithm ( void                  *matrix,
+                              V const               *src,
+                              unsigned long long int ld,
+                              bool                   rowMajor )
+{
+    ml::Matrix< V >          *pmat = asMatrix< V > ( matrix );
+    ml::MatrixView< V const > from { src, 0, 0, 0 };
+    if ( !bufferView ( pmat, src, ld, rowMajor, from ) )
+    {
+        return -1;
+    }
+    pmat->view ( ).assign ( from );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int copyToBufferAlgorithm ( void                  *matrix,
+                            V                     *dst,
+                            unsigned long long int ld,
+                            bool                   rowMajor )
+{
+    ml::Matrix< V >    *pmat = asMatrix< V > ( matrix );
+    ml::MatrixView< V > to { dst, 0, 0, 0 };
+    if ( !bufferView ( pmat, dst, ld, rowMajor, to ) )
+    {
+        return -1;
+    }
+    to.assign ( pmat->view ( ) );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int wrapRowMajorAlgorithm ( void                  *matrix,
+                            V                     *buffer,
+                            unsigned long long int rows,
+                            unsigned long long int cols,
+                            unsigned long long int ld )
+{
+    if ( ld < cols )
+    {
+        return -1;
+    }
+    new ( matrix )
+            ml::Matrix< V > ( ml::Matrix< V >::wrap ( buffer, rows, cols, ld ) );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::LU< V > *asLU ( void *lu )
+{
+    return ( ml::LU< V > * ) lu;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void sizeofLUAlgorithm ( unsigned long long int *size )
+{
+    *size = sizeof ( ml::LU< V > );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int factorLUAlgorithm ( void *lu, void *mat )
+{
+    ml::Matrix< V > *pmat = asMatrix< V > ( mat );
+    if ( pmat->rowCount ( ) != pmat->colCount ( ) )
+    {
+        return -1;
+    }
+    new ( lu ) ml::LU< V > ( *pmat );
+    return asLU< V > ( lu )->isSingular ( ) ? 1 : 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int solveLUAlgorithm ( V *dst, void *lu, unsigned long long int len, V *vec )
+{
+    ml::LU< V > *plu = asLU< V > ( lu );
+    if ( plu->size ( ) != len || plu->isSingular ( ) )
+    {
+        return -1;
+    }
+    std::vector< V > const x = plu->solve ( std::vector< V > ( vec, vec + len ) );
+    std::copy ( x.begin ( ), x.end ( ), dst );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void determinantLUAlgorithm ( void *lu, V *det )
+{
+    *det = asLU< V > ( lu )->determinant ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int inverseLUAlgorithm ( void *res, void *lu )
+{
+    ml::LU< V > *plu = asLU< V > ( lu );
+    if ( plu->isSingular ( ) )
+    {
+        return -1;
+    }
+    new ( res ) ml::Matrix< V > ( plu->inverse ( ) );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void deleteLUAlgorithm ( void *lu )
+{
+    delete asLU< V > ( lu );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::QR< V > *asQR ( void *qr )
+{
+    return ( ml::QR< V > * ) qr;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void sizeofQRAlgorithm ( unsigned long long int *size )
+{
+    *size = sizeof ( ml::QR< V > );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int factorQRAlgorithm ( void *qr, void *mat )
+{
+    new ( qr ) ml::QR< V > ( *asMatrix< V > ( mat ) );
+    return asQR< V > ( qr )->isRankDeficient ( ) ? 1 : 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int solveQRAlgorithm ( V *dst, void *qr, unsigned long long int len, V *vec )
+{
+    ml::QR< V > *pqr = asQR< V > ( qr );
+    if ( pqr->rowCount ( ) != len || pqr->isRankDeficient ( ) )
+    {
+        return -1;
+    }
+    std::vector< V > const x = pqr->solve ( std::vector< V > ( vec, vec + len ) );
+    std::copy ( x.begin ( ), x.end ( ), dst );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void orthogonalQRAlgorithm ( void *res, void *qr )
+{
+    new ( res ) ml::Matrix< V > ( asQR< V > ( qr )->q ( ) );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void triangularQRAlgorithm ( void *res, void *qr )
+{
+    new ( res ) ml::Matrix< V > ( asQR< V > ( qr )->r ( ) );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int leastSquaresAlgorithm ( V                     *dst,
+                            void                  *mat,
+                            unsigned long long int len,
+                            V const               *vec )
+{
+    ml::Matrix< V > *pmat = asMatrix< V > ( mat );
+    if ( pmat->rowCount ( ) != len || pmat->rowCount ( ) < pmat->colCount ( ) )
+    {
+        return -1;
+    }
+    ml::QR< V > const qr { *pmat };
+    if ( qr.isRankDeficient ( ) )
+    {
+        return -1;
+    }
+    std::vector< V > const x = qr.solve ( std::vector< V > ( vec, vec + len ) );
+    std::copy ( x.begin ( ), x.end ( ), dst );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
+int refinedSolveAlgorithm ( W                     *dst,
+                            void                  *mat,
+                            unsigned long long int len,
+                            W const               *vec,
+                            size_y                *iterations )
+{
+    ml::Matrix< W > *pmat = asMatrix< W > ( mat );
+    if ( pmat->rowCount ( ) != len || pmat->colCount ( ) != len )
+    {
+        return -1;
+    }
+    ml::RefinedLU< V, W > const lu { *pmat };
+    if ( lu.isSingular ( ) )
+    {
+        return -1;
+    }
+    ml::Refinement< W > const result =
+            lu.solve ( std::vector< W > ( vec, vec + len ) );
+    std::copy ( result.solution.begin ( ), result.solution.end ( ), dst );
+    *iterations = result.iterations;
+    return result.converged ? 0 : 1;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void deleteQRAlgorithm ( void *qr )
+{
+    delete asQR< V > ( qr );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Cholesky< V > *asCholesky ( void *chol )
+{
+    return ( ml::Cholesky< V > * ) chol;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void sizeofCholeskyAlgorithm ( unsigned long long int *size )
+{
+    *size = sizeof ( ml::Cholesky< V > );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int factorCholeskyAlgorithm ( void *chol, void *mat )
+{
+    ml::Matrix< V > *pmat = asMatrix< V > ( mat );
+    if ( pmat->rowCount ( ) != pmat->colCount ( ) )
+    {
+        return -1;
+    }
+    new ( chol ) ml::Cholesky< V > ( *pmat );
+    return int ( asCholesky< V > ( chol )->failedMinor ( ) );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int solveCholeskyAlgorithm ( V                     *dst,
+                             void                  *chol,
+                             unsigned long long int len,
+                             V                     *vec )
+{
+    ml::Cholesky< V > *pchol = asCholesky< V > ( chol );
+    if ( pchol->size ( ) != len || !pchol->isPositiveDefinite ( ) )
+    {
+        return -1;
+    }
+    std::vector< V > const x =
+            pchol->solve ( std::vector< V > ( vec, vec + len ) );
+    std::copy ( x.begin ( ), x.end ( ), dst );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int determinantCholeskyAlgorithm ( void *chol, V *det )
+{
+    ml::Cholesky< V > *pchol = asCholesky< V > ( chol );
+    if ( !pchol->isPositiveDefinite ( ) )
+    {
+        return -1;
+    }
+    *det = pchol->determinant ( );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int inverseCholeskyAlgorithm ( void *res, void *chol )
+{
+    ml::Cholesky< V > *pchol = asCholesky< V > ( chol );
+    if ( !pchol->isPositiveDefinite ( ) )
+    {
+        return -1;
+    }
+    new ( res ) ml::Matrix< V > ( pchol->inverse ( ) );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void deleteCholeskyAlgorithm ( void *chol )
+{
+    delete asCholesky< V > ( chol );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int symmetricEigenAlgorithm ( V *values, void *vectors, void *mat )
+{
+    ml::Matrix< V > *pmat = asMatrix< V > ( mat );
+    if ( pmat->rowCount ( ) != pmat->colCount ( ) )
+    {
+        return -1;
+    }
+    ml::SymmetricEigen< V > const eigen { *pmat };
+    std::copy ( eigen.eigenvalues ( ).begin ( ),
+                eigen.eigenvalues ( ).end ( ),
+                values );
+    new ( vectors ) ml::Matrix< V > ( eigen.eigenvectors ( ) );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void svdAlgorithm ( void *u, V *values, void *v, void *mat )
+{
+    ml::SVD< V > const svd { *asMatrix< V > ( mat ) };
+    std::copy ( svd.singularValues ( ).begin ( ),
+                svd.singularValues ( ).end ( ),
+                values );
+    new ( u ) ml::Matrix< V > ( svd.u ( ) );
+    new ( v ) ml::Matrix< V > ( svd.v ( ) );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int randomizedSvdAlgorithm ( void  *u,
+                             V     *values,
+                             void  *v,
+                             void  *mat,
+                             size_y rank,
+                             size_y seed )
+{
+    ml::Matrix< V > *pmat  = asMatrix< V > ( mat );
+    size_y const     count = std::min ( pmat->rowCount ( ), pmat->colCount ( ) );
+    if ( rank == 0 || rank > count )
+    {
+        return -1;
+    }
+    ml::RandomizedSVD< V > const svd { *pmat, rank, 10, 2, seed };
+    std::copy ( svd.singularValues ( ).begin ( ),
+                svd.singularValues ( ).end ( ),
+                values );
+    new ( u ) ml::Matrix< V > ( svd.u ( ) );
+    new ( v ) ml::Matrix< V > ( svd.v ( ) );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::Batch< V > *asBatch ( void *batch )
+{
+    return ( ml::Batch< V > * ) batch;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void sizeofBatchAlgorithm ( unsigned long long int *size )
+{
+    *size = sizeof ( ml::Batch< V > );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void constructBatchAlgorithm ( void                  *batch,
+                               unsigned long long int count,
+                               unsigned long long int rows,
+                               unsigned long long int cols )
+{
+    new ( batch ) ml::Batch< V > ( count, rows, cols );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int laneAlgorithm ( void                  *batch,
+                    unsigned long long int row,
+                    unsigned long long int col,
+                    V                    **lane )
+{
+    ml::Batch< V > *pbatch = asBatch< V > ( batch );
+    if ( row >= pbatch->rowCount ( ) || col >= pbatch->colCount ( ) )
+    {
+        return -1;
+    }
+    *lane = pbatch->lane ( row, col );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int gemmBatchAlgorithm ( V alpha, void *lhs, void *rhs, V beta, void *dst )
+{
+    ml::Batch< V > *plhs = asBatch< V > ( lhs );
+    ml::Batch< V > *prhs = asBatch< V > ( rhs );
+    ml::Batch< V > *pdst = asBatch< V > ( dst );
+    if ( plhs->size ( ) != pdst->size ( ) || prhs->size ( ) != pdst->size ( )
+         || plhs->rowCount ( ) != pdst->rowCount ( )
+         || plhs->colCount ( ) != prhs->rowCount ( )
+         || prhs->colCount ( ) != pdst->colCount ( ) || pdst == plhs
+         || pdst == prhs )
+    {
+        return -1;
+    }
+    ml::gemm< V > ( alpha, *plhs, *prhs, beta, *pdst );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int inverseBatchAlgorithm ( void *dst, void *src )
+{
+    ml::Batch< V > *psrc = asBatch< V > ( src );
+    ml::Batch< V > *pdst = asBatch< V > ( dst );
+    if ( psrc->rowCount ( ) != psrc->colCount ( )
+         || psrc->size ( ) != pdst->size ( )
+         || pdst->rowCount ( ) != psrc->rowCount ( )
+         || pdst->colCount ( ) != psrc->colCount ( ) || pdst == psrc )
+    {
+        return -1;
+    }
+    return int ( ml::invert ( *psrc, *pdst ) );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int solveBatchAlgorithm ( void *mat, void *rhs )
+{
+    ml::Batch< V > *pmat = asBatch< V > ( mat );
+    ml::Batch< V > *prhs = asBatch< V > ( rhs );
+    if ( pmat->rowCount ( ) != pmat->colCount ( )
+         || pmat->size ( ) != prhs->size ( )
+         || prhs->rowCount ( ) != pmat->rowCount ( ) || pmat == prhs )
+    {
+        return -1;
+    }
+    return int ( ml::solve ( *pmat, *prhs ) );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void deleteBatchAlgorithm ( void *batch )
+{
+    delete asBatch< V > ( batch );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+ml::SparseMatrix< V > *asSparse ( void *sparse )
+{
+    return ( ml::SparseMatrix< V > * ) sparse;
+}
+
+inline ml::Compressed compressionOf ( int byColumns )
+{
+    return byColumns ? ml::Compressed::Columns : ml::Compressed::Rows;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void sizeofSparseAlgorithm ( unsigned long long int *size )
+{
+    *size = sizeof ( ml::SparseMatrix< V > );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int constructSparseAlgorithm ( void                         *sparse,
+                               unsigned long long int        rows,
+                               unsigned long long int        cols,
+                               unsigned long long int        count,
+                               unsigned long long int const *rowIndices,
+                               unsigned long long int const *colIndices,
+                               V const                      *values,
+                               int                           byColumns )
+{
+    std::vector< typename ml::SparseMatrix< V >::Entry > elements ( count );
+    for ( unsigned long long int k = 0; k < count; k++ )
+    {
+        if ( rowIndices [ k ] >= rows || colIndices [ k ] >= cols )
+        {
+            return -1;
+        }
+        elements [ k ] = { std::size_t ( rowIndices [ k ] ),
+                           std::size_t ( colIndices [ k ] ),
+                           values [ k ] };
+    }
+    new ( sparse ) ml::SparseMatrix< V > ( rows,
+                                           cols,
+                                           elements,
+                                           compressionOf ( byColumns ) );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void toSparseAlgorithm ( void *sparse, void *mat, int byColumns )
+{
+    new ( sparse ) ml::SparseMatrix< V > ( *asMatrix< V > ( mat ),
+                                           compressionOf ( byColumns ) );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void toDenseAlgorithm ( void *mat, void *sparse )
+{
+    new ( mat ) ml::Matrix< V > ( asSparse< V > ( sparse )->toMatrix ( ) );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void countNonZerosAlgorithm ( void *sparse, unsigned long long int *count )
+{
+    *count = asSparse< V > ( sparse )->nonZeroCount ( );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int evalSparseAlgorithm ( V                     *dst,
+                          void                  *sparse,
+                          unsigned long long int len,
+                          V const               *vec )
+{
+    ml::SparseMatrix< V > *psparse = asSparse< V > ( sparse );
+    if ( psparse->colCount ( ) != len )
+    {
+        return -1;
+    }
+    ml::spmv< V > ( 1, *psparse, vec, 0, dst );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int mulIntoSparseAlgorithm ( void *dst, void *lhs, void *rhs )
+{
+    ml::SparseMatrix< V > *plhs = asSparse< V > ( lhs );
+    ml::Matrix< V >       *prhs = asMatrix< V > ( rhs );
+    ml::Matrix< V >       *pdst = asMatrix< V > ( dst );
+    if ( !hasShape ( prhs, plhs->colCount ( ), prhs->colCount ( ) )
+         || !hasShape ( pdst, plhs->rowCount ( ), prhs->colCount ( ) )
+         || pdst == prhs )
+    {
+        return -1;
+    }
+    ml::spmm< V > ( 1, *plhs, *prhs, 0, *pdst );
+    return 0;
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+int mulSparseAlgorithm ( void *dst, void *lhs, void *rhs )
+{
+    ml::SparseMatrix< V > *plhs = asSparse< V > ( lhs );
+    ml::Matrix< V >       *prhs = asMatrix< V > ( rhs );
+    if ( plhs->colCount ( ) != prhs->rowCount ( ) )
+    {
+        return -1;
+    }
+    constructMatrixAlgorithm< V > ( dst, plhs->rowCount ( ), prhs->colCount ( ) );
+    return mulIntoSparseAlgorithm< V > ( dst, lhs, rhs );
+}
+
+template < CONCEPT_NAMESPACE Floating V >
+void deleteSparseAlgorithm ( void *sparse )
+{
+    delete asSparse< V > ( sparse );
+}
+
+inline ml::QuantizedMatrix *asQuantized ( void *quantized )
+{
+    return ( ml::QuantizedMatrix * ) quantized;
+}
 
-    *pdst = *psrc * scalar;
+inline void sizeofQuantizedAlgorithm ( unsigned long long int *size )
+{
+    *size = sizeof ( ml::QuantizedMatrix );
 }
 
-template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
-void divMatrixAndScalarAlgorithm ( void *dst, void *src, W scalar )
+inline void quantizeAlgorithm ( void *quantized,
+                                void *mat,
+                                int   asymmetric,
+                                int   byColumns )
 {
-    ml::Matrix< V > *psrc = asMatrix< V > ( src );
-    constructMatrixAlgorithm< decltype ( V { 0 } + W { 0 } ) > (
-            dst,
-            psrc->rowCount ( ),
-            psrc->colCount ( ) );
-    ml::Matrix< decltype ( V { 0 } + W { 0 } ) > *pdst =
-            asMatrix< decltype ( V { 0 } + W { 0 } ) > ( dst );
+    new ( quantized ) ml::QuantizedMatrix (
+            *asMatrix< Single > ( mat ),
+            asymmetric ? ml::Quantization::Asymmetric : ml::Quantization::Symmetric,
+            byColumns ? ml::Scales::Columns : ml::Scales::Rows );
+}
 
-    *pdst = *psrc / scalar;
+inline void dequantizeAlgorithm ( void *mat, void *quantized )
+{
+    new ( mat ) ml::Matrix< Single > ( asQuantized ( quantized )->toMatrix ( ) );
 }
 
-template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
-int augmentMatrixAndMatrixAlgorithm ( void *aug, void *lhs, void *rhs )
+inline int evalQuantizedAlgorithm ( Single                *dst,
+                                    void                  *quantized,
+                                    unsigned long long int len,
+                                    Single const          *vec )
 {
-    ml::Matrix< V > *plhs = asMatrix< V > ( lhs );
-    ml::Matrix< W > *prhs = asMatrix< W > ( rhs );
-    if ( plhs->rowCount ( ) != prhs->rowCount ( ) )
+    ml::QuantizedMatrix *pquantized = asQuantized ( quantized );
+    if ( pquantized->colCount ( ) != len )
     {
         return -1;
-    } else
-    {
-        constructMatrixAlgorithm< decltype ( V { 0 } + W { 0 } ) > (
-                aug,
-                plhs->rowCount ( ),
-                plhs->colCount ( ) + prhs->colCount ( ) );
-        ml::Matrix< decltype ( V { 0 } + W { 0 } ) > *paug =
-                asMatrix< decltype ( V { 0 } + W { 0 } ) > ( aug );
-        *paug = plhs->augment ( *prhs );
-        return 0;
     }
+    ml::qgemv ( 1, *pquantized, vec, 0, dst );
+    return 0;
 }
 
-template < CONCEPT_NAMESPACE Floating V >
-void echelonAlgorithm ( void *res, void *mat )
+// qgemm sums along the shared dimension, so it needs lhs scaled per row and
+// rhs per column.
+inline bool canMultiply ( ml::QuantizedMatrix const &lhs,
+                          std::size_t                rows,
+                          ml::Scales                 scaling )
 {
-    ml::Matrix< V > *pmat = asMatrix< V > ( mat );
-    constructMatrixAlgorithm< V > ( res,
-                                    pmat->rowCount ( ),
-                                    pmat->colCount ( ) );
-    ml::Matrix< V > *pres = asMatrix< V > ( res );
-    *pres                 = pmat->echelon ( );
+    return lhs.colCount ( ) == rows && lhs.scaling ( ) == ml::Scales::Rows
+        && scaling == ml::Scales::Columns;
 }
 
-template < CONCEPT_NAMESPACE Floating V >
-int inverseAlgorithm ( void *res, void *mat )
+inline int mulQuantizedAlgorithm ( void *dst, void *lhs, void *rhs )
 {
-    ml::Matrix< V > *pmat = asMatrix< V > ( mat );
-    try
+    ml::QuantizedMatrix *plhs = asQuantized ( lhs );
+    ml::QuantizedMatrix *prhs = asQuantized ( rhs );
+    if ( !canMultiply ( *plhs, prhs->rowCount ( ), prhs->scaling ( ) ) )
     {
-        ml::Matrix< V > temp = pmat->inverse ( );
-        constructMatrixAlgorithm< V > ( res,
-                                        pmat->rowCount ( ),
-                                        pmat->colCount ( ) );
-        ml::Matrix< V > *pres = asMatrix< V > ( res );
-        *pres                 = temp;
-        return 0;
-    } catch ( ... )
+        return -1;
+    }
+    constructMatrixAlgorithm< Single > ( dst, plhs->rowCount ( ), prhs->colCount ( ) );
+    ml::qgemm ( 1, *plhs, *prhs, 0, *asMatrix< Single > ( dst ) );
+    return 0;
+}
+
+inline int mulQuantizedAndMatrixAlgorithm ( void *dst, void *lhs, void *rhs )
+{
+    ml::QuantizedMatrix  *plhs = asQuantized ( lhs );
+    ml::Matrix< Single > *prhs = asMatrix< Single > ( rhs );
+    if ( !canMultiply ( *plhs, prhs->rowCount ( ), ml::Scales::Columns ) )
     {
         return -1;
     }
+    // the same as QuantizedMatrix's operator*.
+    ml::QuantizedMatrix quantized { *prhs, ml::Quantization::Symmetric,
+                                    ml::Scales::Columns };
+    return mulQuantizedAlgorithm ( dst, lhs, &quantized );
+}
+
+inline void deleteQuantizedAlgorithm ( void *quantized )
+{
+    delete asQuantized ( quantized );
 }
 
 template < CONCEPT_NAMESPACE Floating V, CONCEPT_NAMESPACE Floating W >
@@ -593,6 +1438,116 @@ extern "C" {
                                                                   len,         \
                                                                   vec );       \
     }
+#define EXPORT_FN_MATRIX_BATCH_OP( RET, NAME )                                 \
+    EXTERN RET NAME##SinglesWithSingle ( Single         *res,                  \
+                                         MatrixOfSingles src,                  \
+                                         size_y          count,                \
+                                         size_y          len,                  \
+                                         Single         *vecs )                \
+    {                                                                          \
+        return NAME##MatrixAndVectorAlgorithm< Single, Single > ( res,         \
+                                                                  src,         \
+                                                                  count,       \
+                                                                  len,         \
+                                                                  vecs );      \
+    }                                                                          \
+    EXTERN RET NAME##SinglesWithDouble ( Double         *res,                  \
+                                         MatrixOfSingles src,                  \
+                                         size_y          count,                \
+                                         size_y          len,                  \
+                                         Double         *vecs )                \
+    {                                                                          \
+        return NAME##MatrixAndVectorAlgorithm< Single, Double > ( res,         \
+                                                                  src,         \
+                                                                  count,       \
+                                                                  len,         \
+                                                                  vecs );      \
+    }                                                                          \
+    EXTERN RET NAME##SinglesWithTriple ( Triple         *res,                  \
+                                         MatrixOfSingles src,                  \
+                                         size_y          count,                \
+                                         size_y          len,                  \
+                                         Triple         *vecs )                \
+    {                                                                          \
+        return NAME##MatrixAndVectorAlgorithm< Single, Triple > ( res,         \
+                                                                  src,         \
+                                                                  count,       \
+                                                                  len,         \
+                                                                  vecs );      \
+    }                                                                          \
+    EXTERN RET NAME##DoublesWithSingle ( Double         *res,                  \
+                                         MatrixOfDoubles src,                  \
+                                         size_y          count,                \
+                                         size_y          len,                  \
+                                         Single         *vecs )                \
+    {                                                                          \
+        return NAME##MatrixAndVectorAlgorithm< Double, Single > ( res,         \
+                                                                  src,         \
+                                                                  count,       \
+                                                                  len,         \
+                                                                  vecs );      \
+    }                                                                          \
+    EXTERN RET NAME##DoublesWithDouble ( Double         *res,                  \
+                                         MatrixOfDoubles src,                  \
+                                         size_y          count,                \
+                                         size_y          len,                  \
+                                         Double         *vecs )                \
+    {                                                                          \
+        return NAME##MatrixAndVectorAlgorithm< Double, Double > ( res,         \
+                                                                  src,         \
+                                                                  count,       \
+                                                                  len,         \
+                                                                  vecs );      \
+    }                                                                          \
+    EXTERN RET NAME##DoublesWithTriple ( Triple         *res,                  \
+                                         MatrixOfDoubles src,                  \
+                                         size_y          count,                \
+                                         size_y          len,                  \
+                                         Triple         *vecs )                \
+    {                                                                          \
+        return NAME##MatrixAndVectorAlgorithm< Double, Triple > ( res,         \
+                                                                  src,         \
+                                                                  count,       \
+                                                                  len,         \
+                                                                  vecs );      \
+    }                                                                          \
+    EXTERN RET NAME##TriplesWithSingle ( Triple         *res,                  \
+                                         MatrixOfTriples src,                  \
+                                         size_y          count,                \
+                                         size_y          len,                  \
+                                         Single         *vecs )                \
+    {                                                                          \
+        return NAME##MatrixAndVectorAlgorithm< Triple, Single > ( res,         \
+                                                                  src,         \
+                                                                  count,       \
+                                                                  len,         \
+                                                                  vecs );      \
+    }                                                                          \
+    EXTERN RET NAME##TriplesWithDouble ( Triple         *res,                  \
+                                         MatrixOfTriples src,                  \
+                                         size_y          count,                \
+                                         size_y          len,                  \
+                                         Double         *vecs )                \
+    {                                                                          \
+        return NAME##MatrixAndVectorAlgorithm< Triple, Double > ( res,         \
+                                                                  src,         \
+                                                                  count,       \
+                                                                  len,         \
+                                                                  vecs );      \
+    }                                                                          \
+    EXTERN RET NAME##TriplesWithTriple ( Triple         *res,                  \
+                                         MatrixOfTriples src,                  \
+                                         size_y          count,                \
+                                         size_y          len,                  \
+                                         Triple         *vecs )                \
+    {                                                                          \
+        return NAME##MatrixAndVectorAlgorithm< Triple, Triple > ( res,         \
+                                                                  src,         \
+                                                                  count,       \
+                                                                  len,         \
+                                                                  vecs );      \
+    }
+
 #define EXPORT_FN_MATRIX_SCALAR_BIN_OP( RET, NAME )                            \
     EXTERN RET NAME##SinglesAndSingle ( MatrixOfSingles dst,                   \
                                         MatrixOfSingles src,                   \
@@ -667,6 +1622,318 @@ extern "C" {
                                                                   x );         \
     }
 
+#define EXPORT_FN_IN_PLACE( TYPE, NAME )                                       \
+    EXTERN int addAssignOf##NAME ( void *dst, void *src )                      \
+    {                                                                          \
+        return addAssignAlgorithm< TYPE > ( dst, src );                        \
+    }                                                                          \
+    EXTERN int subAssignOf##NAME ( void *dst, void *src )                      \
+    {                                                                          \
+        return subAssignAlgorithm< TYPE > ( dst, src );                        \
+    }                                                                          \
+    EXTERN void mulAssignOf##NAME ( void *dst, TYPE x )                        \
+    {                                                                          \
+        mulAssignAlgorithm< TYPE > ( dst, x );                                 \
+    }                                                                          \
+    EXTERN void divAssignOf##NAME ( void *dst, TYPE x )                        \
+    {                                                                          \
+        divAssignAlgorithm< TYPE > ( dst, x );                                 \
+    }                                                                          \
+    EXTERN int axpyOf##NAME ( void *dst, TYPE alpha, void *src )               \
+    {                                                                          \
+        return axpyAlgorithm< TYPE > ( dst, alpha, src );                      \
+    }                                                                          \
+    EXTERN int gemmOf##NAME ( TYPE  alpha,                                     \
+                              void *lhs,                                       \
+                              void *rhs,                                       \
+                              TYPE  beta,                                      \
+                              void *dst )                                      \
+    {                                                                          \
+        return gemmAlgorithm< TYPE > ( alpha, lhs, rhs, beta, dst );           \
+    }
+
+#define EXPORT_FN_BUFFER( TYPE, NAME )                                         \
+    EXTERN int copyFromRowMajorOf##NAME ( void       *matrix,                  \
+                                         TYPE const *src,                      \
+                                         size_y      ld )                      \
+    {                                                                          \
+        return copyFromBufferAlgorithm< TYPE > ( matrix, src, ld, true );      \
+    }                                                                          \
+    EXTERN int copyFromColMajorOf##NAME ( void       *matrix,                  \
+                                         TYPE const *src,                      \
+                                         size_y      ld )                      \
+    {                                                                          \
+        return copyFromBufferAlgorithm< TYPE > ( matrix, src, ld, false );     \
+    }                                                                          \
+    EXTERN int copyToRowMajorOf##NAME ( void *matrix, TYPE *dst, size_y ld )   \
+    {                                                                          \
+        return copyToBufferAlgorithm< TYPE > ( matrix, dst, ld, true );        \
+    }                                                                          \
+    EXTERN int copyToColMajorOf##NAME ( void *matrix, TYPE *dst, size_y ld )   \
+    {                                                                          \
+        return copyToBufferAlgorithm< TYPE > ( matrix, dst, ld, false );       \
+    }                                                                          \
+    EXTERN int wrapRowMajorOf##NAME ( void  *matrix,                           \
+                                      TYPE  *buffer,                           \
+                                      size_y rows,                             \
+                                      size_y cols,                             \
+                                      size_y ld )                              \
+    {                                                                          \
+        return wrapRowMajorAlgorithm< TYPE > ( matrix,                         \
+                                               buffer,                         \
+                                               rows,                           \
+                                               cols,                           \
+                                               ld );                           \
+    }
+
+#define EXPORT_FN_LU( TYPE, NAME )                                             \
+    EXTERN void sizeofLUOf##NAME ( size_y *size )                              \
+    {                                                                          \
+        sizeofLUAlgorithm< TYPE > ( size );                                    \
+    }                                                                          \
+    EXTERN int factorLUOf##NAME ( void *lu, void *mat )                        \
+    {                                                                          \
+        return factorLUAlgorithm< TYPE > ( lu, mat );                          \
+    }                                                                          \
+    EXTERN int solveLUOf##NAME ( TYPE *dst, void *lu, size_y len, TYPE *vec )  \
+    {                                                                          \
+        return solveLUAlgorithm< TYPE > ( dst, lu, len, vec );                 \
+    }                                                                          \
+    EXTERN void determinantLUOf##NAME ( void *lu, TYPE *det )                  \
+    {                                                                          \
+        determinantLUAlgorithm< TYPE > ( lu, det );                            \
+    }                                                                          \
+    EXTERN int inverseLUOf##NAME ( void *res, void *lu )                       \
+    {                                                                          \
+        return inverseLUAlgorithm< TYPE > ( res, lu );                         \
+    }                                                                          \
+    EXTERN void deleteLUOf##NAME ( void *lu ) { deleteLUAlgorithm< TYPE > ( lu ); }
+
+#define EXPORT_FN_QR( TYPE, NAME )                                             \
+    EXTERN void sizeofQROf##NAME ( size_y *size )                              \
+    {                                                                          \
+        sizeofQRAlgorithm< TYPE > ( size );                                    \
+    }                                                                          \
+    EXTERN int factorQROf##NAME ( void *qr, void *mat )                        \
+    {                                                                          \
+        return factorQRAlgorithm< TYPE > ( qr, mat );                          \
+    }                                                                          \
+    EXTERN int solveQROf##NAME ( TYPE *dst, void *qr, size_y len, TYPE *vec )  \
+    {                                                                          \
+        return solveQRAlgorithm< TYPE > ( dst, qr, len, vec );                 \
+    }                                                                          \
+    EXTERN void orthogonalQROf##NAME ( void *res, void *qr )                   \
+    {                                                                          \
+        orthogonalQRAlgorithm< TYPE > ( res, qr );                             \
+    }                                                                          \
+    EXTERN void triangularQROf##NAME ( void *res, void *qr )                   \
+    {                                                                          \
+        triangularQRAlgorithm< TYPE > ( res, qr );                             \
+    }                                                                          \
+    EXTERN int leastSquaresOf##NAME ( TYPE       *dst,                         \
+                                      void       *mat,                         \
+                                      size_y      len,                         \
+                                      TYPE const *vec )                        \
+    {                                                                          \
+        return leastSquaresAlgorithm< TYPE > ( dst, mat, len, vec );           \
+    }                                                                          \
+    EXTERN void deleteQROf##NAME ( void *qr )                                  \
+    {                                                                          \
+        deleteQRAlgorithm< TYPE > ( qr );                                      \
+    }
+
+#define EXPORT_FN_REFINED( LOW, TYPE, NAME )                                   \
+    EXTERN int refinedSolveOf##NAME ( TYPE       *dst,                         \
+                                      void       *mat,                         \
+                                      size_y      len,                         \
+                                      TYPE const *vec,                         \
+                                      size_y     *iterations )                 \
+    {                                                                          \
+        return refinedSolveAlgorithm< LOW, TYPE > (                            \
+                dst, mat, len, vec, iterations );                              \
+    }
+
+#define EXPORT_FN_CHOLESKY( TYPE, NAME )                                       \
+    EXTERN void sizeofCholeskyOf##NAME ( size_y *size )                        \
+    {                                                                          \
+        sizeofCholeskyAlgorithm< TYPE > ( size );                              \
+    }                                                                          \
+    EXTERN int factorCholeskyOf##NAME ( void *chol, void *mat )                \
+    {                                                                          \
+        return factorCholeskyAlgorithm< TYPE > ( chol, mat );                  \
+    }                                                                          \
+    EXTERN int solveCholeskyOf##NAME ( TYPE  *dst,                             \
+                                       void  *chol,                            \
+                                       size_y len,                             \
+                                       TYPE  *vec )                            \
+    {                                                                          \
+        return solveCholeskyAlgorithm< TYPE > ( dst, chol, len, vec );         \
+    }                                                                          \
+    EXTERN int determinantCholeskyOf##NAME ( void *chol, TYPE *det )           \
+    {                                                                          \
+        return determinantCholeskyAlgorithm< TYPE > ( chol, det );             \
+    }                                                                          \
+    EXTERN int inverseCholeskyOf##NAME ( void *res, void *chol )               \
+    {                                                                          \
+        return inverseCholeskyAlgorithm< TYPE > ( res, chol );                 \
+    }                                                                          \
+    EXTERN void deleteCholeskyOf##NAME ( void *chol )                          \
+    {                                                                          \
+        deleteCholeskyAlgorithm< TYPE > ( chol );                             \
+    }
+
+#define EXPORT_FN_EIGEN( TYPE, NAME )                                          \
+    EXTERN int symmetricEigenOf##NAME ( TYPE *values,                          \
+                                        void *vectors,                         \
+                                        void *mat )                            \
+    {                                                                          \
+        return symmetricEigenAlgorithm< TYPE > ( values, vectors, mat );       \
+    }                                                                          \
+    EXTERN void svdOf##NAME ( void *u, TYPE *values, void *v, void *mat )      \
+    {                                                                          \
+        svdAlgorithm< TYPE > ( u, values, v, mat );                            \
+    }                                                                          \
+    EXTERN int randomizedSvdOf##NAME ( void  *u,                               \
+                                       TYPE  *values,                          \
+                                       void  *v,                               \
+                                       void  *mat,                             \
+                                       size_y rank,                            \
+                                       size_y seed )                           \
+    {                                                                          \
+        return randomizedSvdAlgorithm< TYPE > (                                \
+                u, values, v, mat, rank, seed );                               \
+    }
+
+#define EXPORT_FN_BATCH( TYPE, NAME )                                          \
+    EXTERN void sizeofBatchOf##NAME ( size_y *size )                           \
+    {                                                                          \
+        sizeofBatchAlgorithm< TYPE > ( size );                                 \
+    }                                                                          \
+    EXTERN void constructBatchOf##NAME ( void  *batch,                         \
+                                         size_y count,                         \
+                                         size_y rows,                          \
+                                         size_y cols )                         \
+    {                                                                          \
+        constructBatchAlgorithm< TYPE > ( batch, count, rows, cols );          \
+    }                                                                          \
+    EXTERN int laneOf##NAME ( void *batch, size_y row, size_y col, TYPE **lane )\
+    {                                                                          \
+        return laneAlgorithm< TYPE > ( batch, row, col, lane );                \
+    }                                                                          \
+    EXTERN int gemmBatchOf##NAME ( TYPE  alpha,                                \
+                                   void *lhs,                                  \
+                                   void *rhs,                                  \
+                                   TYPE  beta,                                 \
+                                   void *dst )                                 \
+    {                                                                          \
+        return gemmBatchAlgorithm< TYPE > ( alpha, lhs, rhs, beta, dst );      \
+    }                                                                          \
+    EXTERN int inverseBatchOf##NAME ( void *dst, void *src )                   \
+    {                                                                          \
+        return inverseBatchAlgorithm< TYPE > ( dst, src );                     \
+    }                                                                          \
+    EXTERN int solveBatchOf##NAME ( void *mat, void *rhs )                     \
+    {                                                                          \
+        return solveBatchAlgorithm< TYPE > ( mat, rhs );                       \
+    }                                                                          \
+    EXTERN void deleteBatchOf##NAME ( void *batch )                            \
+    {                                                                          \
+        deleteBatchAlgorithm< TYPE > ( batch );                                \
+    }
+
+#define EXPORT_FN_SPARSE( TYPE, NAME )                                         \
+    EXTERN void sizeofSparseOf##NAME ( size_y *size )                          \
+    {                                                                          \
+        sizeofSparseAlgorithm< TYPE > ( size );                                \
+    }                                                                          \
+    EXTERN int constructSparseOf##NAME ( void         *sparse,                 \
+                                         size_y        rows,                   \
+                                         size_y        cols,                   \
+                                         size_y        count,                  \
+                                         size_y const *rowIndices,             \
+                                         size_y const *colIndices,             \
+                                         TYPE const   *values,                 \
+                                         int           byColumns )             \
+    {                                                                          \
+        return constructSparseAlgorithm< TYPE > ( sparse,                      \
+                                                  rows,                        \
+                                                  cols,                        \
+                                                  count,                       \
+                                                  rowIndices,                  \
+                                                  colIndices,                  \
+                                                  values,                      \
+                                                  byColumns );                 \
+    }                                                                          \
+    EXTERN void toSparseOf##NAME ( void *sparse, void *mat, int byColumns )    \
+    {                                                                          \
+        toSparseAlgorithm< TYPE > ( sparse, mat, byColumns );                  \
+    }                                                                          \
+    EXTERN void toDenseOf##NAME ( void *mat, void *sparse )                    \
+    {                                                                          \
+        toDenseAlgorithm< TYPE > ( mat, sparse );                              \
+    }                                                                          \
+    EXTERN void countNonZerosOf##NAME ( void *sparse, size_y *count )          \
+    {                                                                          \
+        countNonZerosAlgorithm< TYPE > ( sparse, count );                      \
+    }                                                                          \
+    EXTERN int evalSparseOf##NAME ( TYPE       *dst,                           \
+                                    void       *sparse,                        \
+                                    size_y      len,                           \
+                                    TYPE const *vec )                          \
+    {                                                                          \
+        return evalSparseAlgorithm< TYPE > ( dst, sparse, len, vec );          \
+    }                                                                          \
+    EXTERN int mulSparseOf##NAME ( void *dst, void *lhs, void *rhs )           \
+    {                                                                          \
+        return mulSparseAlgorithm< TYPE > ( dst, lhs, rhs );                   \
+    }                                                                          \
+    EXTERN int mulIntoSparseOf##NAME ( void *dst, void *lhs, void *rhs )       \
+    {                                                                          \
+        return mulIntoSparseAlgorithm< TYPE > ( dst, lhs, rhs );               \
+    }                                                                          \
+    EXTERN void deleteSparseOf##NAME ( void *sparse )                          \
+    {                                                                          \
+        deleteSparseAlgorithm< TYPE > ( sparse );                              \
+    }
+
+#define EXPORT_FN_QUANTIZED( TYPE, NAME )                                      \
+    EXTERN void sizeofQuantizedOf##NAME ( size_y *size )                       \
+    {                                                                          \
+        sizeofQuantizedAlgorithm ( size );                                     \
+    }                                                                          \
+    EXTERN void quantizeOf##NAME ( void *quantized,                            \
+                                   void *mat,                                  \
+                                   int   asymmetric,                           \
+                                   int   byColumns )                           \
+    {                                                                          \
+        quantizeAlgorithm ( quantized, mat, asymmetric, byColumns );           \
+    }                                                                          \
+    EXTERN void dequantizeOf##NAME ( void *mat, void *quantized )              \
+    {                                                                          \
+        dequantizeAlgorithm ( mat, quantized );                                \
+    }                                                                          \
+    EXTERN int evalQuantizedOf##NAME ( TYPE       *dst,                        \
+                                       void       *quantized,                  \
+                                       size_y      len,                        \
+                                       TYPE const *vec )                       \
+    {                                                                          \
+        return evalQuantizedAlgorithm ( dst, quantized, len, vec );            \
+    }                                                                          \
+    EXTERN int mulQuantizedOf##NAME ( void *dst, void *lhs, void *rhs )        \
+    {                                                                          \
+        return mulQuantizedAlgorithm ( dst, lhs, rhs );                        \
+    }                                                                          \
+    EXTERN int mulQuantizedAndMatrixOf##NAME ( void *dst,                      \
+                                               void *lhs,                      \
+                                               void *rhs )                     \
+    {                                                                          \
+        return mulQuantizedAndMatrixAlgorithm ( dst, lhs, rhs );               \
+    }                                                                          \
+    EXTERN void deleteQuantizedOf##NAME ( void *quantized )                    \
+    {                                                                          \
+        deleteQuantizedAlgorithm ( quantized );                                \
+    }
+
 #define EXPORT_FN_MATRIX_COMPARE( RET, NAME )                                  \
     EXTERN RET NAME##SinglesAndSingles ( MatrixOfSingles lhs,                  \
                                          MatrixOfSingles rhs )                 \
@@ -758,6 +2025,7 @@ extern "C" {
     EXPORT_FN_MATRIX_MATRIX_BIN_OP ( int, mul )
 
     EXPORT_FN_MATRIX_VECTOR_BIN_OP ( int, eval )
+    EXPORT_FN_MATRIX_BATCH_OP ( int, evalBatch )
 
     EXPORT_FN_MATRIX_SCALAR_BIN_OP ( void, mul )
     EXPORT_FN_MATRIX_SCALAR_BIN_OP ( void, div )
@@ -771,4 +2039,61 @@ extern "C" {
     EXPORT_FN_TWO_ARG ( int, inverse, res, void *, mat, void * )
 
     EXPORT_FN_MATRIX_COMPARE ( int, compare )
+
+    EXPORT_FN_MATRIX_MATRIX_BIN_OP ( int, addInto )
+    EXPORT_FN_MATRIX_MATRIX_BIN_OP ( int, subInto )
+    EXPORT_FN_MATRIX_MATRIX_BIN_OP ( int, mulInto )
+    EXPORT_FN_MATRIX_MATRIX_BIN_OP ( int, augmentInto )
+
+    EXPORT_FN_MATRIX_SCALAR_BIN_OP ( int, mulInto )
+    EXPORT_FN_MATRIX_SCALAR_BIN_OP ( int, divInto )
+
+    EXPORT_FN_TWO_ARG ( int, echelonInto, res, void *, mat, void * )
+
+    EXPORT_FN_IN_PLACE ( Single, Singles )
+    EXPORT_FN_IN_PLACE ( Double, Doubles )
+    EXPORT_FN_IN_PLACE ( Triple, Triples )
+
+    EXPORT_FN_BUFFER ( Single, Singles )
+    EXPORT_FN_BUFFER ( Double, Doubles )
+    EXPORT_FN_BUFFER ( Triple, Triples )
+
+    EXPORT_FN_LU ( Single, Singles )
+    EXPORT_FN_LU ( Double, Doubles )
+    EXPORT_FN_LU ( Triple, Triples )
+
+    EXPORT_FN_QR ( Single, Singles )
+    EXPORT_FN_QR ( Double, Doubles )
+    EXPORT_FN_QR ( Triple, Triples )
+
+    EXPORT_FN_REFINED ( Single, Double, Doubles )
+    EXPORT_FN_REFINED ( Single, Triple, Triples )
+
+    EXPORT_FN_CHOLESKY ( Single, Singles )
+    EXPORT_FN_CHOLESKY ( Double, Doubles )
+    EXPORT_FN_CHOLESKY ( Triple, Triples )
+
+    EXPORT_FN_EIGEN ( Single, Singles )
+    EXPORT_FN_EIGEN ( Double, Doubles )
+    EXPORT_FN_EIGEN ( Triple, Triples )
+
+    EXPORT_FN_BATCH ( Single, Singles )
+    EXPORT_FN_BATCH ( Double, Doubles )
+    EXPORT_FN_BATCH ( Triple, Triples )
+
+    EXPORT_FN_SPARSE ( Single, Singles )
+    EXPORT_FN_SPARSE ( Double, Doubles )
+    EXPORT_FN_SPARSE ( Triple, Triples )
+
+    EXPORT_FN_QUANTIZED ( Single, Singles )
+
+    EXTERN void setThreadCount ( size_y count )
+    {
+        ml::thread::setThreadCount ( count );
+    }
+
+    EXTERN void countThreads ( size_y *count )
+    {
+        *count = ml::thread::threadCount ( );
+    }
 }
\ No newline at end of file
@@ -6,7 +6,8 @@
  * and use all the code) or as a shared library (meaning that the code is
  * precompiled for you). As a source library, ML must be compiled with C++.
  * @note All results assume a properly sized buffer but no matrix at the
- * destination pointer.
+ * destination pointer, except for the ...Into functions and the in place
+ * updates, which write into a matrix that is already there.
  * @note The source matrix after a move operation should be considered
  * undefined.
  * @note Always pair getting the destination of a matrix or constructing a
@@ -45,9 +46,25 @@
 extern "C" {
 #endif
 
-    typedef void                  *MatrixOfSingles; // Matrix<float>
-    typedef void                  *MatrixOfDoubles; // Matrix<double>
-    typedef void                  *MatrixOfTriples; // Matrix<long double>
+    typedef void                  *MatrixOfSingles;    // Matrix<float>
+    typedef void                  *MatrixOfDoubles;    // Matrix<double>
+    typedef void                  *MatrixOfTriples;    // Matrix<long double>
+    typedef void                  *LUOfSingles;        // LU<float>
+    typedef void                  *LUOfDoubles;        // LU<double>
+    typedef void                  *LUOfTriples;        // LU<long double>
+    typedef void                  *QROfSingles;        // QR<float>
+    typedef void                  *QROfDoubles;        // QR<double>
+    typedef void                  *QROfTriples;        // QR<long double>
+    typedef void                  *CholeskyOfSingles;  // Cholesky<float>
+    typedef void                  *CholeskyOfDoubles;  // Cholesky<double>
+    typedef void                  *CholeskyOfTriples;  // Cholesky<long double>
+    typedef void                  *BatchOfSingles;     // Batch<float>
+    typedef void                  *BatchOfDoubles;     // Batch<double>
+    typedef void                  *BatchOfTriples;     // Batch<long double>
+    typedef void                  *SparseOfSingles;    // SparseMatrix<float>
+    typedef void                  *SparseOfDoubles;    // SparseMatrix<double>
+    typedef void                  *SparseOfTriples;    // SparseMatrix<long double>
+    typedef void                  *QuantizedOfSingles; // QuantizedMatrix
     typedef unsigned long long int size_y;
 
     // functions to get the size of the matrix type.
@@ -98,6 +115,58 @@ extern "C" {
     EXTERN int
             setIndexOfTriples ( MatrixOfTriples, size_y, size_y, long double );
 
+    // bulk copies between a matrix and a buffer of rows * cols elements
+    // (taking the shape from the matrix), one call for the whole matrix. In
+    // row-major order row i starts ld elements after row i - 1, so ld must be
+    // at least cols; in column-major order column j starts ld elements after
+    // column j - 1, so ld must be at least rows. Return nonzero (and copy
+    // nothing) if ld is too small.
+    EXTERN int
+            copyFromRowMajorOfSingles ( MatrixOfSingles, float const *, size_y );
+    EXTERN int
+            copyFromRowMajorOfDoubles ( MatrixOfDoubles, double const *, size_y );
+    EXTERN int copyFromRowMajorOfTriples ( MatrixOfTriples,
+                                           long double const *,
+                                           size_y );
+    EXTERN int
+            copyFromColMajorOfSingles ( MatrixOfSingles, float const *, size_y );
+    EXTERN int
+            copyFromColMajorOfDoubles ( MatrixOfDoubles, double const *, size_y );
+    EXTERN int copyFromColMajorOfTriples ( MatrixOfTriples,
+                                           long double const *,
+                                           size_y );
+    EXTERN int copyToRowMajorOfSingles ( MatrixOfSingles, float *, size_y );
+    EXTERN int copyToRowMajorOfDoubles ( MatrixOfDoubles, double *, size_y );
+    EXTERN int
+            copyToRowMajorOfTriples ( MatrixOfTriples, long double *, size_y );
+    EXTERN int copyToColMajorOfSingles ( MatrixOfSingles, float *, size_y );
+    EXTERN int copyToColMajorOfDoubles ( MatrixOfDoubles, double *, size_y );
+    EXTERN int
+            copyToColMajorOfTriples ( MatrixOfTriples, long double *, size_y );
+
+    // constructs a rows x cols matrix whose elements are the row-major buffer
+    // given, with rows ld elements apart, without copying it. Everything
+    // written to the matrix goes straight to the buffer. The buffer must
+    // outlive the matrix; deleting the matrix leaves the buffer alone. Args
+    // are the matrix, buffer, rows, cols, and ld. Returns nonzero (and
+    // constructs nothing) if ld is less than cols. A column-major buffer
+    // wraps as its transpose, with rows and cols swapped.
+    EXTERN int wrapRowMajorOfSingles ( MatrixOfSingles,
+                                       float *,
+                                       size_y,
+                                       size_y,
+                                       size_y );
+    EXTERN int wrapRowMajorOfDoubles ( MatrixOfDoubles,
+                                       double *,
+                                       size_y,
+                                       size_y,
+                                       size_y );
+    EXTERN int wrapRowMajorOfTriples ( MatrixOfTriples,
+                                       long double *,
+                                       size_y,
+                                       size_y,
+                                       size_y );
+
     // lhs <- rhs
     EXTERN void copyMatrixOfSingles ( MatrixOfSingles, MatrixOfSingles );
     EXTERN void copyMatrixOfDoubles ( MatrixOfDoubles, MatrixOfDoubles );
@@ -194,10 +263,10 @@ extern "C" {
 
     // B <- A * x
     // where B is first arg, A is second arg, third arg is length of x, fourth
-    // arg is x. Note: all of these temporarily construct an instance of
-    // std::vector and will probably segfault if given the wrong size. Note:
-    // assumes that the buffer is the correct length because this program
-    // assumes you know how to use matrices.
+    // arg is x. These read x and write B where they are, without allocating,
+    // and will probably segfault if given the wrong size. Note: assumes that
+    // the buffer is the correct length because this program assumes you know
+    // how to use matrices.
     EXTERN int
             evalSinglesWithSingle ( float *, MatrixOfSingles, size_y, float * );
     EXTERN int evalSinglesWithDouble ( double *,
@@ -235,6 +304,58 @@ extern "C" {
                                        size_y,
                                        long double * );
 
+    // B <- A * x for count vectors x at once, where the args are B, A, count,
+    // the length of each x, and the xs. The xs are back to back in one
+    // buffer, as are the results (each A.rows long). Enough vectors at once
+    // turn into one matrix product, which is much faster than as many evals.
+    EXTERN int evalBatchSinglesWithSingle ( float *,
+                                            MatrixOfSingles,
+                                            size_y,
+                                            size_y,
+                                            float * );
+    EXTERN int evalBatchSinglesWithDouble ( double *,
+                                            MatrixOfSingles,
+                                            size_y,
+                                            size_y,
+                                            double * );
+    EXTERN int evalBatchSinglesWithTriple ( long double *,
+                                            MatrixOfSingles,
+                                            size_y,
+                                            size_y,
+                                            long double * );
+
+    EXTERN int evalBatchDoublesWithSingle ( double *,
+                                            MatrixOfDoubles,
+                                            size_y,
+                                            size_y,
+                                            float * );
+    EXTERN int evalBatchDoublesWithDouble ( double *,
+                                            MatrixOfDoubles,
+                                            size_y,
+                                            size_y,
+                                            double * );
+    EXTERN int evalBatchDoublesWithTriple ( long double *,
+                                            MatrixOfDoubles,
+                                            size_y,
+                                            size_y,
+                                            long double * );
+
+    EXTERN int evalBatchTriplesWithSingle ( long double *,
+                                            MatrixOfTriples,
+                                            size_y,
+                                            size_y,
+                                            float * );
+    EXTERN int evalBatchTriplesWithDouble ( long double *,
+                                            MatrixOfTriples,
+                                            size_y,
+                                            size_y,
+                                            double * );
+    EXTERN int evalBatchTriplesWithTriple ( long double *,
+                                            MatrixOfTriples,
+                                            size_y,
+                                            size_y,
+                                            long double * );
+
     // dst <- lhs * rhs
     // it's scalar multiplication on matrices, what more is there to say?
     EXTERN void mulSinglesAndSingle ( MatrixOfSingles, MatrixOfSingles, float );
@@ -323,6 +444,648 @@ extern "C" {
     EXTERN int inverseOfDoubles ( MatrixOfDoubles, MatrixOfDoubles );
     EXTERN int inverseOfTriples ( MatrixOfTriples, MatrixOfTriples );
 
+    // LU factorizations, which factor a square matrix once so that solving
+    // with it, finding its determinant, or finding its inverse reuses the
+    // work. Like matrices, get the size of an LU, factor into a buffer that
+    // large, and pair the factorization with deleting it.
+    EXTERN void sizeofLUOfSingles ( size_y * );
+    EXTERN void sizeofLUOfDoubles ( size_y * );
+    EXTERN void sizeofLUOfTriples ( size_y * );
+
+    // lu <- the factorization of the matrix. Returns -1 (and constructs
+    // nothing) if the matrix is not square, 1 if the matrix is singular, and
+    // 0 otherwise.
+    EXTERN int factorLUOfSingles ( LUOfSingles, MatrixOfSingles );
+    EXTERN int factorLUOfDoubles ( LUOfDoubles, MatrixOfDoubles );
+    EXTERN int factorLUOfTriples ( LUOfTriples, MatrixOfTriples );
+
+    // x <- the solution of A * x = b where the first arg is x, the second is
+    // the factorization of A, the third is the length of b, and the fourth is
+    // b. Returns nonzero if the length is wrong or A is singular.
+    EXTERN int solveLUOfSingles ( float *, LUOfSingles, size_y, float * );
+    EXTERN int solveLUOfDoubles ( double *, LUOfDoubles, size_y, double * );
+    EXTERN int solveLUOfTriples ( long double *,
+                                  LUOfTriples,
+                                  size_y,
+                                  long double * );
+
+    EXTERN void determinantLUOfSingles ( LUOfSingles, float * );
+    EXTERN void determinantLUOfDoubles ( LUOfDoubles, double * );
+    EXTERN void determinantLUOfTriples ( LUOfTriples, long double * );
+
+    // dst <- the inverse of A. Returns nonzero if A is singular.
+    EXTERN int inverseLUOfSingles ( MatrixOfSingles, LUOfSingles );
+    EXTERN int inverseLUOfDoubles ( MatrixOfDoubles, LUOfDoubles );
+    EXTERN int inverseLUOfTriples ( MatrixOfTriples, LUOfTriples );
+
+    EXTERN void deleteLUOfSingles ( LUOfSingles );
+    EXTERN void deleteLUOfDoubles ( LUOfDoubles );
+    EXTERN void deleteLUOfTriples ( LUOfTriples );
+
+    // QR factorizations, for fitting: the x that minimizes the length of
+    // A * x - b for a matrix A with at least as many rows as columns. Used
+    // like an LU.
+    EXTERN void sizeofQROfSingles ( size_y * );
+    EXTERN void sizeofQROfDoubles ( size_y * );
+    EXTERN void sizeofQROfTriples ( size_y * );
+
+    // qr <- the factorization of the matrix, which may be any shape. Returns
+    // 1 if it has fewer rows than columns or is rank deficient, in which
+    // case it cannot be solved with, and 0 otherwise.
+    EXTERN int factorQROfSingles ( QROfSingles, MatrixOfSingles );
+    EXTERN int factorQROfDoubles ( QROfDoubles, MatrixOfDoubles );
+    EXTERN int factorQROfTriples ( QROfTriples, MatrixOfTriples );
+
+    // x <- the least squares solution of A * x = b where the first arg is x
+    // (one element per column of A), the second is the factorization of A,
+    // the third is the length of b, and the fourth is b. Returns nonzero if
+    // the length is not the row count of A or A cannot be solved with.
+    EXTERN int solveQROfSingles ( float *, QROfSingles, size_y, float * );
+    EXTERN int solveQROfDoubles ( double *, QROfDoubles, size_y, double * );
+    EXTERN int solveQROfTriples ( long double *,
+                                  QROfTriples,
+                                  size_y,
+                                  long double * );
+
+    // dst <- the first min ( rows, cols ) columns of Q, or rows of R.
+    EXTERN void orthogonalQROfSingles ( MatrixOfSingles, QROfSingles );
+    EXTERN void orthogonalQROfDoubles ( MatrixOfDoubles, QROfDoubles );
+    EXTERN void orthogonalQROfTriples ( MatrixOfTriples, QROfTriples );
+    EXTERN void triangularQROfSingles ( MatrixOfSingles, QROfSingles );
+    EXTERN void triangularQROfDoubles ( MatrixOfDoubles, QROfDoubles );
+    EXTERN void triangularQROfTriples ( MatrixOfTriples, QROfTriples );
+
+    EXTERN void deleteQROfSingles ( QROfSingles );
+    EXTERN void deleteQROfDoubles ( QROfDoubles );
+    EXTERN void deleteQROfTriples ( QROfTriples );
+
+    // the same as solveQR for a single b, without keeping the factorization
+    // around, where the second arg is A.
+    EXTERN int leastSquaresOfSingles ( float *,
+                                       MatrixOfSingles,
+                                       size_y,
+                                       float const * );
+    EXTERN int leastSquaresOfDoubles ( double *,
+                                       MatrixOfDoubles,
+                                       size_y,
+                                       double const * );
+    EXTERN int leastSquaresOfTriples ( long double *,
+                                       MatrixOfTriples,
+                                       size_y,
+                                       long double const * );
+
+    // the same as solveLU for a single b, without keeping the factorization
+    // around, where the second arg is A, and the last is set to the number
+    // of refinement steps taken. A is factored in float and the solution
+    // refined against A in full precision, which is nearly as fast as
+    // factoring in float and, unless A is badly conditioned, as accurate as
+    // solving in full precision. Returns -1 if A is not square, the length
+    // is wrong, or the factors are singular, 1 if the refinement stopped
+    // short of full precision (x is still the best found), and 0 otherwise.
+    EXTERN int refinedSolveOfDoubles ( double *,
+                                       MatrixOfDoubles,
+                                       size_y,
+                                       double const *,
+                                       size_y * );
+    EXTERN int refinedSolveOfTriples ( long double *,
+                                       MatrixOfTriples,
+                                       size_y,
+                                       long double const *,
+                                       size_y * );
+
+    // Cholesky factorizations of symmetric positive definite matrices, such
+    // as covariances, which take about half the work of an LU. Only the
+    // lower triangle of the matrix is read. Used like an LU.
+    EXTERN void sizeofCholeskyOfSingles ( size_y * );
+    EXTERN void sizeofCholeskyOfDoubles ( size_y * );
+    EXTERN void sizeofCholeskyOfTriples ( size_y * );
+
+    // chol <- the factorization of the matrix. Returns -1 (and constructs
+    // nothing) if the matrix is not square, k > 0 if the matrix is not
+    // positive definite because its leading k x k minor is not positive,
+    // and 0 otherwise. Delete the factorization either way.
+    EXTERN int factorCholeskyOfSingles ( CholeskyOfSingles, MatrixOfSingles );
+    EXTERN int factorCholeskyOfDoubles ( CholeskyOfDoubles, MatrixOfDoubles );
+    EXTERN int factorCholeskyOfTriples ( CholeskyOfTriples, MatrixOfTriples );
+
+    // as for solveLU. Returns nonzero if the length is wrong or A is not
+    // positive definite.
+    EXTERN int solveCholeskyOfSingles ( float *,
+                                        CholeskyOfSingles,
+                                        size_y,
+                                        float * );
+    EXTERN int solveCholeskyOfDoubles ( double *,
+                                        CholeskyOfDoubles,
+                                        size_y,
+                                        double * );
+    EXTERN int solveCholeskyOfTriples ( long double *,
+                                        CholeskyOfTriples,
+                                        size_y,
+                                        long double * );
+
+    // these return nonzero if A is not positive definite.
+    EXTERN int determinantCholeskyOfSingles ( CholeskyOfSingles, float * );
+    EXTERN int determinantCholeskyOfDoubles ( CholeskyOfDoubles, double * );
+    EXTERN int determinantCholeskyOfTriples ( CholeskyOfTriples,
+                                              long double * );
+    EXTERN int inverseCholeskyOfSingles ( MatrixOfSingles, CholeskyOfSingles );
+    EXTERN int inverseCholeskyOfDoubles ( MatrixOfDoubles, CholeskyOfDoubles );
+    EXTERN int inverseCholeskyOfTriples ( MatrixOfTriples, CholeskyOfTriples );
+
+    EXTERN void deleteCholeskyOfSingles ( CholeskyOfSingles );
+    EXTERN void deleteCholeskyOfDoubles ( CholeskyOfDoubles );
+    EXTERN void deleteCholeskyOfTriples ( CholeskyOfTriples );
+
+    // values <- the eigenvalues of the symmetric matrix, in ascending order
+    // (one per row), and vectors <- its eigenvectors, one per column, where
+    // the args are values, vectors, and the matrix. Only the lower triangle
+    // of the matrix is read. Returns -1 (and constructs nothing) if the
+    // matrix is not square, and 0 otherwise.
+    EXTERN int symmetricEigenOfSingles ( float *,
+                                         MatrixOfSingles,
+                                         MatrixOfSingles );
+    EXTERN int symmetricEigenOfDoubles ( double *,
+                                         MatrixOfDoubles,
+                                         MatrixOfDoubles );
+    EXTERN int symmetricEigenOfTriples ( long double *,
+                                         MatrixOfTriples,
+                                         MatrixOfTriples );
+
+    // the thin singular value decomposition A = U * diag ( s ) * V' of an
+    // m x n matrix, where the args are U (constructed m x k), s (k elements
+    // in descending order), V (constructed n x k), and A, for
+    // k = min ( m, n ).
+    EXTERN void svdOfSingles ( MatrixOfSingles,
+                               float *,
+                               MatrixOfSingles,
+                               MatrixOfSingles );
+    EXTERN void svdOfDoubles ( MatrixOfDoubles,
+                               double *,
+                               MatrixOfDoubles,
+                               MatrixOfDoubles );
+    EXTERN void svdOfTriples ( MatrixOfTriples,
+                               long double *,
+                               MatrixOfTriples,
+                               MatrixOfTriples );
+
+    // the leading rank singular values and vectors of an m x n matrix,
+    // approximately, from a randomized range finder: much faster than svdOf
+    // when rank is small. The args are U (constructed m x rank), s (rank
+    // elements), V (constructed n x rank), A, rank, and the random seed.
+    // Returns -1 (and constructs nothing) if rank is zero or more than
+    // min ( m, n ), and 0 otherwise.
+    EXTERN int randomizedSvdOfSingles ( MatrixOfSingles,
+                                        float *,
+                                        MatrixOfSingles,
+                                        MatrixOfSingles,
+                                        size_y,
+                                        size_y );
+    EXTERN int randomizedSvdOfDoubles ( MatrixOfDoubles,
+                                        double *,
+                                        MatrixOfDoubles,
+                                        MatrixOfDoubles,
+                                        size_y,
+                                        size_y );
+    EXTERN int randomizedSvdOfTriples ( MatrixOfTriples,
+                                        long double *,
+                                        MatrixOfTriples,
+                                        MatrixOfTriples,
+                                        size_y,
+                                        size_y );
+
+    // batches of many small matrices of one shape (e.g. 100000 3 x 3s),
+    // stored so that element i, j of every matrix is contiguous. Working on
+    // a whole batch at once is far faster than one matrix at a time. Like
+    // matrices, get the size of a batch, construct into a buffer that large,
+    // and pair constructing with deleting.
+    EXTERN void sizeofBatchOfSingles ( size_y * );
+    EXTERN void sizeofBatchOfDoubles ( size_y * );
+    EXTERN void sizeofBatchOfTriples ( size_y * );
+
+    // batch <- count matrices of rows x cols zeros, where the args are
+    // batch, count, rows, and cols.
+    EXTERN void constructBatchOfSingles ( BatchOfSingles,
+                                          size_y,
+                                          size_y,
+                                          size_y );
+    EXTERN void constructBatchOfDoubles ( BatchOfDoubles,
+                                          size_y,
+                                          size_y,
+                                          size_y );
+    EXTERN void constructBatchOfTriples ( BatchOfTriples,
+                                          size_y,
+                                          size_y,
+                                          size_y );
+
+    // the last arg <- a pointer to element row, col of every matrix in the
+    // batch, one per matrix in order, to read or fill without copying.
+    // Returns nonzero if row or col is out of range.
+    EXTERN int laneOfSingles ( BatchOfSingles, size_y, size_y, float ** );
+    EXTERN int laneOfDoubles ( BatchOfDoubles, size_y, size_y, double ** );
+    EXTERN int laneOfTriples ( BatchOfTriples,
+                               size_y,
+                               size_y,
+                               long double ** );
+
+    // C <- alpha * A * B + beta * C for every matrix, where the args are
+    // alpha, A, B, beta, and C. Returns nonzero (and changes nothing) if the
+    // batches do not line up or C is A or B.
+    EXTERN int gemmBatchOfSingles ( float,
+                                    BatchOfSingles,
+                                    BatchOfSingles,
+                                    float,
+                                    BatchOfSingles );
+    EXTERN int gemmBatchOfDoubles ( double,
+                                    BatchOfDoubles,
+                                    BatchOfDoubles,
+                                    double,
+                                    BatchOfDoubles );
+    EXTERN int gemmBatchOfTriples ( long double,
+                                    BatchOfTriples,
+                                    BatchOfTriples,
+                                    long double,
+                                    BatchOfTriples );
+
+    // dst <- the inverse of every matrix in src. Returns -1 if the matrices
+    // are not square, the batches do not line up, or dst is src, and
+    // otherwise the number of singular matrices, whose inverses are garbage.
+    EXTERN int inverseBatchOfSingles ( BatchOfSingles, BatchOfSingles );
+    EXTERN int inverseBatchOfDoubles ( BatchOfDoubles, BatchOfDoubles );
+    EXTERN int inverseBatchOfTriples ( BatchOfTriples, BatchOfTriples );
+
+    // B <- the solution X of A * X = B for every matrix, where the first arg
+    // is A and the second is B. Returns the same as the inverse.
+    EXTERN int solveBatchOfSingles ( BatchOfSingles, BatchOfSingles );
+    EXTERN int solveBatchOfDoubles ( BatchOfDoubles, BatchOfDoubles );
+    EXTERN int solveBatchOfTriples ( BatchOfTriples, BatchOfTriples );
+
+    EXTERN void deleteBatchOfSingles ( BatchOfSingles );
+    EXTERN void deleteBatchOfDoubles ( BatchOfDoubles );
+    EXTERN void deleteBatchOfTriples ( BatchOfTriples );
+
+    // sparse matrices, which only store their nonzero elements, compressed
+    // by rows (CSR) or by columns (CSC). Like matrices, get the size of a
+    // sparse matrix, construct into a buffer that large, and pair
+    // constructing with deleting.
+    EXTERN void sizeofSparseOfSingles ( size_y * );
+    EXTERN void sizeofSparseOfDoubles ( size_y * );
+    EXTERN void sizeofSparseOfTriples ( size_y * );
+
+    // sparse <- a rows x cols matrix from count elements in any order, where
+    // the args are sparse, rows, cols, count, the row of each element, the
+    // column of each, the value of each, and nonzero to compress by columns
+    // instead of rows. Elements given twice are summed. Returns nonzero (and
+    // constructs nothing) if an element is outside of the matrix.
+    EXTERN int constructSparseOfSingles ( SparseOfSingles,
+                                       size_y,
+                                       size_y,
+                                       size_y,
+                                       size_y const *,
+                                       size_y const *,
+                                       float const *,
+                                       int );
+    EXTERN int constructSparseOfDoubles ( SparseOfDoubles,
+                                       size_y,
+                                       size_y,
+                                       size_y,
+                                       size_y const *,
+                                       size_y const *,
+                                       double const *,
+                                       int );
+    EXTERN int constructSparseOfTriples ( SparseOfTriples,
+                                       size_y,
+                                       size_y,
+                                       size_y,
+                                       size_y const *,
+                                       size_y const *,
+                                       long double const *,
+                                       int );
+
+    // sparse <- the nonzero elements of a matrix, where the last arg is
+    // nonzero to compress by columns instead of rows.
+    EXTERN void toSparseOfSingles ( SparseOfSingles, MatrixOfSingles, int );
+    EXTERN void toSparseOfDoubles ( SparseOfDoubles, MatrixOfDoubles, int );
+    EXTERN void toSparseOfTriples ( SparseOfTriples, MatrixOfTriples, int );
+
+    // matrix <- the sparse matrix with all of its zeros.
+    EXTERN void toDenseOfSingles ( MatrixOfSingles, SparseOfSingles );
+    EXTERN void toDenseOfDoubles ( MatrixOfDoubles, SparseOfDoubles );
+    EXTERN void toDenseOfTriples ( MatrixOfTriples, SparseOfTriples );
+
+    EXTERN void countNonZerosOfSingles ( SparseOfSingles, size_y * );
+    EXTERN void countNonZerosOfDoubles ( SparseOfDoubles, size_y * );
+    EXTERN void countNonZerosOfTriples ( SparseOfTriples, size_y * );
+
+    // dst <- sparse * vec, where the args are dst (one element per row),
+    // sparse, the length of vec, and vec. Returns nonzero if the length is
+    // not the number of columns.
+    EXTERN int evalSparseOfSingles ( float *,
+                                     SparseOfSingles,
+                                     size_y,
+                                     float const * );
+    EXTERN int evalSparseOfDoubles ( double *,
+                                     SparseOfDoubles,
+                                     size_y,
+                                     double const * );
+    EXTERN int evalSparseOfTriples ( long double *,
+                                     SparseOfTriples,
+                                     size_y,
+                                     long double const * );
+
+    // dst <- sparse * matrix, where mulSparse constructs dst and
+    // mulIntoSparse writes into a dst that already has the right shape.
+    // Both return nonzero (and change nothing) if the shapes do not line up,
+    // and mulIntoSparse also if dst is the matrix.
+    EXTERN int mulSparseOfSingles ( MatrixOfSingles,
+                                    SparseOfSingles,
+                                    MatrixOfSingles );
+    EXTERN int mulSparseOfDoubles ( MatrixOfDoubles,
+                                    SparseOfDoubles,
+                                    MatrixOfDoubles );
+    EXTERN int mulSparseOfTriples ( MatrixOfTriples,
+                                    SparseOfTriples,
+                                    MatrixOfTriples );
+    EXTERN int mulIntoSparseOfSingles ( MatrixOfSingles,
+                                        SparseOfSingles,
+                                        MatrixOfSingles );
+    EXTERN int mulIntoSparseOfDoubles ( MatrixOfDoubles,
+                                        SparseOfDoubles,
+                                        MatrixOfDoubles );
+    EXTERN int mulIntoSparseOfTriples ( MatrixOfTriples,
+                                        SparseOfTriples,
+                                        MatrixOfTriples );
+
+    EXTERN void deleteSparseOfSingles ( SparseOfSingles );
+    EXTERN void deleteSparseOfDoubles ( SparseOfDoubles );
+    EXTERN void deleteSparseOfTriples ( SparseOfTriples );
+
+    // quantized matrices, which hold a matrix of floats as 8 bit integers
+    // with a scale per row or per column, and multiply them on integer
+    // kernels. Like matrices, get the size of a quantized matrix, construct
+    // into a buffer that large, and pair constructing with deleting.
+    EXTERN void sizeofQuantizedOfSingles ( size_y * );
+
+    // quantized <- matrix, where the args are quantized, matrix, nonzero for
+    // a zero point per scale instead of symmetric, and nonzero for a scale
+    // per column instead of per row.
+    EXTERN void quantizeOfSingles ( QuantizedOfSingles,
+                                    MatrixOfSingles,
+                                    int,
+                                    int );
+
+    // matrix <- the floats that the quantized matrix stands for.
+    EXTERN void dequantizeOfSingles ( MatrixOfSingles, QuantizedOfSingles );
+
+    // dst <- quantized * vec, where the args are dst (one element per row),
+    // quantized, the length of vec, and vec. Returns nonzero if the length
+    // is not the number of columns.
+    EXTERN int evalQuantizedOfSingles ( float *,
+                                        QuantizedOfSingles,
+                                        size_y,
+                                        float const * );
+
+    // dst <- lhs * rhs, which constructs dst. Returns nonzero (and
+    // constructs nothing) if the shapes do not line up, or, for two
+    // quantized matrices, unless lhs has a scale per row and rhs per column.
+    EXTERN int mulQuantizedOfSingles ( MatrixOfSingles,
+                                       QuantizedOfSingles,
+                                       QuantizedOfSingles );
+    EXTERN int mulQuantizedAndMatrixOfSingles ( MatrixOfSingles,
+                                                QuantizedOfSingles,
+                                                MatrixOfSingles );
+
+    EXTERN void deleteQuantizedOfSingles ( QuantizedOfSingles );
+
+    // in place updates, which write into the storage the destination already
+    // has instead of constructing a new matrix. The ones that return int
+    // return nonzero (and change nothing) if the shapes do not line up.
+
+    // dst <- dst + src and dst <- dst - src
+    EXTERN int addAssignOfSingles ( MatrixOfSingles, MatrixOfSingles );
+    EXTERN int addAssignOfDoubles ( MatrixOfDoubles, MatrixOfDoubles );
+    EXTERN int addAssignOfTriples ( MatrixOfTriples, MatrixOfTriples );
+    EXTERN int subAssignOfSingles ( MatrixOfSingles, MatrixOfSingles );
+    EXTERN int subAssignOfDoubles ( MatrixOfDoubles, MatrixOfDoubles );
+    EXTERN int subAssignOfTriples ( MatrixOfTriples, MatrixOfTriples );
+
+    // dst <- dst * x and dst <- dst / x
+    EXTERN void mulAssignOfSingles ( MatrixOfSingles, float );
+    EXTERN void mulAssignOfDoubles ( MatrixOfDoubles, double );
+    EXTERN void mulAssignOfTriples ( MatrixOfTriples, long double );
+    EXTERN void divAssignOfSingles ( MatrixOfSingles, float );
+    EXTERN void divAssignOfDoubles ( MatrixOfDoubles, double );
+    EXTERN void divAssignOfTriples ( MatrixOfTriples, long double );
+
+    // dst <- alpha * src + dst
+    EXTERN int axpyOfSingles ( MatrixOfSingles, float, MatrixOfSingles );
+    EXTERN int axpyOfDoubles ( MatrixOfDoubles, double, MatrixOfDoubles );
+    EXTERN int
+            axpyOfTriples ( MatrixOfTriples, long double, MatrixOfTriples );
+
+    // C <- alpha * A * B + beta * C, where the args are alpha, A, B, beta,
+    // and C. C is not read when beta is zero.
+    EXTERN int gemmOfSingles ( float,
+                               MatrixOfSingles,
+                               MatrixOfSingles,
+                               float,
+                               MatrixOfSingles );
+    EXTERN int gemmOfDoubles ( double,
+                               MatrixOfDoubles,
+                               MatrixOfDoubles,
+                               double,
+                               MatrixOfDoubles );
+    EXTERN int gemmOfTriples ( long double,
+                               MatrixOfTriples,
+                               MatrixOfTriples,
+                               long double,
+                               MatrixOfTriples );
+
+    // add, sub, mul, augment, and echelon from above, but written into dst,
+    // a matrix the caller has already constructed with the shape of the
+    // result, instead of into a newly constructed one. Once the thread pool
+    // and the GEMM workspace have warmed up, these make no heap allocations.
+    // They return nonzero (and change nothing) if the shapes do not line up,
+    // or if dst is one of the operands of a product or an augment.
+
+    // dst <- a + b
+    EXTERN int addIntoSinglesAndSingles ( MatrixOfSingles,
+                                          MatrixOfSingles,
+                                          MatrixOfSingles );
+    EXTERN int addIntoSinglesAndDoubles ( MatrixOfDoubles,
+                                          MatrixOfSingles,
+                                          MatrixOfDoubles );
+    EXTERN int addIntoSinglesAndTriples ( MatrixOfTriples,
+                                          MatrixOfSingles,
+                                          MatrixOfTriples );
+    EXTERN int addIntoDoublesAndSingles ( MatrixOfDoubles,
+                                          MatrixOfDoubles,
+                                          MatrixOfSingles );
+    EXTERN int addIntoDoublesAndDoubles ( MatrixOfDoubles,
+                                          MatrixOfDoubles,
+                                          MatrixOfDoubles );
+    EXTERN int addIntoDoublesAndTriples ( MatrixOfTriples,
+                                          MatrixOfDoubles,
+                                          MatrixOfTriples );
+    EXTERN int addIntoTriplesAndSingles ( MatrixOfTriples,
+                                          MatrixOfTriples,
+                                          MatrixOfSingles );
+    EXTERN int addIntoTriplesAndDoubles ( MatrixOfTriples,
+                                          MatrixOfTriples,
+                                          MatrixOfDoubles );
+    EXTERN int addIntoTriplesAndTriples ( MatrixOfTriples,
+                                          MatrixOfTriples,
+                                          MatrixOfTriples );
+
+    // dst <- a - b
+    EXTERN int subIntoSinglesAndSingles ( MatrixOfSingles,
+                                          MatrixOfSingles,
+                                          MatrixOfSingles );
+    EXTERN int subIntoSinglesAndDoubles ( MatrixOfDoubles,
+                                          MatrixOfSingles,
+                                          MatrixOfDoubles );
+    EXTERN int subIntoSinglesAndTriples ( MatrixOfTriples,
+                                          MatrixOfSingles,
+                                          MatrixOfTriples );
+    EXTERN int subIntoDoublesAndSingles ( MatrixOfDoubles,
+                                          MatrixOfDoubles,
+                                          MatrixOfSingles );
+    EXTERN int subIntoDoublesAndDoubles ( MatrixOfDoubles,
+                                          MatrixOfDoubles,
+                                          MatrixOfDoubles );
+    EXTERN int subIntoDoublesAndTriples ( MatrixOfTriples,
+                                          MatrixOfDoubles,
+                                          MatrixOfTriples );
+    EXTERN int subIntoTriplesAndSingles ( MatrixOfTriples,
+                                          MatrixOfTriples,
+                                          MatrixOfSingles );
+    EXTERN int subIntoTriplesAndDoubles ( MatrixOfTriples,
+                                          MatrixOfTriples,
+                                          MatrixOfDoubles );
+    EXTERN int subIntoTriplesAndTriples ( MatrixOfTriples,
+                                          MatrixOfTriples,
+                                          MatrixOfTriples );
+
+    // dst <- a * b
+    EXTERN int mulIntoSinglesAndSingles ( MatrixOfSingles,
+                                          MatrixOfSingles,
+                                          MatrixOfSingles );
+    EXTERN int mulIntoSinglesAndDoubles ( MatrixOfDoubles,
+                                          MatrixOfSingles,
+                                          MatrixOfDoubles );
+    EXTERN int mulIntoSinglesAndTriples ( MatrixOfTriples,
+                                          MatrixOfSingles,
+                                          MatrixOfTriples );
+    EXTERN int mulIntoDoublesAndSingles ( MatrixOfDoubles,
+                                          MatrixOfDoubles,
+                                          MatrixOfSingles );
+    EXTERN int mulIntoDoublesAndDoubles ( MatrixOfDoubles,
+                                          MatrixOfDoubles,
+                                          MatrixOfDoubles );
+    EXTERN int mulIntoDoublesAndTriples ( MatrixOfTriples,
+                                          MatrixOfDoubles,
+                                          MatrixOfTriples );
+    EXTERN int mulIntoTriplesAndSingles ( MatrixOfTriples,
+                                          MatrixOfTriples,
+                                          MatrixOfSingles );
+    EXTERN int mulIntoTriplesAndDoubles ( MatrixOfTriples,
+                                          MatrixOfTriples,
+                                          MatrixOfDoubles );
+    EXTERN int mulIntoTriplesAndTriples ( MatrixOfTriples,
+                                          MatrixOfTriples,
+                                          MatrixOfTriples );
+
+    // dst <- a augmented with b
+    EXTERN int augmentIntoSinglesAndSingles ( MatrixOfSingles,
+                                              MatrixOfSingles,
+                                              MatrixOfSingles );
+    EXTERN int augmentIntoSinglesAndDoubles ( MatrixOfDoubles,
+                                              MatrixOfSingles,
+                                              MatrixOfDoubles );
+    EXTERN int augmentIntoSinglesAndTriples ( MatrixOfTriples,
+                                              MatrixOfSingles,
+                                              MatrixOfTriples );
+    EXTERN int augmentIntoDoublesAndSingles ( MatrixOfDoubles,
+                                              MatrixOfDoubles,
+                                              MatrixOfSingles );
+    EXTERN int augmentIntoDoublesAndDoubles ( MatrixOfDoubles,
+                                              MatrixOfDoubles,
+                                              MatrixOfDoubles );
+    EXTERN int augmentIntoDoublesAndTriples ( MatrixOfTriples,
+                                              MatrixOfDoubles,
+                                              MatrixOfTriples );
+    EXTERN int augmentIntoTriplesAndSingles ( MatrixOfTriples,
+                                              MatrixOfTriples,
+                                              MatrixOfSingles );
+    EXTERN int augmentIntoTriplesAndDoubles ( MatrixOfTriples,
+                                              MatrixOfTriples,
+                                              MatrixOfDoubles );
+    EXTERN int augmentIntoTriplesAndTriples ( MatrixOfTriples,
+                                              MatrixOfTriples,
+                                              MatrixOfTriples );
+
+    // dst <- a * x
+    EXTERN int mulIntoSinglesAndSingle ( MatrixOfSingles,
+                                         MatrixOfSingles,
+                                         float );
+    EXTERN int mulIntoSinglesAndDouble ( MatrixOfDoubles,
+                                         MatrixOfSingles,
+                                         double );
+    EXTERN int mulIntoSinglesAndTriple ( MatrixOfTriples,
+                                         MatrixOfSingles,
+                                         long double );
+    EXTERN int mulIntoDoublesAndSingle ( MatrixOfDoubles,
+                                         MatrixOfDoubles,
+                                         float );
+    EXTERN int mulIntoDoublesAndDouble ( MatrixOfDoubles,
+                                         MatrixOfDoubles,
+                                         double );
+    EXTERN int mulIntoDoublesAndTriple ( MatrixOfTriples,
+                                         MatrixOfDoubles,
+                                         long double );
+    EXTERN int mulIntoTriplesAndSingle ( MatrixOfTriples,
+                                         MatrixOfTriples,
+                                         float );
+    EXTERN int mulIntoTriplesAndDouble ( MatrixOfTriples,
+                                         MatrixOfTriples,
+                                         double );
+    EXTERN int mulIntoTriplesAndTriple ( MatrixOfTriples,
+                                         MatrixOfTriples,
+                                         long double );
+
+    // dst <- a / x
+    EXTERN int divIntoSinglesAndSingle ( MatrixOfSingles,
+                                         MatrixOfSingles,
+                                         float );
+    EXTERN int divIntoSinglesAndDouble ( MatrixOfDoubles,
+                                         MatrixOfSingles,
+                                         double );
+    EXTERN int divIntoSinglesAndTriple ( MatrixOfTriples,
+                                         MatrixOfSingles,
+                                         long double );
+    EXTERN int divIntoDoublesAndSingle ( MatrixOfDoubles,
+                                         MatrixOfDoubles,
+                                         float );
+    EXTERN int divIntoDoublesAndDouble ( MatrixOfDoubles,
+                                         MatrixOfDoubles,
+                                         double );
+    EXTERN int divIntoDoublesAndTriple ( MatrixOfTriples,
+                                         MatrixOfDoubles,
+                                         long double );
+    EXTERN int divIntoTriplesAndSingle ( MatrixOfTriples,
+                                         MatrixOfTriples,
+                                         float );
+    EXTERN int divIntoTriplesAndDouble ( MatrixOfTriples,
+                                         MatrixOfTriples,
+                                         double );
+    EXTERN int divIntoTriplesAndTriple ( MatrixOfTriples,
+                                         MatrixOfTriples,
+                                         long double );
+
+    // dst <- rref ( a ), where dst may be a itself.
+    EXTERN int echelonIntoOfSingles ( MatrixOfSingles, MatrixOfSingles );
+    EXTERN int echelonIntoOfDoubles ( MatrixOfDoubles, MatrixOfDoubles );
+    EXTERN int echelonIntoOfTriples ( MatrixOfTriples, MatrixOfTriples );
+
     // returns nonzero if equal
     EXTERN int compareSinglesAndSingles ( MatrixOfSingles, MatrixOfSingles );
     EXTERN int compareSinglesAndDoubles ( MatrixOfSingles, MatrixOfDoubles );
@@ -334,6 +1097,13 @@ extern "C" {
     EXTERN int compareTriplesAndDoubles ( MatrixOfTriples, MatrixOfDoubles );
     EXTERN int compareTriplesAndTriples ( MatrixOfTriples, MatrixOfTriples );
 
+    // the number of threads ML splits its work across, including the calling
+    // thread. Setting zero uses one thread per hardware thread. Do not set
+    // this while another thread is inside of ML. The workers are not joined
+    // at exit; setting one joins them, e.g. before unloading the library.
+    EXTERN void setThreadCount ( size_y );
+    EXTERN void countThreads ( size_y * );
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
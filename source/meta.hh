@@ -27,9 +27,43 @@
 #    define CONCEPT_NAMESPACE_END }
 #endif
 
+#include <type_traits>
+
+namespace ml
+{
+    /**
+     * @brief Whether F can be the element type of a matrix. Specialize this
+     * for number types that are not built into C++ (e.g. DoubleDouble) and
+     * behave like floating point: arithmetic, comparisons, abs and sqrt
+     * found by argument dependent lookup, and std::numeric_limits.
+     */
+    template < class F > struct IsFloating : std::is_floating_point< F >
+    {
+    };
+} // namespace ml
+
+// if C++ 20, then use concepts to require floating point types.
+// otherwise, just alias the term "Floating" to "class"
+CONCEPT_NAMESPACE_BEGIN
+#if HAS_CONCEPTS
+template < class F >
+concept Floating = ml::IsFloating< F >::value;
+#else
+#    define Floating class
+#endif
+CONCEPT_NAMESPACE_END
+
 // all versions of C++ that we target use noexcept
 #define NOEXCEPT noexcept
 
+// constexpr for functions with loops and more than one statement, which
+// C++ 11 does not allow.
+#if __cplusplus >= 201402L
+#    define CONSTEXPR14 constexpr
+#else
+#    define CONSTEXPR14 inline
+#endif
+
 /**
  * @brief Single precision floating point. Certain tricks may be accelerated if
  * this happens to be IEEE-754 compliant and in binary format.
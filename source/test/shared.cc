@@ -13,13 +13,27 @@
 
 #include "intf/ml.hh"
 
+#include <cmath>
 #include <iostream>
+#include <vector>
 
 void testMatrixAllocateAndFill ( );
 void testMatrixVectorMultiplication ( );
 void testMatrixMatrixMultiplication ( );
 void testEchelon ( );
 void testInverse ( );
+void testThreadCount ( );
+void testLU ( );
+void testInPlace ( );
+void testInto ( );
+void testBuffers ( );
+void testBatch ( );
+void testSmallBatches ( );
+void testSparse ( );
+void testCholesky ( );
+void testQR ( );
+void testEigen ( );
+void testQuantized ( );
 
 int main ( int const argc, char const *const *const argv )
 {
@@ -28,6 +42,551 @@ int main ( int const argc, char const *const *const argv )
     testMatrixMatrixMultiplication ( );
     testEchelon ( );
     testInverse ( );
+    testThreadCount ( );
+    testLU ( );
+    testInPlace ( );
+    testInto ( );
+    testBuffers ( );
+    testBatch ( );
+    testSmallBatches ( );
+    testSparse ( );
+    testCholesky ( );
+    testQR ( );
+    testEigen ( );
+    testQuantized ( );
+}
+
+void testInPlace ( )
+{
+    unsigned long long int size = 0;
+    sizeofMatrixOfDoubles ( &size );
+    MatrixOfDoubles a = std::malloc ( size );
+    MatrixOfDoubles c = std::malloc ( size );
+    constructMatrixOfDoubles ( a, 2, 2 );
+    identityOfDoubles ( c, 2 );
+    double values [] = { 1, 2, 3, 4 };
+    for ( std::size_t i = 0; i < 4; i++ )
+    {
+        setIndexOfDoubles ( a, i / 2, i % 2, values [ i ] );
+    }
+
+    // c <- 2 * a * a - c, then c <- c + 1 * a, then c <- c * 2
+    gemmOfDoubles ( 2, a, a, -1, c );
+    axpyOfDoubles ( c, 1, a );
+    mulAssignOfDoubles ( c, 2 );
+
+    std::cout << "Expected: 28 44 66 94\n";
+    std::cout << "Actual  : ";
+    for ( std::size_t i = 0; i < 4; i++ )
+    {
+        double temp = 0;
+        getIndexOfDoubles ( c, i / 2, i % 2, &temp );
+        std::cout << temp << " ";
+    }
+    std::cout << "\n";
+
+    deleteMatrixOfDoubles ( a );
+    deleteMatrixOfDoubles ( c );
+}
+
+void testSparse ( )
+{
+    unsigned long long int size = 0;
+    sizeofSparseOfDoubles ( &size );
+    SparseOfDoubles sparse = std::malloc ( size );
+    SparseOfDoubles bad    = std::malloc ( size );
+    sizeofMatrixOfDoubles ( &size );
+    MatrixOfDoubles dense   = std::malloc ( size );
+    MatrixOfDoubles rhs     = std::malloc ( size );
+    MatrixOfDoubles product = std::malloc ( size );
+
+    // [0,2,0;1,0,3] with the 3 given as 1 + 2.
+    size_y const rows [] = { 0, 1, 1, 1 };
+    size_y const cols [] = { 1, 0, 2, 2 };
+    double const vals [] = { 2, 1, 1, 2 };
+    std::cout << "Expected: 0 then -1 for an element outside, 3 nonzeros\n";
+    int const built = constructSparseOfDoubles ( sparse, 2, 3, 4, rows, cols, vals, 1 );
+    int const outside = constructSparseOfDoubles ( bad, 2, 2, 4, rows, cols, vals, 0 );
+    countNonZerosOfDoubles ( sparse, &size );
+    std::cout << "Actual  : " << built << " then " << outside << " for an element outside, "
+              << size << " nonzeros\n";
+
+    double const x [] = { 1, 2, 3 };
+    double       y [] = { 0, 0 };
+    evalSparseOfDoubles ( y, sparse, 3, x );
+    std::cout << "Expected: [4;10]\n";
+    std::cout << "Actual  : [" << y [ 0 ] << ";" << y [ 1 ] << "]\n";
+
+    toDenseOfDoubles ( dense, sparse );
+    constructMatrixOfDoubles ( rhs, 3, 2 );
+    double const ones [] = { 1, 1, 1, 1, 1, 1 };
+    copyFromRowMajorOfDoubles ( rhs, ones, 2 );
+    double out [ 4 ] = { 0, 0, 0, 0 };
+    bool const multiplied = mulSparseOfDoubles ( product, sparse, rhs ) == 0
+                         && copyToRowMajorOfDoubles ( product, out, 2 ) == 0;
+    std::cout << "Does sparse times ones give the row sums [2,2;4,4]? "
+              << ( multiplied && out [ 0 ] == 2 && out [ 1 ] == 2 && out [ 2 ] == 4
+                                   && out [ 3 ] == 4
+                           ? "Yes"
+                           : "No" )
+              << "\n";
+    std::cout << "Does multiplying by a matrix of the wrong shape fail? "
+              << ( mulIntoSparseOfDoubles ( product, sparse, dense ) == -1 ? "Yes" : "No" )
+              << "\n";
+
+    deleteSparseOfDoubles ( sparse );
+    std::free ( bad );
+    deleteMatrixOfDoubles ( dense );
+    deleteMatrixOfDoubles ( rhs );
+    deleteMatrixOfDoubles ( product );
+}
+
+void testSmallBatches ( )
+{
+    unsigned long long int size = 0;
+    sizeofBatchOfDoubles ( &size );
+    BatchOfDoubles mat = std::malloc ( size );
+    BatchOfDoubles rhs = std::malloc ( size );
+    BatchOfDoubles inv = std::malloc ( size );
+    std::size_t const count = 10000;
+    constructBatchOfDoubles ( mat, count, 2, 2 );
+    constructBatchOfDoubles ( rhs, count, 2, 1 );
+    constructBatchOfDoubles ( inv, count, 2, 2 );
+
+    // matrix k is [0,k;2,1] and its right hand side is [k;3], so x = [1;1].
+    double *a00 = nullptr, *a01 = nullptr, *a10 = nullptr, *a11 = nullptr;
+    double *b0 = nullptr, *b1 = nullptr;
+    laneOfDoubles ( mat, 0, 0, &a00 );
+    laneOfDoubles ( mat, 0, 1, &a01 );
+    laneOfDoubles ( mat, 1, 0, &a10 );
+    laneOfDoubles ( mat, 1, 1, &a11 );
+    laneOfDoubles ( rhs, 0, 0, &b0 );
+    laneOfDoubles ( rhs, 1, 0, &b1 );
+    for ( std::size_t k = 0; k < count; k++ )
+    {
+        a00 [ k ] = 0;
+        a01 [ k ] = double ( k );
+        a10 [ k ] = 2;
+        a11 [ k ] = 1;
+        b0 [ k ]  = double ( k );
+        b1 [ k ]  = 3;
+    }
+    std::cout << "Expected: 1 singular, -1 for a lane out of range\n";
+    std::cout << "Actual  : " << solveBatchOfDoubles ( mat, rhs ) << " singular, "
+              << laneOfDoubles ( mat, 2, 0, &a00 ) << " for a lane out of range\n";
+
+    bool solved = true;
+    for ( std::size_t k = 1; k < count; k++ )
+    {
+        solved = solved && b0 [ k ] == 1 && b1 [ k ] == 1;
+    }
+    std::cout << "Does every nonsingular system solve to [1;1]? "
+              << ( solved ? "Yes" : "No" ) << "\n";
+    std::cout << "Does inverting into a batch of the wrong shape fail? "
+              << ( inverseBatchOfDoubles ( rhs, mat ) == -1 ? "Yes" : "No" ) << "\n";
+
+    deleteBatchOfDoubles ( mat );
+    deleteBatchOfDoubles ( rhs );
+    deleteBatchOfDoubles ( inv );
+}
+
+void testBatch ( )
+{
+    unsigned long long int size = 0;
+    sizeofMatrixOfDoubles ( &size );
+    MatrixOfDoubles mat = std::malloc ( size );
+    constructMatrixOfDoubles ( mat, 3, 3 );
+    double matrix [] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    copyFromRowMajorOfDoubles ( mat, matrix, 3 );
+
+    // enough vectors for one matrix product, each ( i, 1, 0 ).
+    std::size_t const   count = 5000;
+    std::vector< double > vectors ( 3 * count, 0 );
+    std::vector< double > results ( 3 * count, 0 );
+    for ( std::size_t i = 0; i < count; i++ )
+    {
+        vectors [ 3 * i ]     = double ( i );
+        vectors [ 3 * i + 1 ] = 1;
+    }
+    evalBatchDoublesWithDouble ( results.data ( ), mat, count, 3, vectors.data ( ) );
+
+    bool matches = true;
+    for ( std::size_t i = 0; i < count; i++ )
+    {
+        double one [ 3 ];
+        evalDoublesWithDouble ( one, mat, 3, vectors.data ( ) + 3 * i );
+        for ( std::size_t j = 0; j < 3; j++ )
+        {
+            matches = matches && one [ j ] == results [ 3 * i + j ]
+                   && one [ j ] == matrix [ 3 * j ] * double ( i ) + matrix [ 3 * j + 1 ];
+        }
+    }
+    std::cout << "Does every batched result match its own eval? "
+              << ( matches ? "Yes" : "No" ) << "\n";
+
+    deleteMatrixOfDoubles ( mat );
+}
+
+void testBuffers ( )
+{
+    unsigned long long int size = 0;
+    sizeofMatrixOfDoubles ( &size );
+    MatrixOfDoubles wrapped = std::malloc ( size );
+    MatrixOfDoubles copy    = std::malloc ( size );
+
+    // [1,2,3;4,5,6] in row-major order.
+    double buffer [] = { 1, 2, 3, 4, 5, 6 };
+    double columns [ 6 ];
+    wrapRowMajorOfDoubles ( wrapped, buffer, 2, 3, 3 );
+    mulAssignOfDoubles ( wrapped, 2 );
+    copyToColMajorOfDoubles ( wrapped, columns, 2 );
+
+    std::cout << "Expected: 2 8 4 10 6 12\n";
+    std::cout << "Actual  : ";
+    for ( double x : columns ) { std::cout << x << " "; }
+    std::cout << "\n";
+
+    constructMatrixOfDoubles ( copy, 2, 3 );
+    copyFromColMajorOfDoubles ( copy, columns, 2 );
+    std::cout << "Does copying back in give the same matrix? "
+              << ( compareDoublesAndDoubles ( copy, wrapped ) ? "Yes" : "No" )
+              << "\n";
+    std::cout << "Does a short leading dimension fail? "
+              << ( copyToRowMajorOfDoubles ( copy, columns, 2 ) != 0 ? "Yes" : "No" )
+              << "\n";
+
+    deleteMatrixOfDoubles ( wrapped );
+    deleteMatrixOfDoubles ( copy );
+}
+
+void testInto ( )
+{
+    unsigned long long int size = 0;
+    sizeofMatrixOfDoubles ( &size );
+    MatrixOfDoubles a   = std::malloc ( size );
+    MatrixOfDoubles dst = std::malloc ( size );
+    MatrixOfDoubles row = std::malloc ( size );
+    constructMatrixOfDoubles ( a, 2, 2 );
+    constructMatrixOfDoubles ( dst, 2, 2 );
+    constructMatrixOfDoubles ( row, 1, 2 );
+    double values [] = { 1, 2, 3, 4 };
+    for ( std::size_t i = 0; i < 4; i++ )
+    {
+        setIndexOfDoubles ( a, i / 2, i % 2, values [ i ] );
+    }
+
+    // the same dst every time around, as a caller in a loop would.
+    for ( std::size_t i = 0; i < 3; i++ )
+    {
+        mulIntoDoublesAndDoubles ( dst, a, a );
+        addIntoDoublesAndDoubles ( dst, dst, a );
+        divIntoDoublesAndDouble ( dst, dst, 2 );
+    }
+
+    std::cout << "Expected: 4 6 9 13\n";
+    std::cout << "Actual  : ";
+    for ( std::size_t i = 0; i < 4; i++ )
+    {
+        double temp = 0;
+        getIndexOfDoubles ( dst, i / 2, i % 2, &temp );
+        std::cout << temp << " ";
+    }
+    std::cout << "\n";
+
+    std::cout << "Does a destination of the wrong shape fail? "
+              << ( addIntoDoublesAndDoubles ( row, a, a ) != 0 ? "Yes" : "No" )
+              << "\n";
+    std::cout << "Does a product into its own operand fail? "
+              << ( mulIntoDoublesAndDoubles ( a, a, a ) != 0 ? "Yes" : "No" )
+              << "\n";
+
+    deleteMatrixOfDoubles ( a );
+    deleteMatrixOfDoubles ( dst );
+    deleteMatrixOfDoubles ( row );
+}
+
+void testQR ( )
+{
+    unsigned long long int size   = 0;
+    MatrixOfDoubles        matrix = nullptr;
+    MatrixOfDoubles        r      = nullptr;
+    QROfDoubles            qr     = nullptr;
+
+    sizeofMatrixOfDoubles ( &size );
+    matrix = std::malloc ( size );
+    r      = std::malloc ( size );
+    sizeofQROfDoubles ( &size );
+    qr = std::malloc ( size );
+
+    // the line through ( 0, 1 ), ( 1, 2 ), ( 2, 2 ), and ( 3, 5 ).
+    constructMatrixOfDoubles ( matrix, 4, 2 );
+    for ( std::size_t i = 0; i < 4; i++ )
+    {
+        setIndexOfDoubles ( matrix, i, 0, 1 );
+        setIndexOfDoubles ( matrix, i, 1, double ( i ) );
+    }
+    double b [ 4 ]   = { 1, 2, 2, 5 };
+    double fit [ 2 ] = { 0, 0 };
+    double x [ 2 ]   = { 0, 0 };
+    double corner    = 0;
+    int    status    = factorQROfDoubles ( qr, matrix );
+    solveQROfDoubles ( fit, qr, 4, b );
+    leastSquaresOfDoubles ( x, matrix, 4, b );
+    triangularQROfDoubles ( r, qr );
+    getIndexOfDoubles ( r, 0, 0, &corner );
+
+    // the first column of A has length 2, so R starts with -2 or 2.
+    std::cout << "Expected: status = 0, |r00| = 2, fit = 0.7 1.2 twice\n";
+    std::cout << "Actual  : status = " << status
+              << ", |r00| = " << std::abs ( corner ) << ", fit = " << fit [ 0 ]
+              << " " << fit [ 1 ] << " and " << x [ 0 ] << " " << x [ 1 ]
+              << "\n";
+
+    deleteQROfDoubles ( qr );
+    deleteMatrixOfDoubles ( r );
+    deleteMatrixOfDoubles ( matrix );
+    qr     = nullptr;
+    r      = nullptr;
+    matrix = nullptr;
+}
+
+void testCholesky ( )
+{
+    unsigned long long int size   = 0;
+    MatrixOfDoubles        matrix = nullptr;
+    CholeskyOfDoubles      chol   = nullptr;
+
+    sizeofMatrixOfDoubles ( &size );
+    matrix = std::malloc ( size );
+    sizeofCholeskyOfDoubles ( &size );
+    chol = std::malloc ( size );
+
+    double values [] = { 4, 12, -16, 12, 37, -43, -16, -43, 98 };
+    constructMatrixOfDoubles ( matrix, 3, 3 );
+    for ( std::size_t r = 0; r < 3; r++ )
+    {
+        for ( std::size_t c = 0; c < 3; c++ )
+        {
+            setIndexOfDoubles ( matrix, r, c, values [ 3 * r + c ] );
+        }
+    }
+
+    double b [ 3 ] = { -40, -111, 223 };
+    double x [ 3 ] = { 0, 0, 0 };
+    double det     = 0;
+    int    status  = factorCholeskyOfDoubles ( chol, matrix );
+    solveCholeskyOfDoubles ( x, chol, 3, b );
+    determinantCholeskyOfDoubles ( chol, &det );
+    deleteCholeskyOfDoubles ( chol );
+
+    std::cout << "Expected: status = 0, det = 36, x = 1 -1 2\n";
+    std::cout << "Actual  : status = " << status << ", det = " << det
+              << ", x = " << x [ 0 ] << " " << x [ 1 ] << " " << x [ 2 ]
+              << "\n";
+
+    // the leading 2 x 2 minor of this one is 4 * 35 - 12 * 12 < 0.
+    chol = std::malloc ( size );
+    setIndexOfDoubles ( matrix, 1, 1, 35 );
+    status = factorCholeskyOfDoubles ( chol, matrix );
+    std::cout << "Expected: status = 2, solve fails\n";
+    std::cout << "Actual  : status = " << status << ", solve "
+              << ( solveCholeskyOfDoubles ( x, chol, 3, b ) != 0 ? "fails"
+                                                                 : "works" )
+              << "\n";
+
+    deleteCholeskyOfDoubles ( chol );
+    deleteMatrixOfDoubles ( matrix );
+    chol   = nullptr;
+    matrix = nullptr;
+}
+
+void testEigen ( )
+{
+    unsigned long long int size    = 0;
+    MatrixOfDoubles        matrix  = nullptr;
+    MatrixOfDoubles        vectors = nullptr;
+    MatrixOfDoubles        u       = nullptr;
+    MatrixOfDoubles        v       = nullptr;
+
+    sizeofMatrixOfDoubles ( &size );
+    matrix  = std::malloc ( size );
+    vectors = std::malloc ( size );
+    u       = std::malloc ( size );
+    v       = std::malloc ( size );
+
+    // [2,1;1,2] has eigenvalues 1 and 3, along ( 1, -1 ) and ( 1, 1 ).
+    constructMatrixOfDoubles ( matrix, 2, 2 );
+    setIndexOfDoubles ( matrix, 0, 0, 2 );
+    setIndexOfDoubles ( matrix, 1, 0, 1 );
+    setIndexOfDoubles ( matrix, 1, 1, 2 );
+    double values [ 2 ] = { 0, 0 };
+    double corner       = 0;
+    int    status       = symmetricEigenOfDoubles ( values, vectors, matrix );
+    getIndexOfDoubles ( vectors, 0, 0, &corner );
+    std::cout << "Expected: status = 0, values = 1 3, |v00| = 0.707107\n";
+    std::cout << "Actual  : status = " << status << ", values = " << values [ 0 ]
+              << " " << values [ 1 ] << ", |v00| = " << std::abs ( corner )
+              << "\n";
+
+    // [3,0;4,5] has singular values sqrt ( 45 ) and sqrt ( 5 ).
+    setIndexOfDoubles ( matrix, 0, 0, 3 );
+    setIndexOfDoubles ( matrix, 1, 0, 4 );
+    setIndexOfDoubles ( matrix, 1, 1, 5 );
+    svdOfDoubles ( u, values, v, matrix );
+    std::cout << "Expected: 6.7082 2.23607\n";
+    std::cout << "Actual  : " << values [ 0 ] << " " << values [ 1 ] << "\n";
+
+    // only the largest, and a rank the matrix cannot have.
+    deleteMatrixOfDoubles ( v );
+    deleteMatrixOfDoubles ( u );
+    int const fitted  = randomizedSvdOfDoubles ( u, values, v, matrix, 1, 7 );
+    int const refused = randomizedSvdOfDoubles ( u, values, v, matrix, 3, 7 );
+    std::cout << "Expected: 0 then -1, 6.7082\n";
+    std::cout << "Actual  : " << fitted << " then " << refused << ", "
+              << values [ 0 ] << "\n";
+
+    deleteMatrixOfDoubles ( v );
+    deleteMatrixOfDoubles ( u );
+    deleteMatrixOfDoubles ( vectors );
+    deleteMatrixOfDoubles ( matrix );
+    v       = nullptr;
+    u       = nullptr;
+    vectors = nullptr;
+    matrix  = nullptr;
+}
+
+void testQuantized ( )
+{
+    unsigned long long int size = 0;
+    sizeofQuantizedOfSingles ( &size );
+    QuantizedOfSingles lhs = std::malloc ( size );
+    QuantizedOfSingles rhs = std::malloc ( size );
+    sizeofMatrixOfSingles ( &size );
+    MatrixOfSingles dense   = std::malloc ( size );
+    MatrixOfSingles back    = std::malloc ( size );
+    MatrixOfSingles product = std::malloc ( size );
+
+    // [1,-2,0;0.5,1,2] per row, whose scales are 2/127 and 2/127, and the
+    // 3x3 identity per column.
+    constructMatrixOfSingles ( dense, 2, 3 );
+    float const values [] = { 1, -2, 0, 0.5f, 1, 2 };
+    copyFromRowMajorOfSingles ( dense, values, 3 );
+    quantizeOfSingles ( lhs, dense, 0, 0 );
+    dequantizeOfSingles ( back, lhs );
+    float out [ 6 ] = { 0, 0, 0, 0, 0, 0 };
+    copyToRowMajorOfSingles ( back, out, 3 );
+    bool near = true;
+    for ( int i = 0; i < 6; i++ )
+    {
+        near = near && std::abs ( out [ i ] - values [ i ] ) <= 1.0f / 127;
+    }
+    std::cout << "Does the quantized matrix stand for the one it came from? "
+              << ( near ? "Yes" : "No" ) << "\n";
+
+    float const x [] = { 1, 1, 1 };
+    float       y [] = { 0, 0 };
+    int const   evaluated = evalQuantizedOfSingles ( y, lhs, 3, x );
+    std::cout << "Expected: 0 then [-1;3.5]\n";
+    std::cout << "Actual  : " << evaluated << " then [" << std::round ( y [ 0 ] * 10 ) / 10
+              << ";" << std::round ( y [ 1 ] * 10 ) / 10 << "]\n";
+
+    deleteMatrixOfSingles ( back );
+    back = std::malloc ( size );
+    constructMatrixOfSingles ( back, 3, 3 );
+    float const identity [] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+    copyFromRowMajorOfSingles ( back, identity, 3 );
+    quantizeOfSingles ( rhs, back, 1, 1 );
+    bool const multiplied = mulQuantizedOfSingles ( product, lhs, rhs ) == 0
+                         && copyToRowMajorOfSingles ( product, out, 3 ) == 0;
+    for ( int i = 0; i < 6; i++ )
+    {
+        near = near && std::abs ( out [ i ] - values [ i ] ) <= 1.0f / 64;
+    }
+    std::cout << "Does the quantized identity leave the matrix as it was? "
+              << ( multiplied && near ? "Yes" : "No" ) << "\n";
+    deleteMatrixOfSingles ( product );
+    product = std::malloc ( size );
+    std::cout << "Does the identity on the wrong side fail? "
+              << ( mulQuantizedOfSingles ( product, rhs, lhs ) == -1 ? "Yes" : "No" )
+              << "\n";
+
+    // the same identity as a plain matrix, quantized on the way in.
+    bool const plain = mulQuantizedAndMatrixOfSingles ( product, lhs, back ) == 0
+                    && copyToRowMajorOfSingles ( product, out, 3 ) == 0;
+    for ( int i = 0; i < 6; i++ )
+    {
+        near = near && std::abs ( out [ i ] - values [ i ] ) <= 1.0f / 64;
+    }
+    std::cout << "Does the identity as a matrix leave it as it was too? "
+              << ( plain && near ? "Yes" : "No" ) << "\n";
+    deleteMatrixOfSingles ( product );
+    product = std::malloc ( size );
+
+    deleteQuantizedOfSingles ( lhs );
+    deleteQuantizedOfSingles ( rhs );
+    deleteMatrixOfSingles ( dense );
+    deleteMatrixOfSingles ( back );
+    std::free ( product );
+}
+
+void testLU ( )
+{
+    unsigned long long int size   = 0;
+    MatrixOfDoubles        matrix = nullptr;
+    LUOfDoubles            lu     = nullptr;
+
+    sizeofMatrixOfDoubles ( &size );
+    matrix = std::malloc ( size );
+    sizeofLUOfDoubles ( &size );
+    lu = std::malloc ( size );
+
+    double values [] = { 1, 2, 3, 4, 5, 6, 7, 8, 8 };
+    constructMatrixOfDoubles ( matrix, 3, 3 );
+    for ( std::size_t r = 0; r < 3; r++ )
+    {
+        for ( std::size_t c = 0; c < 3; c++ )
+        {
+            setIndexOfDoubles ( matrix, r, c, values [ 3 * r + c ] );
+        }
+    }
+
+    double b [ 3 ] = { 14, 32, 47 };
+    double x [ 3 ] = { 0, 0, 0 };
+    double det     = 0;
+    factorLUOfDoubles ( lu, matrix );
+    solveLUOfDoubles ( x, lu, 3, b );
+    determinantLUOfDoubles ( lu, &det );
+
+    std::cout << "Expected: det = 3, x = 1 2 3\n";
+    std::cout << "Actual  : det = " << det << ", x = " << x [ 0 ] << " "
+              << x [ 1 ] << " " << x [ 2 ] << "\n";
+
+    // factored in float, refined to double.
+    double                 refined [ 3 ] = { 0, 0, 0 };
+    unsigned long long int steps         = 0;
+    int const status = refinedSolveOfDoubles ( refined, matrix, 3, b, &steps );
+    double const error = std::abs ( refined [ 0 ] - 1 )
+                         + std::abs ( refined [ 1 ] - 2 )
+                         + std::abs ( refined [ 2 ] - 3 );
+    std::cout << "Expected: status = 0, x = 1 2 3 within 1e-12\n";
+    std::cout << "Actual  : status = " << status << ", x = " << refined [ 0 ]
+              << " " << refined [ 1 ] << " " << refined [ 2 ]
+              << ( error < 1e-12 ? " within 1e-12" : " further off" ) << "\n";
+
+    deleteLUOfDoubles ( lu );
+    deleteMatrixOfDoubles ( matrix );
+    lu     = nullptr;
+    matrix = nullptr;
+}
+
+void testThreadCount ( )
+{
+    size_y count = 0;
+    setThreadCount ( 3 );
+    countThreads ( &count );
+    std::cout << "Expected: 3 threads\n";
+    std::cout << "Actual  : " << count << " threads\n";
+    setThreadCount ( 0 );
 }
 
 void setIndex ( MatrixOfDoubles matrix, size_y r, size_y c, double val )